@@ -0,0 +1,152 @@
+//! Compares the pointer-linked [`Node`] tree with the compact [`Ast`] layout
+//!
+//! Usage: `bench_ast [n_statements]`
+
+// first, for the feature test macro
+#include "bench_util.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ast.h"
+#include "parse.h"
+#include "token.h"
+#include "utils.h"
+
+/// Times each traversal is repeated; the fastest one is reported
+#define N_REPEATS 20
+
+/// Visits a statement list in the order of `write_any`
+static uint64_t walk_node(Node *node) {
+    uint64_t sum = 0;
+
+    for (; node; node = node->next) {
+        sum += node->kind;
+
+        switch (node->kind) {
+        case ND_NUM:
+            sum += node->val;
+            break;
+        case ND_LVAR:
+            sum += node->offset;
+            break;
+        case ND_CALL:
+            sum += node->fname.len;
+            break;
+        case ND_IF:
+        case ND_WHILE:
+            sum += walk_node(node->cond);
+            sum += walk_node(node->then);
+            sum += walk_node(node->else_);
+            break;
+        case ND_FOR:
+            sum += walk_node(node->for_init);
+            sum += walk_node(node->cond);
+            sum += walk_node(node->for_inc);
+            sum += walk_node(node->then);
+            break;
+        case ND_BLOCK:
+            sum += walk_node(node->body);
+            break;
+        default:
+            sum += walk_node(node->lhs);
+            sum += walk_node(node->rhs);
+            break;
+        }
+    }
+
+    return sum;
+}
+
+/// Visits a statement list in the order of `write_any`
+static uint64_t walk_ast(const Ast *ast, NodeId id) {
+    uint64_t sum = 0;
+
+    for (; id != NODE_NIL; id = ast_get(ast, id)->next) {
+        AstNode *node = ast_get(ast, id);
+        sum += node->kind;
+
+        switch (node->kind) {
+        case ND_NUM:
+            sum += node->val;
+            break;
+        case ND_LVAR:
+            sum += node->offset;
+            break;
+        case ND_CALL:
+            sum += node->fname.len;
+            break;
+        case ND_IF:
+        case ND_WHILE:
+            sum += walk_ast(ast, node->branch.cond);
+            sum += walk_ast(ast, node->branch.then);
+            sum += walk_ast(ast, node->branch.else_);
+            break;
+        case ND_FOR:
+            sum += walk_ast(ast, node->loop.init);
+            sum += walk_ast(ast, node->loop.cond);
+            sum += walk_ast(ast, node->loop.inc);
+            sum += walk_ast(ast, node->loop.then);
+            break;
+        case ND_BLOCK:
+            sum += walk_ast(ast, node->body);
+            break;
+        default:
+            sum += walk_ast(ast, node->bin.lhs);
+            sum += walk_ast(ast, node->bin.rhs);
+            break;
+        }
+    }
+
+    return sum;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 200000;
+
+    char *src = gen_source(n);
+    Arena arena = arena_init(1 << 20);
+    Interner names = interner_init();
+    ParseState pst = pst_from_source(src, &arena, &names);
+    Scope scope = parse_program(&pst);
+
+    double t0 = now_sec();
+    Ast ast = ast_from_scope(scope);
+    double t_flatten = now_sec() - t0;
+
+    // the reserved `NODE_NIL` slot is not a node
+    size_t n_nodes = ast.len - 1;
+
+    double best_node = 1e9, best_ast = 1e9;
+    uint64_t sum_node = 0, sum_ast = 0;
+    for (int i = 0; i < N_REPEATS; i++) {
+        t0 = now_sec();
+        sum_node = walk_node(scope.node);
+        double t1 = now_sec();
+        sum_ast = walk_ast(&ast, ast.head);
+        double t2 = now_sec();
+
+        best_node = t1 - t0 < best_node ? t1 - t0 : best_node;
+        best_ast = t2 - t1 < best_ast ? t2 - t1 : best_ast;
+    }
+
+    if (sum_node != sum_ast) {
+        fprintf(stderr, "checksum mismatch: %llu (Node) != %llu (AstNode)\n",
+                (unsigned long long)sum_node, (unsigned long long)sum_ast);
+        return 1;
+    }
+
+    printf("statements: %d, nodes: %zu\n", n, n_nodes);
+    printf("%-8s %10s %14s %12s %14s\n", "layout", "node size", "total bytes", "walk (ms)",
+           "ns / node");
+    printf("%-8s %10zu %14zu %12.3f %14.2f\n", "Node", sizeof(Node), n_nodes * sizeof(Node),
+           best_node * 1e3, best_node * 1e9 / n_nodes);
+    printf("%-8s %10zu %14zu %12.3f %14.2f\n", "AstNode", sizeof(AstNode),
+           n_nodes * sizeof(AstNode), best_ast * 1e3, best_ast * 1e9 / n_nodes);
+    printf("flattening: %.3f ms\n", t_flatten * 1e3);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+//! Measures the tokenizer throughput with each scanner implementation
+//!
+//! Usage: `bench_lex [n_statements]`
+
+// first, for the feature test macro
+#include "bench_util.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "scan.h"
+#include "token.h"
+
+/// Times the source is tokenized; the fastest run is reported
+#define N_REPEATS 20
+
+/// Generates machine-generated-looking code: deep indentation and long names
+static char *gen_wide_source(int n) {
+    size_t cap = (size_t)n * 160 + 64;
+    char *src = malloc(cap);
+    size_t len = 0;
+
+    for (int i = 0; i < n; i++) {
+        int indent = 8 + (i % 4) * 8;
+        len += sprintf(src + len,
+                       "%*sgenerated_local_variable_%05d = generated_local_variable_%05d + "
+                       "123456789;\n",
+                       indent, "", i % 997, (i * 7) % 997);
+    }
+
+    sprintf(src + len, "return 0;\n");
+    return src;
+}
+
+static void bench(const char *workload, char *src, Interner *names, Scanner scan) {
+    size_t src_len = strlen(src);
+
+    double best = 1e9;
+    uint32_t n_tokens = 0;
+    for (int i = 0; i < N_REPEATS; i++) {
+        double t0 = now_sec();
+        TokenBuf tks = tokenize_with(src, names, scan);
+        double t = now_sec() - t0;
+
+        best = t < best ? t : best;
+        n_tokens = tks.n;
+
+        tokbuf_release(&tks);
+    }
+
+    printf("%-6s %-7s %8.2f %10u %10.3f %12.2f %10.1f\n", workload, scan.name, src_len / 1e6,
+           n_tokens, best * 1e3, n_tokens / best / 1e6, src_len / best / 1e6);
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 200000;
+
+    char *dense = gen_source(n);
+    char *wide = gen_wide_source(n);
+    Interner names = interner_init();
+
+    printf("%-6s %-7s %8s %10s %10s %12s %10s\n", "input", "scanner", "MB", "tokens", "ms",
+           "M tokens/s", "MB/s");
+
+    ScanImpl impls[] = {SCAN_SCALAR, SCAN_SSE2, SCAN_AVX2};
+    for (size_t i = 0; i < sizeof(impls) / sizeof(impls[0]); i++) {
+        if (!scanner_supported(impls[i])) {
+            continue;
+        }
+        bench("dense", dense, &names, scanner_get(impls[i]));
+        bench("wide", wide, &names, scanner_get(impls[i]));
+    }
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+//! Helpers shared by the benchmarks
+
+#ifndef CINC_BENCH_UTIL_H
+#define CINC_BENCH_UTIL_H
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static inline double now_sec() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/// Generates `n` statements of straight-line code, branches and loops
+static inline char *gen_source(int n) {
+    size_t cap = (size_t)n * 96 + 64;
+    char *src = malloc(cap);
+    size_t len = 0;
+
+    for (int i = 0; i < n; i++) {
+        int a = i % 61, b = (i * 7) % 61, c = (i * 13) % 61;
+        switch (i % 4) {
+        case 0:
+            len += sprintf(src + len, "v%d = v%d * 3 + (v%d - 7) / 2;\n", a, b, c);
+            break;
+        case 1:
+            len += sprintf(src + len, "if (v%d < 10) v%d = v%d + 1; else v%d = v%d - 1;\n", a, b, b,
+                           c, c);
+            break;
+        case 2:
+            len += sprintf(src + len, "while (v%d > 0) v%d = v%d - 1;\n", a, a, a);
+            break;
+        default:
+            len += sprintf(src + len, "for (i = 0; i < 10; i = i + 1) { v%d = v%d + i; }\n", a, a);
+            break;
+        }
+    }
+
+    sprintf(src + len, "return v0;\n");
+    return src;
+}
+
+#endif
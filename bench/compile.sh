@@ -0,0 +1,91 @@
+#!/usr/bin/env bash
+#
+# Compile-throughput benchmark, run via `make bench`
+#
+# Generates programs with `obj/bench_gen`, sweeping one parameter at a time, and reports the
+# throughput of `obj/cinc` from its `--stats=json`. A scaling cliff shows up as a drop of the
+# throughput along a sweep.
+#
+# Usage: `bench/compile.sh [n_repeats]`
+
+cd "$(dirname "$0")/.."
+
+CINC='./obj/cinc'
+GEN='./obj/bench_gen'
+DIR='./obj/bench'
+
+# the fastest run is reported
+N_REPEATS="${1:-3}"
+
+# parameters fixed while sweeping another one
+STMTS=100000
+DEPTH=3
+LOCALS=100
+NEST=2
+
+mkdir -p "$DIR"
+
+# Prints the first number after `"key": ` in JSON, e.g. `json_num tokens "$json"`
+json_num() {
+    grep -o "\"$1\": {*\"*[a-z_]*\"*:* *[0-9.]*" <<< "$2" | head -n 1 | grep -o '[0-9.]*$'
+}
+
+# Generates a program, compiles it and prints a row of the table
+run() {
+    label="$1"
+    shift
+
+    src="$DIR/gen.c"
+    "$GEN" "$@" > "$src"
+
+    best_ms=''
+    for _ in $(seq "$N_REPEATS"); do
+        json="$("$CINC" --stats=json -o /dev/null "$src" 2>&1 > /dev/null)" || {
+            echo "Failed to compile a program generated by \`$GEN $*\`"
+            exit 1
+        }
+
+        ms="$(json_num total "$json")"
+        if [ -z "$best_ms" ] || awk "BEGIN { exit !($ms < $best_ms) }"; then
+            best_ms="$ms"
+        fi
+    done
+
+    tokens="$(json_num tokens "$json")"
+    nodes="$(json_num nodes "$json")"
+    bytes="$(json_num emitted_bytes "$json")"
+
+    awk -v label="$label" -v ms="$best_ms" -v tokens="$tokens" -v nodes="$nodes" -v bytes="$bytes" \
+        'BEGIN {
+            s = ms / 1000
+            printf "%-14s %10d %10d %10.1f %12.2f %12.2f %12.1f\n", label, tokens, nodes, ms,
+                   tokens / s / 1e6, nodes / s / 1e6, bytes / s / 1e6
+        }'
+}
+
+header() {
+    echo
+    echo "$1"
+    printf "%-14s %10s %10s %10s %12s %12s %12s\n" \
+        'param' 'tokens' 'nodes' 'ms' 'Mtokens/s' 'Mnodes/s' 'MB/s emitted'
+}
+
+header "statements (depth=$DEPTH, locals=$LOCALS, nest=$NEST)"
+for n in 1000 10000 100000 1000000; do
+    run "stmts=$n" --stmts="$n" --depth="$DEPTH" --locals="$LOCALS" --nest="$NEST"
+done
+
+header "distinct locals (stmts=$STMTS, depth=$DEPTH, nest=$NEST)"
+for n in 1 10 100 1000 10000 100000; do
+    run "locals=$n" --stmts="$STMTS" --depth="$DEPTH" --locals="$n" --nest="$NEST"
+done
+
+header "expression depth (stmts=$((STMTS / 10)), locals=$LOCALS, nest=$NEST)"
+for n in 1 4 16 64 256; do
+    run "depth=$n" --stmts="$((STMTS / 10))" --depth="$n" --locals="$LOCALS" --nest="$NEST"
+done
+
+header "nesting (stmts=$STMTS, depth=$DEPTH, locals=$LOCALS)"
+for n in 0 1 4 16 64; do
+    run "nest=$n" --stmts="$STMTS" --depth="$DEPTH" --locals="$LOCALS" --nest="$n"
+done
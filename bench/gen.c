@@ -0,0 +1,213 @@
+//! Generates a large valid program in the grammar cinc supports, written to stdout
+//!
+//! Usage: `bench_gen [--stmts=N] [--depth=N] [--locals=N] [--nest=N] [--seed=N]`
+//!
+//! - `stmts`: number of assignments (the leaves of the statement tree)
+//! - `depth`: depth of the expression on the right-hand side of each assignment
+//! - `locals`: number of distinct local variables, all initialized first
+//! - `nest`: maximum nesting of `if` / `while` / `for` / `{}`
+//!
+//! Loops are bounded and divisors are non-zero constants, so the program also runs.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    long stmts;
+    int depth;
+    long locals;
+    int nest;
+    uint64_t seed;
+} GenConfig;
+
+typedef struct {
+    GenConfig cfg;
+    uint64_t rng;
+    /// Assignments left to generate
+    long budget;
+    FILE *out;
+} Gen;
+
+/// xorshift64*, so that the output is the same across platforms
+static uint32_t rand_u32(Gen *gen) {
+    gen->rng ^= gen->rng >> 12;
+    gen->rng ^= gen->rng << 25;
+    gen->rng ^= gen->rng >> 27;
+    return (gen->rng * 2685821657736338717ull) >> 32;
+}
+
+/// Random integer in `[0, n)`
+static long rand_below(Gen *gen, long n) {
+    return rand_u32(gen) % n;
+}
+
+static void indent(Gen *gen, int level) {
+    fprintf(gen->out, "%*s", level * 4, "");
+}
+
+static void gen_leaf(Gen *gen) {
+    switch (rand_below(gen, 8)) {
+    case 0:
+    case 1:
+        fprintf(gen->out, "%ld", rand_below(gen, 100));
+        break;
+    case 2:
+        fprintf(gen->out, "ret3()");
+        break;
+    default:
+        fprintf(gen->out, "v%ld", rand_below(gen, gen->cfg.locals));
+        break;
+    }
+}
+
+/// Generates an expression of the given depth. Its left operand has the depth minus one and the
+/// right operand is shallow, so that the size grows linearly with the depth
+static void gen_expr(Gen *gen, int depth) {
+    if (depth == 0) {
+        gen_leaf(gen);
+        return;
+    }
+
+    static const char *OPS[] = {"+", "-", "*", "+", "-", "==", "!=", "<", "<=", ">", ">="};
+    int n_ops = sizeof OPS / sizeof OPS[0];
+
+    switch (rand_below(gen, 8)) {
+    case 0:
+        fprintf(gen->out, "-(");
+        gen_expr(gen, depth - 1);
+        fprintf(gen->out, ")");
+        return;
+
+    case 1:
+        // never divide by zero
+        fprintf(gen->out, "(");
+        gen_expr(gen, depth - 1);
+        fprintf(gen->out, ") / %ld", 1 + rand_below(gen, 9));
+        return;
+
+    default:
+        fprintf(gen->out, "(");
+        gen_expr(gen, depth - 1);
+        fprintf(gen->out, " %s ", OPS[rand_below(gen, n_ops)]);
+        gen_expr(gen, depth > 2 ? rand_below(gen, 2) : 0);
+        fprintf(gen->out, ")");
+        return;
+    }
+}
+
+static void gen_assign(Gen *gen, int level) {
+    indent(gen, level);
+    fprintf(gen->out, "v%ld = ", rand_below(gen, gen->cfg.locals));
+    gen_expr(gen, gen->cfg.depth);
+    fprintf(gen->out, ";\n");
+    gen->budget -= 1;
+}
+
+static void gen_stmt(Gen *gen, int level);
+
+/// A few statements
+static void gen_stmts(Gen *gen, int level) {
+    for (long n = 1 + rand_below(gen, 4); n > 0 && gen->budget > 0; n--) {
+        gen_stmt(gen, level);
+    }
+}
+
+/// `{ stmt* }`
+static void gen_block(Gen *gen, int level) {
+    fprintf(gen->out, "{\n");
+    gen_stmts(gen, level + 1);
+    indent(gen, level);
+    fprintf(gen->out, "}\n");
+}
+
+static void gen_stmt(Gen *gen, int level) {
+    // half of the statements are compound while the nesting is allowed
+    if (level >= gen->cfg.nest || rand_below(gen, 2) == 0) {
+        gen_assign(gen, level);
+        return;
+    }
+
+    indent(gen, level);
+
+    // loop counters are not assigned in the bodies, so that the loops terminate
+    switch (rand_below(gen, 4)) {
+    case 0:
+        fprintf(gen->out, "if (");
+        gen_expr(gen, 1);
+        fprintf(gen->out, ") ");
+        gen_block(gen, level);
+        if (rand_below(gen, 2) && gen->budget > 0) {
+            indent(gen, level);
+            fprintf(gen->out, "else ");
+            gen_block(gen, level);
+        }
+        return;
+
+    case 1:
+        fprintf(gen->out, "w%d = 0;\n", level);
+        indent(gen, level);
+        fprintf(gen->out, "while (w%d < 2) {\n", level);
+        indent(gen, level + 1);
+        fprintf(gen->out, "w%d = w%d + 1;\n", level, level);
+        gen_stmts(gen, level + 1);
+        indent(gen, level);
+        fprintf(gen->out, "}\n");
+        return;
+
+    case 2:
+        fprintf(gen->out, "for (i%d = 0; i%d < 2; i%d = i%d + 1) ", level, level, level, level);
+        gen_block(gen, level);
+        return;
+
+    default:
+        gen_block(gen, level);
+        return;
+    }
+}
+
+static long parse_arg(const char *arg, const char *name) {
+    size_t len = strlen(name);
+    if (strncmp(arg, name, len) != 0 || arg[len] != '=') {
+        return -1;
+    }
+    return strtol(arg + len + 1, NULL, 10);
+}
+
+int main(int argc, char **argv) {
+    GenConfig cfg = {.stmts = 1000, .depth = 3, .locals = 100, .nest = 2, .seed = 1};
+
+    for (int i = 1; i < argc; i++) {
+        long v;
+        if ((v = parse_arg(argv[i], "--stmts")) >= 0) {
+            cfg.stmts = v;
+        } else if ((v = parse_arg(argv[i], "--depth")) >= 0) {
+            cfg.depth = v;
+        } else if ((v = parse_arg(argv[i], "--locals")) >= 1) {
+            cfg.locals = v;
+        } else if ((v = parse_arg(argv[i], "--nest")) >= 0) {
+            cfg.nest = v;
+        } else if ((v = parse_arg(argv[i], "--seed")) >= 0) {
+            cfg.seed = v;
+        } else {
+            fprintf(stderr, "Usage: bench_gen [--stmts=N] [--depth=N] [--locals=N] [--nest=N] "
+                            "[--seed=N]\n");
+            exit(1);
+        }
+    }
+
+    Gen gen = {.cfg = cfg, .rng = cfg.seed * 0x9e3779b97f4a7c15ull + 1, .budget = cfg.stmts};
+    gen.out = stdout;
+
+    for (long i = 0; i < cfg.locals; i++) {
+        fprintf(gen.out, "v%ld = %ld;\n", i, i % 10);
+    }
+
+    while (gen.budget > 0) {
+        gen_stmt(&gen, 0);
+    }
+
+    fprintf(gen.out, "return v0;\n");
+    return 0;
+}
@@ -0,0 +1,8 @@
+n = bench_n() * 100;
+s = 0;
+i = 0;
+while (i < n) {
+    s = s + ret3() * ret5() - ret3();
+    i = i + 1;
+}
+return s / n;
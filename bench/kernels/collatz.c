@@ -0,0 +1,13 @@
+n = bench_n() * 10;
+steps = 0;
+i = 1;
+while (i <= n) {
+    x = i;
+    while (x != 1) {
+        if (x / 2 * 2 == x) x = x / 2;
+        else x = 3 * x + 1;
+        steps = steps + 1;
+    }
+    i = i + 1;
+}
+return steps / n;
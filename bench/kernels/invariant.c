@@ -0,0 +1,6 @@
+n = bench_n() * 1000;
+a = ret3();
+b = ret5();
+s = 0;
+for (i = 0; i < n; i = i + 1) s = s + i * 7 + a * b - (a + b) / 3 + i * b;
+return s / n;
@@ -0,0 +1,11 @@
+n = bench_n() / 4;
+s = 0;
+k = 0;
+for (i = 0; i < n; i = i + 1) {
+    for (j = 0; j < n; j = j + 1) {
+        s = s + k * 3 - k / 5;
+        k = k + 1;
+    }
+    k = 0;
+}
+return s / n;
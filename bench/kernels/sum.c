@@ -0,0 +1,4 @@
+n = bench_n() * 1000;
+s = 0;
+for (i = 0; i < n; i = i + 1) s = s + i;
+return s / n;
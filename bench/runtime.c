@@ -0,0 +1,69 @@
+//! Times a kernel of `bench/kernels`, linked in as the function `kernel`
+//!
+//! Usage: `bench_runtime <n> <n_repeats>`
+//!
+//! Prints the kernel's result, then the fastest run in cycles and in nanoseconds.
+
+// first, for the feature test macro
+#include "bench_util.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <x86intrin.h>
+
+/// Compiled from a kernel by cinc (`--entry=kernel`) or by gcc
+long kernel(void);
+
+/// Problem size of the kernels. It's read at runtime, so that gcc can't fold the kernels away
+static long gN;
+
+long bench_n(void) {
+    return gN;
+}
+
+// helpers for call-heavy kernels, like `obj/asset.o` of the tests
+long ret3(void) {
+    return 3;
+}
+
+long ret5(void) {
+    return 5;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: bench_runtime <n> <n_repeats>\n");
+        return 1;
+    }
+
+    gN = atol(argv[1]);
+    int n_repeats = atoi(argv[2]);
+
+    // warm up the caches and the branch predictor
+    long result = kernel();
+
+    uint64_t best_cycles = UINT64_MAX;
+    double best_sec = 1e9;
+    for (int i = 0; i < n_repeats; i++) {
+        double start_sec = now_sec();
+        uint64_t start = __rdtsc();
+        long r = kernel();
+        uint64_t cycles = __rdtsc() - start;
+        double sec = now_sec() - start_sec;
+
+        if (r != result) {
+            fprintf(stderr, "The kernel returned %ld, then %ld\n", result, r);
+            return 1;
+        }
+        if (cycles < best_cycles) {
+            best_cycles = cycles;
+        }
+        if (sec < best_sec) {
+            best_sec = sec;
+        }
+    }
+
+    printf("%ld %llu %.0f\n", result, (unsigned long long)best_cycles, best_sec * 1e9);
+    return 0;
+}
@@ -0,0 +1,79 @@
+#!/usr/bin/env bash
+#
+# Runtime benchmark of the generated code, run via `make bench-runtime`
+#
+# Each kernel in `bench/kernels` is compiled by cinc and by gcc (`-O0` and `-O2`), linked with
+# `bench/runtime.c` and timed. The table shows the fastest run in cycles (rdtsc), and how many times
+# slower cinc is than each gcc.
+#
+# Usage: `bench/runtime.sh [n] [n_repeats]`, with extra cinc flags in `CINC_FLAGS` (e.g.
+# `CINC_FLAGS=--backend=ir`)
+
+cd "$(dirname "$0")/.."
+
+CINC='./obj/cinc'
+DIR='./obj/bench'
+
+# problem size, returned by `bench_n()` in the kernels
+N="${1:-1000}"
+# the fastest run is reported
+N_REPEATS="${2:-10}"
+
+mkdir -p "$DIR"
+
+harness="$DIR/runtime.o"
+gcc -O2 -c -Ibench -o "$harness" bench/runtime.c || exit 1
+
+# Wraps a kernel into a C function, declaring its local variables as `long`
+to_c() {
+    src="$1"
+
+    # identifiers that are neither keywords nor function calls
+    locals="$(grep -oE '[A-Za-z_][A-Za-z0-9_]* *\(?' "$src" | tr -d ' ' | grep -v '($' |
+        grep -vxE 'return|if|else|while|for' | sort -u | sed 's/$/ = 0/' | paste -sd ',')"
+
+    echo 'long bench_n(void);'
+    echo 'long ret3(void);'
+    echo 'long ret5(void);'
+    echo 'long kernel(void) {'
+    [ -n "$locals" ] && echo "long $locals;"
+    cat "$src"
+    echo '}'
+}
+
+# Links an assembly or C file with the harness and runs it
+run() {
+    bin="$DIR/runtime_$1"
+    shift
+
+    gcc -static -z noexecstack "$@" "$harness" -o "$bin" || exit 1
+    "$bin" "$N" "$N_REPEATS" || exit 1
+}
+
+printf "%-12s %12s %12s %12s %10s %10s\n" \
+    'kernel' 'cinc Mcyc' 'gcc-O0 Mcyc' 'gcc-O2 Mcyc' 'vs -O0' 'vs -O2'
+
+for src in bench/kernels/*.c; do
+    name="$(basename "$src" .c)"
+
+    "$CINC" $CINC_FLAGS --entry=kernel -o "$DIR/$name.s" "$src" || {
+        echo "Failed to compile \`$src\`"
+        exit 1
+    }
+    to_c "$src" > "$DIR/$name-gcc.c"
+
+    read -r r_cinc c_cinc _ <<< "$(run cinc "$DIR/$name.s")"
+    read -r r_o0 c_o0 _ <<< "$(run o0 -O0 "$DIR/$name-gcc.c")"
+    read -r r_o2 c_o2 _ <<< "$(run o2 -O2 "$DIR/$name-gcc.c")"
+
+    if [ "$r_cinc" != "$r_o0" ] || [ "$r_cinc" != "$r_o2" ]; then
+        echo "err: \`$name\` returned $r_cinc (cinc), $r_o0 (gcc -O0) and $r_o2 (gcc -O2)"
+        exit 1
+    fi
+
+    awk -v name="$name" -v a="$c_cinc" -v b="$c_o0" -v c="$c_o2" \
+        'BEGIN {
+            printf "%-12s %12.2f %12.2f %12.2f %9.2fx %9.2fx\n", name, a / 1e6, b / 1e6, c / 1e6,
+                   a / b, a / c
+        }'
+done
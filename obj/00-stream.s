@@ -0,0 +1,20 @@
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    push 0
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
@@ -0,0 +1,20 @@
+# return 42;
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 42
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,30 @@
+#  return 12 + 34 - 5 ;
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 12
+    push 34
+    pop rdi
+    pop rax
+    add rax, rdi
+    push rax
+    push 5
+    pop rdi
+    pop rax
+    sub rax, rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,30 @@
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    push 5
+    push 6
+    push 7
+    pop rdi
+    pop rax
+    imul rax, rdi
+    push rax
+    pop rdi
+    pop rax
+    add rax, rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
@@ -0,0 +1,30 @@
+# return 5 * (9 - 6);
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 5
+    push 9
+    push 6
+    pop rdi
+    pop rax
+    sub rax, rdi
+    push rax
+    pop rdi
+    pop rax
+    imul rax, rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,32 @@
+# return (3 + 5) / 2;
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 3
+    push 5
+    pop rdi
+    pop rax
+    add rax, rdi
+    push rax
+    push 2
+    pop rdi
+    pop rax
+  # /
+    cqo
+    idiv rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
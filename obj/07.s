@@ -0,0 +1,35 @@
+# return -(-3 * +5);
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 0
+    push 0
+    push 3
+    pop rdi
+    pop rax
+    sub rax, rdi
+    push rax
+    push 5
+    pop rdi
+    pop rax
+    imul rax, rdi
+    push rax
+    pop rdi
+    pop rax
+    sub rax, rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,30 @@
+# return -10+20;
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 0
+    push 10
+    pop rdi
+    pop rax
+    sub rax, rdi
+    push rax
+    push 20
+    pop rdi
+    pop rax
+    add rax, rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,28 @@
+# return 0<1;
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 0
+    push 1
+    pop rdi
+    pop rax
+  # <
+    cmp rax, rdi
+    setl al
+    movzb rax, al
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
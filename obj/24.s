@@ -0,0 +1,36 @@
+# 3 + 4; return 4 <= 6;
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 3
+    push 4
+    pop rdi
+    pop rax
+    add rax, rdi
+    push rax
+  # discard
+    pop rax
+    push 4
+    push 6
+    pop rdi
+    pop rax
+  # <=
+    cmp rax, rdi
+    setle al
+    movzb rax, al
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
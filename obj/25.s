@@ -0,0 +1,45 @@
+# a = 10; return a + 2;
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    push rax
+    push 10
+  # assign
+    pop rdi
+    pop rax
+    mov [rax], rdi
+    push rdi
+  # discard
+    pop rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    push rax
+  # dereference rax
+    pop rax
+    mov rax, [rax]
+    push rax
+    push 2
+    pop rdi
+    pop rax
+    add rax, rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,70 @@
+# a = 10; b = 12; return a + b + 2;
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    push rax
+    push 10
+  # assign
+    pop rdi
+    pop rax
+    mov [rax], rdi
+    push rdi
+  # discard
+    pop rax
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    push rax
+    push 12
+  # assign
+    pop rdi
+    pop rax
+    mov [rax], rdi
+    push rdi
+  # discard
+    pop rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    push rax
+  # dereference rax
+    pop rax
+    mov rax, [rax]
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    push rax
+  # dereference rax
+    pop rax
+    mov rax, [rax]
+    push rax
+    pop rdi
+    pop rax
+    add rax, rdi
+    push rax
+    push 2
+    pop rdi
+    pop rax
+    add rax, rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
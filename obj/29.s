@@ -0,0 +1,23 @@
+# return 3; 5;
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 3
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    push 5
+  # discard
+    pop rax
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,33 @@
+# if (0) return 10; return 11;
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+  # if
+    push 0
+    pop rax
+    cmp rax, 0
+    je .Lend_if0
+    push 10
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    jmp .Lend_if0
+.Lend_if0:
+    push 11
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,35 @@
+.intel_syntax noprefix
+.global main
+main:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # if else
+    push 1
+    pop rax
+    cmp rax, 0
+    je .Lelse0
+    push 10
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    jmp .Lend_if0
+.Lelse0:
+    push 11
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    jmp .Lend_if0
+.Lend_if0:
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
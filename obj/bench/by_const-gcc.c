@@ -0,0 +1,16 @@
+long bench_n(void);
+long ret3(void);
+long ret5(void);
+long kernel(void) {
+long i = 0,n = 0,s = 0,x = 0;
+n = bench_n() * 100;
+s = 0;
+i = 0;
+while (i < n) {
+    x = i * 12 - s / 7;
+    s = s + x / 10 + x / -16 + x * 9 / 1000;
+    s = s - s / 1000003 * 1000003;
+    i = i + 1;
+}
+return s;
+}
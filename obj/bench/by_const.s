@@ -0,0 +1,80 @@
+.intel_syntax noprefix
+.global kernel
+kernel:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    mov qword ptr [rbp-8], rbx
+.LB0:
+    call bench_n
+    mov rcx, rax
+    imul rcx, 100
+    mov rsi, 0
+    mov rdi, 0
+    mov r8, rdi
+    lea r8, [r8 + r8*2]
+    shl r8, 2
+    mov r9, 12
+    cmp rdi, rcx
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov rax, 5270498306774157605
+    imul rsi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov r10, rax
+    neg r10
+    add r10, r8
+    mov rax, 7378697629483820647
+    imul r10
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov r11, rax
+    add r11, rsi
+    mov rax, r10
+    cqo
+    shr rdx, 60
+    add rax, rdx
+    sar rax, 4
+    neg rax
+    mov rbx, rax
+    add r11, rbx
+    lea r10, [r10 + r10*8]
+    mov rax, 2361183241434822607
+    imul r10
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov r10, rax
+    mov rsi, r11
+    add rsi, r10
+    mov rax, -8775366530925146571
+    imul rsi
+    add rdx, rsi
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov r10, rax
+    imul r10, 1000003
+    sub rsi, r10
+    mov r10, 1
+    add rdi, r10
+    add r8, r9
+    cmp rdi, rcx
+    jl .LB1
+.LB2:
+    mov rax, rsi
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
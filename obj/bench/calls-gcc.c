@@ -0,0 +1,14 @@
+long bench_n(void);
+long ret3(void);
+long ret5(void);
+long kernel(void) {
+long i = 0,n = 0,s = 0;
+n = bench_n() * 100;
+s = 0;
+i = 0;
+while (i < n) {
+    s = s + ret3() * ret5() - ret3();
+    i = i + 1;
+}
+return s / n;
+}
@@ -0,0 +1,51 @@
+.intel_syntax noprefix
+.global kernel
+kernel:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 48
+
+    mov qword ptr [rbp-8], rbx
+    mov qword ptr [rbp-16], r12
+    mov qword ptr [rbp-24], r13
+    mov qword ptr [rbp-32], r14
+.LB0:
+    call bench_n
+    mov rcx, rax
+    mov rbx, rcx
+    imul rbx, 100
+    mov r12, 0
+    mov r13, 0
+    cmp r13, rbx
+    jge .LB2
+    .p2align 4
+.LB1:
+    call ret3
+    mov r14, rax
+    call ret5
+    mov rcx, rax
+    imul rcx, r14
+    mov r14, r12
+    add r14, rcx
+    call ret3
+    mov rcx, rax
+    mov r12, r14
+    sub r12, rcx
+    mov rcx, 1
+    add r13, rcx
+    cmp r13, rbx
+    jl .LB1
+.LB2:
+    mov rax, r12
+    cqo
+    idiv rbx
+    mov rcx, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov r12, qword ptr [rbp-16]
+    mov r13, qword ptr [rbp-24]
+    mov r14, qword ptr [rbp-32]
+    mov rsp, rbp
+    pop rbp
+    ret
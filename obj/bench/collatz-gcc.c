@@ -0,0 +1,19 @@
+long bench_n(void);
+long ret3(void);
+long ret5(void);
+long kernel(void) {
+long i = 0,n = 0,steps = 0,x = 0;
+n = bench_n() * 10;
+steps = 0;
+i = 1;
+while (i <= n) {
+    x = i;
+    while (x != 1) {
+        if (x / 2 * 2 == x) x = x / 2;
+        else x = 3 * x + 1;
+        steps = steps + 1;
+    }
+    i = i + 1;
+}
+return steps / n;
+}
@@ -0,0 +1,68 @@
+.intel_syntax noprefix
+.global kernel
+kernel:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call bench_n
+    mov rcx, rax
+    lea rcx, [rcx + rcx*4]
+    shl rcx, 1
+    mov rsi, 0
+    mov rdi, 1
+    cmp rdi, rcx
+    jg .LB7
+    .p2align 4
+.LB1:
+    mov r8, rdi
+    mov r9, 1
+    cmp r8, r9
+    je .LB6
+    .p2align 4
+.LB2:
+    mov rax, r8
+    cqo
+    shr rdx, 63
+    add rax, rdx
+    sar rax, 1
+    mov r9, rax
+    shl r9, 1
+    cmp r9, r8
+    jne .LB4
+.LB3:
+    mov rax, r8
+    cqo
+    shr rdx, 63
+    add rax, rdx
+    sar rax, 1
+    mov r8, rax
+    jmp .LB5
+.LB4:
+    mov r9, r8
+    lea r9, [r9 + r9*2]
+    mov r10, 1
+    mov r8, r9
+    add r8, r10
+.LB5:
+    mov r9, 1
+    add rsi, r9
+    mov r9, 1
+    cmp r8, r9
+    jne .LB2
+.LB6:
+    mov r8, 1
+    add rdi, r8
+    cmp rdi, rcx
+    jle .LB1
+.LB7:
+    mov rax, rsi
+    cqo
+    idiv rcx
+    mov rcx, rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,14 @@
+long bench_n(void);
+long ret3(void);
+long ret5(void);
+long kernel(void) {
+long c = 0,i = 0,n = 0;
+n = bench_n() * 1000;
+c = 0;
+i = 0;
+while (i < n) {
+    i = i + 1;
+    if (i / 8 * 8 == i) c = c + 1;
+}
+return c / 1000;
+}
@@ -0,0 +1,47 @@
+.intel_syntax noprefix
+.global kernel
+kernel:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call bench_n
+    mov rcx, rax
+    imul rcx, 1000
+    mov rsi, 0
+    mov rdi, 0
+    cmp rdi, rcx
+    jge .LB4
+    .p2align 4
+.LB1:
+    mov r8, 1
+    add rdi, r8
+    mov rax, rdi
+    cqo
+    shr rdx, 61
+    add rax, rdx
+    sar rax, 3
+    mov r8, rax
+    shl r8, 3
+    cmp r8, rdi
+    jne .LB3
+.LB2:
+    mov r8, 1
+    add rsi, r8
+.LB3:
+    cmp rdi, rcx
+    jl .LB1
+.LB4:
+    mov rax, 2361183241434822607
+    imul rsi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rcx, rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
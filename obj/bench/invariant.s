@@ -0,0 +1,65 @@
+.intel_syntax noprefix
+.global kernel
+kernel:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 32
+
+    mov qword ptr [rbp-8], rbx
+    mov qword ptr [rbp-16], r12
+    mov qword ptr [rbp-24], r13
+.LB0:
+    call bench_n
+    mov rcx, rax
+    mov rbx, rcx
+    imul rbx, 1000
+    call ret3
+    mov r12, rax
+    call ret5
+    mov rcx, rax
+    mov rsi, 0
+    mov rdi, 0
+    mov r8, r12
+    imul r8, rcx
+    mov r9, r12
+    add r9, rcx
+    mov rax, 6148914691236517206
+    imul r9
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov r9, rax
+    mov r10, rdi
+    imul r10, 7
+    mov r11, 7
+    mov r12, rdi
+    imul r12, rcx
+    cmp rdi, rbx
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov r13, rsi
+    add r13, r10
+    add r13, r8
+    sub r13, r9
+    mov rsi, r13
+    add rsi, r12
+    mov r13, 1
+    add rdi, r13
+    add r10, r11
+    add r12, rcx
+    cmp rdi, rbx
+    jl .LB1
+.LB2:
+    mov rax, rsi
+    cqo
+    idiv rbx
+    mov rcx, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov r12, qword ptr [rbp-16]
+    mov r13, qword ptr [rbp-24]
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,68 @@
+.intel_syntax noprefix
+.global kernel
+kernel:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 32
+
+    mov qword ptr [rbp-8], rbx
+    mov qword ptr [rbp-16], r12
+.LB0:
+    call bench_n
+    mov rcx, rax
+    cqo
+    shr rdx, 62
+    add rax, rdx
+    sar rax, 2
+    mov rcx, rax
+    mov rsi, 0
+    mov rdi, 0
+    mov r8, 0
+    cmp r8, rcx
+    jge .LB4
+    .p2align 4
+.LB1:
+    mov r9, 0
+    mov r10, rdi
+    lea r10, [r10 + r10*2]
+    mov r11, 3
+    cmp r9, rcx
+    jge .LB3
+    .p2align 4
+.LB2:
+    mov rbx, rsi
+    add rbx, r10
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov r12, rax
+    mov rsi, rbx
+    sub rsi, r12
+    mov rbx, 1
+    add rdi, rbx
+    add r10, r11
+    mov rbx, 1
+    add r9, rbx
+    cmp r9, rcx
+    jl .LB2
+.LB3:
+    mov rdi, 0
+    mov r9, 1
+    add r8, r9
+    cmp r8, rcx
+    jl .LB1
+.LB4:
+    mov rax, rsi
+    cqo
+    idiv rcx
+    mov rcx, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov r12, qword ptr [rbp-16]
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,17 @@
+long bench_n(void);
+long ret3(void);
+long ret5(void);
+long kernel(void) {
+long h = 0,i = 0,n = 0,s = 0;
+n = bench_n() * 100;
+h = 7;
+s = 0;
+i = 0;
+while (i < n) {
+    h = h * 31 + i;
+    h = h - h / 1000003 * 1000003;
+    s = s + h * h - (h + i) / 7;
+    i = i + 1;
+}
+return s / n;
+}
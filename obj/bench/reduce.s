@@ -0,0 +1,60 @@
+.intel_syntax noprefix
+.global kernel
+kernel:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call bench_n
+    mov rcx, rax
+    imul rcx, 100
+    mov rsi, 7
+    mov rdi, 0
+    mov r8, 0
+    cmp r8, rcx
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov r9, rsi
+    imul r9, 31
+    mov rsi, r9
+    add rsi, r8
+    mov rax, -8775366530925146571
+    imul rsi
+    add rdx, rsi
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov r9, rax
+    imul r9, 1000003
+    sub rsi, r9
+    mov r9, rsi
+    imul r9, rsi
+    add r9, rdi
+    mov r10, rsi
+    add r10, r8
+    mov rax, 5270498306774157605
+    imul r10
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov r10, rax
+    mov rdi, r9
+    sub rdi, r10
+    mov r9, 1
+    add r8, r9
+    cmp r8, rcx
+    jl .LB1
+.LB2:
+    mov rax, rdi
+    cqo
+    idiv rcx
+    mov rcx, rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
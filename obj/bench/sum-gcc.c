@@ -0,0 +1,10 @@
+long bench_n(void);
+long ret3(void);
+long ret5(void);
+long kernel(void) {
+long i = 0,n = 0,s = 0;
+n = bench_n() * 1000;
+s = 0;
+for (i = 0; i < n; i = i + 1) s = s + i;
+return s / n;
+}
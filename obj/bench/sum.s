@@ -0,0 +1,32 @@
+.intel_syntax noprefix
+.global kernel
+kernel:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call bench_n
+    mov rcx, rax
+    imul rcx, 1000
+    mov rsi, 0
+    mov rdi, 0
+    cmp rdi, rcx
+    jge .LB2
+    .p2align 4
+.LB1:
+    add rsi, rdi
+    mov r8, 1
+    add rdi, r8
+    cmp rdi, rcx
+    jl .LB1
+.LB2:
+    mov rax, rsi
+    cqo
+    idiv rcx
+    mov rcx, rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
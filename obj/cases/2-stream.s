@@ -0,0 +1,30 @@
+.intel_syntax noprefix
+.global case_2_stream
+case_2_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    push 5
+    push 20
+    pop rdi
+    pop rax
+    add rax, rdi
+    push rax
+    push 4
+    pop rdi
+    pop rax
+    sub rax, rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
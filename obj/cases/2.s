@@ -0,0 +1,29 @@
+.intel_syntax noprefix
+.global case_2
+case_2:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 5
+    push 20
+    pop rdi
+    pop rax
+    add rax, rdi
+    push rax
+    push 4
+    pop rdi
+    pop rax
+    sub rax, rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
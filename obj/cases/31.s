@@ -0,0 +1,32 @@
+.intel_syntax noprefix
+.global case_31
+case_31:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+  # if
+    push 1
+    pop rax
+    cmp rax, 0
+    je .Lend_if0
+    push 10
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    jmp .Lend_if0
+.Lend_if0:
+    push 11
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,20 @@
+.intel_syntax noprefix
+.global case_41
+case_41:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    call ret5
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
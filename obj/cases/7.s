@@ -0,0 +1,34 @@
+.intel_syntax noprefix
+.global case_7
+case_7:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 0
+    push 0
+    push 3
+    pop rdi
+    pop rax
+    sub rax, rdi
+    push rax
+    push 5
+    pop rdi
+    pop rax
+    imul rax, rdi
+    push rax
+    pop rdi
+    pop rax
+    sub rax, rdi
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
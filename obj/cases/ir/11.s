@@ -0,0 +1,15 @@
+.intel_syntax noprefix
+.global case_11
+case_11:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 14
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,50 @@
+.intel_syntax noprefix
+.global case_22_stream
+case_22_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 1
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # if else
+    call ret3
+    cmp rax, 2
+    jle .Lelse0
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 2
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    jmp .Lend_if0
+.Lelse0:
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 2
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+.Lend_if0:
+    mov rax, 6
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 16
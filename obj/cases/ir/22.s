@@ -0,0 +1,24 @@
+.intel_syntax noprefix
+.global case_22
+case_22:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call ret3
+    mov rcx, rax
+    mov rsi, 2
+    cmp rcx, rsi
+    jle .LB2
+.LB1:
+    jmp .LB3
+.LB2:
+.LB3:
+    mov rcx, 6
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
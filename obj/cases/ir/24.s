@@ -0,0 +1,25 @@
+.intel_syntax noprefix
+.global case_24
+case_24:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    mov qword ptr [rbp-8], rbx
+.LB0:
+    mov rbx, 1
+    call ret3
+    mov rcx, rax
+    mov rsi, 5
+    cmp rcx, rsi
+    jle .LB2
+.LB1:
+    mov rbx, 5
+.LB2:
+    mov rax, rbx
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
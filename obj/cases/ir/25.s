@@ -0,0 +1,29 @@
+.intel_syntax noprefix
+.global case_25
+case_25:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call ret3
+    mov rcx, rax
+    mov rsi, 5
+    cmp rcx, rsi
+    jle .LB2
+.LB1:
+    mov rcx, 1
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2:
+.LB3:
+    mov rcx, 8
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,35 @@
+.intel_syntax noprefix
+.global case_32_stream
+case_32_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 5
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    mov rdi, 10
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    mov rax, 5
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 24
@@ -0,0 +1,35 @@
+.intel_syntax noprefix
+.global case_34_stream
+case_34_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 1
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 7
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    mov rax, 7
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 16
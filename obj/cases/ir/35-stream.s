@@ -0,0 +1,47 @@
+.intel_syntax noprefix
+.global case_35_stream
+case_35_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 3
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    push rax
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 8
+  # assign
+    mov qword ptr [rax], rdi
+    push rdi
+    mov rdi, 1
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    mov rax, 8
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 24
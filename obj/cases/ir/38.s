@@ -0,0 +1,34 @@
+.intel_syntax noprefix
+.global case_38
+case_38:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call ret3
+    mov rcx, rax
+    cmp rcx, 0
+    je .LB2
+.LB1:
+    mov rcx, 2
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2:
+    mov rcx, 1
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB3:
+    mov rcx, 0
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
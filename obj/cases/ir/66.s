@@ -0,0 +1,26 @@
+.intel_syntax noprefix
+.global case_66
+case_66:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 10
+    mov rsi, 0
+    cmp rcx, rsi
+    jle .LB2
+    .p2align 4
+.LB1:
+    mov rsi, -1
+    add rcx, rsi
+    mov rsi, 0
+    cmp rcx, rsi
+    jg .LB1
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,28 @@
+.intel_syntax noprefix
+.global case_71
+case_71:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call ret3
+    mov rcx, rax
+    mov rsi, 3
+    cmp rcx, rsi
+    je .LB2
+.LB1:
+    mov rcx, 1
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2:
+    mov rcx, 0
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,32 @@
+.intel_syntax noprefix
+.global case_72
+case_72:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    mov qword ptr [rbp-8], rbx
+.LB0:
+    call ret3
+    mov rbx, rax
+    call ret5
+    mov rcx, rax
+    cmp rbx, rcx
+    jge .LB2
+.LB1:
+    mov rcx, 1
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2:
+    mov rcx, 0
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
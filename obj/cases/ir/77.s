@@ -0,0 +1,27 @@
+.intel_syntax noprefix
+.global case_77
+case_77:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call ret3
+    mov rcx, rax
+    cmp rcx, 0
+    je .LB2
+.LB1:
+    mov rcx, 7
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2:
+    mov rcx, 8
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
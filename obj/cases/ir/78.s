@@ -0,0 +1,30 @@
+.intel_syntax noprefix
+.global case_78
+case_78:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call ret5
+    mov rcx, rax
+    mov rsi, 0
+    mov rdi, 0
+    cmp rcx, rdi
+    jle .LB2
+    .p2align 4
+.LB1:
+    mov rdi, -1
+    add rcx, rdi
+    mov rdi, 1
+    add rsi, rdi
+    mov rdi, 0
+    cmp rcx, rdi
+    jg .LB1
+.LB2:
+    mov rax, rsi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,31 @@
+.intel_syntax noprefix
+.global case_81
+case_81:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    mov qword ptr [rbp-8], rbx
+.LB0:
+    mov rbx, 9
+    call ret5
+    mov rcx, rax
+    mov rsi, 3
+    cmp rcx, rsi
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov rbx, 1
+    mov rsi, 1
+    add rcx, rsi
+    mov rsi, 3
+    cmp rcx, rsi
+    jl .LB1
+.LB2:
+    mov rax, rbx
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,100 @@
+.intel_syntax noprefix
+.global case_86_stream
+case_86_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 0
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    mov rdi, 0
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 5
+    jge .Lend_for0
+    .p2align 4
+.Lloop_for0:
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    imul rax, 7
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    mov rdi, 1
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 5
+    jl .Lloop_for0
+.Lend_for0:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 24
@@ -0,0 +1,30 @@
+.intel_syntax noprefix
+.global case_87
+case_87:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 1
+    mov rdi, 5
+    mov r8, rsi
+    lea r8, [r8 + r8*8]
+    mov r9, 9
+    cmp rsi, rdi
+    jg .LB2
+    .p2align 4
+.LB1:
+    add rcx, r8
+    add r8, r9
+    mov rsi, 45
+    cmp r8, rsi
+    jle .LB1
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
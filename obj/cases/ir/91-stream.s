@@ -0,0 +1,110 @@
+.intel_syntax noprefix
+.global case_91_stream
+case_91_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    push rax
+    call ret3
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    mov rdi, 0
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 24
+    mov rdi, 0
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-24]
+  # dereference rax
+    cmp rax, 6
+    jge .Lend_while0
+    .p2align 4
+.Lloop_while0:
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-24]
+  # dereference rax
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+    pop rax
+    imul rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 24
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-24]
+  # dereference rax
+    mov rdi, 1
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-24]
+  # dereference rax
+    cmp rax, 6
+    jl .Lloop_while0
+.Lend_while0:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 32
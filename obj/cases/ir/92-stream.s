@@ -0,0 +1,97 @@
+.intel_syntax noprefix
+.global case_92_stream
+case_92_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 0
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    mov rdi, 0
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 10
+    jge .Lend_while0
+    .p2align 4
+.Lloop_while0:
+  # if
+    call ret3
+    cmp rax, 2
+    jle .Lend_if1
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    mov rdi, 2
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+.Lend_if1:
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    lea rax, [rax + rax*4]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 10
+    jl .Lloop_while0
+.Lend_while0:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 24
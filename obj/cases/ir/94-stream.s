@@ -0,0 +1,146 @@
+.intel_syntax noprefix
+.global case_94_stream
+case_94_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 0
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    mov rdi, 0
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 3
+    jge .Lend_for0
+    .p2align 4
+.Lloop_for0:
+  # push address
+    mov rax, rbp
+    sub rax, 24
+    mov rdi, 0
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-24]
+  # dereference rax
+    cmp rax, 4
+    jge .Lend_for1
+    .p2align 4
+.Lloop_for1:
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    lea rax, [rax + rax*2]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-24]
+  # dereference rax
+    lea rax, [rax + rax*4]
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    call ret3
+    shl rax, 1
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 24
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-24]
+  # dereference rax
+    mov rdi, 1
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-24]
+  # dereference rax
+    cmp rax, 4
+    jl .Lloop_for1
+.Lend_for1:
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    push rax
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    mov rdi, 1
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 3
+    jl .Lloop_for0
+.Lend_for0:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 32
@@ -0,0 +1,15 @@
+.intel_syntax noprefix
+.global case_98
+case_98:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call ret3
+    mov rcx, rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
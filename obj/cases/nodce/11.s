@@ -0,0 +1,26 @@
+.intel_syntax noprefix
+.global case_11
+case_11:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 7
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    mov rax, 14
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,27 @@
+.intel_syntax noprefix
+.global case_12_stream
+case_12_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 5
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    mov rax, 11
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 16
@@ -0,0 +1,18 @@
+.intel_syntax noprefix
+.global case_19
+case_19:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rax, 4
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,42 @@
+.intel_syntax noprefix
+.global case_23
+case_23:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 1
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # if
+    call ret3
+    cmp rax, 2
+    jle .Lend_if0
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 5
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+.Lend_if0:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
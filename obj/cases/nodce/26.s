@@ -0,0 +1,46 @@
+.intel_syntax noprefix
+.global case_26
+case_26:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 1
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # if else
+    call ret3
+    cmp rax, 0
+    je .Lelse0
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 4
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    jmp .Lend_if0
+.Lelse0:
+    mov rax, 2
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if0:
+    mov rax, 4
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,18 @@
+.intel_syntax noprefix
+.global case_3
+case_3:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rax, 41
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,46 @@
+.intel_syntax noprefix
+.global case_35
+case_35:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 3
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    push rax
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 8
+  # assign
+    mov qword ptr [rax], rdi
+    push rdi
+    mov rdi, 1
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    mov rax, 8
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,42 @@
+.intel_syntax noprefix
+.global case_38
+case_38:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 2
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # if else
+    call ret3
+    cmp rax, 0
+    je .Lelse0
+    mov rax, 2
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse0:
+    mov rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if0:
+    mov rax, 5
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
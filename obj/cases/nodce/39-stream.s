@@ -0,0 +1,36 @@
+.intel_syntax noprefix
+.global case_39_stream
+case_39_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 4
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    .p2align 4
+.Lloop_while0:
+    mov rax, 4
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    jmp .Lloop_while0
+.Lend_while0:
+    mov rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 16
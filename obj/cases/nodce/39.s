@@ -0,0 +1,35 @@
+.intel_syntax noprefix
+.global case_39
+case_39:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 4
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    .p2align 4
+.Lloop_while0:
+    mov rax, 4
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    jmp .Lloop_while0
+.Lend_while0:
+    mov rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,18 @@
+.intel_syntax noprefix
+.global case_48
+case_48:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,21 @@
+.intel_syntax noprefix
+.global case_60_stream
+case_60_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rax, 3
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    mov rax, 5
+  # discard
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
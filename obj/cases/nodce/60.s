@@ -0,0 +1,20 @@
+.intel_syntax noprefix
+.global case_60
+case_60:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rax, 3
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    mov rax, 5
+  # discard
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
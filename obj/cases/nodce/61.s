@@ -0,0 +1,22 @@
+.intel_syntax noprefix
+.global case_61
+case_61:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rax, 2
+  # discard
+    mov rax, 3
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    mov rax, 5
+  # discard
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,24 @@
+.intel_syntax noprefix
+.global case_62_stream
+case_62_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rax, 10
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    mov rax, 11
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
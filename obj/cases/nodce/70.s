@@ -0,0 +1,28 @@
+.intel_syntax noprefix
+.global case_70
+case_70:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+  # if
+    call ret3
+    cmp rax, 3
+    jne .Lend_if0
+    mov rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if0:
+    mov rax, 0
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
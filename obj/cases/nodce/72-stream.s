@@ -0,0 +1,33 @@
+.intel_syntax noprefix
+.global case_72_stream
+case_72_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # if
+    call ret3
+    push rax
+    call ret5
+    mov rdi, rax
+    pop rax
+    cmp rax, rdi
+    jge .Lend_if0
+    mov rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if0:
+    mov rax, 0
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
@@ -0,0 +1,25 @@
+.intel_syntax noprefix
+.global case_10_stream
+case_10_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    push 0
+    mov rdi, 10
+    mov rax, 0
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
@@ -0,0 +1,24 @@
+.intel_syntax noprefix
+.global case_10
+case_10:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 0
+    mov rdi, 10
+    mov rax, 0
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
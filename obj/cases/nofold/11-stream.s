@@ -0,0 +1,49 @@
+.intel_syntax noprefix
+.global case_11_stream
+case_11_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 7
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    mov rdi, 7
+    mov rax, 7
+    sub rax, rdi
+    push rax
+    mov rax, 7
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    mov rax, 0
+    imul rax, 7
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    mov rdi, 0
+    mov rax, 7
+    add rax, rdi
+    mov rdi, rax
+  # /
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 16
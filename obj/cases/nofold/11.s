@@ -0,0 +1,40 @@
+.intel_syntax noprefix
+.global case_11
+case_11:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    mov rdi, 7
+    mov rax, 7
+    sub rax, rdi
+    push rax
+    mov rax, 7
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    mov rax, 0
+    imul rax, 7
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    push rax
+    mov rdi, 0
+    mov rax, 7
+    add rax, rdi
+    mov rdi, rax
+  # /
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
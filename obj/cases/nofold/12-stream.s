@@ -0,0 +1,37 @@
+.intel_syntax noprefix
+.global case_12_stream
+case_12_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 5
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    push 1
+    mov rdi, 3
+    mov rax, 5
+    add rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, 4
+    add rax, rdi
+    mov rdi, 2
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 16
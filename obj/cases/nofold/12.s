@@ -0,0 +1,28 @@
+.intel_syntax noprefix
+.global case_12
+case_12:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    push 1
+    mov rdi, 3
+    mov rax, 5
+    add rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, 4
+    add rax, rdi
+    mov rdi, 2
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,21 @@
+.intel_syntax noprefix
+.global case_13
+case_13:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+    mov rax, 5
+    lea rax, [rax + rax*2]
+    shl rax, 1
+    shl rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,46 @@
+.intel_syntax noprefix
+.global case_14_stream
+case_14_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 3
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    push 0
+    mov rdi, 3
+    mov rax, 3
+    add rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    push 0
+    mov rdi, 3
+    mov rax, 0
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    mov rdi, 12
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 16
@@ -0,0 +1,37 @@
+.intel_syntax noprefix
+.global case_14
+case_14:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    push 0
+    mov rdi, 3
+    mov rax, 3
+    add rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    push rax
+    push 0
+    mov rdi, 3
+    mov rax, 0
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    mov rdi, 12
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,41 @@
+.intel_syntax noprefix
+.global case_15_stream
+case_15_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    mov rdi, 2
+  # assign
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+    push 1
+    push 2
+    push 2
+    mov rdi, 1
+    mov rax, 0
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 16
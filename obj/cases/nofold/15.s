@@ -0,0 +1,32 @@
+.intel_syntax noprefix
+.global case_15
+case_15:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    push 1
+    push 2
+    push 2
+    mov rdi, 1
+    mov rax, 0
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,23 @@
+.intel_syntax noprefix
+.global case_16_stream
+case_16_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rdi, 1
+    mov rax, 2147483647
+    add rax, rdi
+    mov rdi, 2147483600
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
@@ -0,0 +1,22 @@
+.intel_syntax noprefix
+.global case_16
+case_16:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rdi, 1
+    mov rax, 2147483647
+    add rax, rdi
+    mov rdi, 2147483600
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
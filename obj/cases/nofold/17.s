@@ -0,0 +1,20 @@
+.intel_syntax noprefix
+.global case_17
+case_17:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rdi, 2147483392
+    mov rax, 2147483647
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
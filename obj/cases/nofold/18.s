@@ -0,0 +1,19 @@
+.intel_syntax noprefix
+.global case_18
+case_18:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    call ret3
+    mov rax, 0
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
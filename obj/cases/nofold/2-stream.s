@@ -0,0 +1,23 @@
+.intel_syntax noprefix
+.global case_2_stream
+case_2_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rdi, 20
+    mov rax, 5
+    add rax, rdi
+    mov rdi, 4
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
@@ -0,0 +1,22 @@
+.intel_syntax noprefix
+.global case_2
+case_2:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rdi, 20
+    mov rax, 5
+    add rax, rdi
+    mov rdi, 4
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
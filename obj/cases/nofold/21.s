@@ -0,0 +1,18 @@
+.intel_syntax noprefix
+.global case_21
+case_21:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+    mov rax, 7
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,26 @@
+.intel_syntax noprefix
+.global case_22
+case_22:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # if else
+    call ret3
+    cmp rax, 2
+    jle .Lelse0
+    jmp .Lend_if0
+.Lelse0:
+.Lend_if0:
+    mov rax, 2
+    lea rax, [rax + rax*2]
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,29 @@
+.intel_syntax noprefix
+.global case_25
+case_25:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # if else
+    call ret3
+    cmp rax, 5
+    jle .Lelse0
+    mov rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse0:
+.Lend_if0:
+    mov rax, 8
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,30 @@
+.intel_syntax noprefix
+.global case_26
+case_26:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # if else
+    call ret3
+    cmp rax, 0
+    je .Lelse0
+    jmp .Lend_if0
+.Lelse0:
+    mov rax, 2
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if0:
+    mov rax, 4
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,23 @@
+.intel_syntax noprefix
+.global case_3_stream
+case_3_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rdi, 34
+    mov rax, 12
+    add rax, rdi
+    mov rdi, 5
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
@@ -0,0 +1,22 @@
+.intel_syntax noprefix
+.global case_3
+case_3:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rdi, 34
+    mov rax, 12
+    add rax, rdi
+    mov rdi, 5
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
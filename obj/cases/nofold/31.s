@@ -0,0 +1,22 @@
+.intel_syntax noprefix
+.global case_31
+case_31:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+    mov rdi, 6
+    mov rax, 8
+    add rax, rdi
+    mov rdi, 4
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,18 @@
+.intel_syntax noprefix
+.global case_32
+case_32:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+    mov rax, 5
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,29 @@
+.intel_syntax noprefix
+.global case_38
+case_38:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # if else
+    call ret3
+    cmp rax, 0
+    je .Lelse0
+    mov rax, 2
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse0:
+    mov rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if0:
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
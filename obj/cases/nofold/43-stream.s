@@ -0,0 +1,24 @@
+.intel_syntax noprefix
+.global case_43_stream
+case_43_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rdi, 1
+    mov rax, 1
+  # <
+    cmp rax, rdi
+    setl al
+    movzb rax, al
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
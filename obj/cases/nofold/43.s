@@ -0,0 +1,23 @@
+.intel_syntax noprefix
+.global case_43
+case_43:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rdi, 1
+    mov rax, 1
+  # <
+    cmp rax, rdi
+    setl al
+    movzb rax, al
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,23 @@
+.intel_syntax noprefix
+.global case_45
+case_45:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rdi, 1
+    mov rax, 0
+  # <=
+    cmp rax, rdi
+    setle al
+    movzb rax, al
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
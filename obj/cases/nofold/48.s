@@ -0,0 +1,23 @@
+.intel_syntax noprefix
+.global case_48
+case_48:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rdi, 0
+    mov rax, 1
+  # >
+    cmp rdi, rax
+    setl al
+    movzb rax, al
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,22 @@
+.intel_syntax noprefix
+.global case_5_stream
+case_5_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rdi, 6
+    mov rax, 9
+    sub rax, rdi
+    lea rax, [rax + rax*4]
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
@@ -0,0 +1,21 @@
+.intel_syntax noprefix
+.global case_5
+case_5:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rdi, 6
+    mov rax, 9
+    sub rax, rdi
+    lea rax, [rax + rax*4]
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
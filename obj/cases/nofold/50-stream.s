@@ -0,0 +1,24 @@
+.intel_syntax noprefix
+.global case_50_stream
+case_50_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rdi, 2
+    mov rax, 1
+  # >
+    cmp rdi, rax
+    setl al
+    movzb rax, al
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
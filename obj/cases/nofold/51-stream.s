@@ -0,0 +1,24 @@
+.intel_syntax noprefix
+.global case_51_stream
+case_51_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rdi, 0
+    mov rax, 1
+  # >=
+    cmp rdi, rax
+    setle al
+    movzb rax, al
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
@@ -0,0 +1,20 @@
+.intel_syntax noprefix
+.global case_55
+case_55:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    mov rdi, 2
+    mov rax, 10
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,22 @@
+.intel_syntax noprefix
+.global case_56
+case_56:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+    mov rdi, 12
+    mov rax, 10
+    add rax, rdi
+    mov rdi, 2
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
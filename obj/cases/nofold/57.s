@@ -0,0 +1,22 @@
+.intel_syntax noprefix
+.global case_57
+case_57:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+    mov rdi, 3
+    mov rax, 1
+    add rax, rdi
+    mov rdi, 2
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
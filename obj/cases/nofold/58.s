@@ -0,0 +1,28 @@
+.intel_syntax noprefix
+.global case_58
+case_58:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 32
+
+    mov rax, 1
+    imul rax, 100
+    push rax
+    mov rax, 2
+    lea rax, [rax + rax*4]
+    shl rax, 1
+    mov rdi, rax
+    pop rax
+    add rax, rdi
+    mov rdi, 3
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
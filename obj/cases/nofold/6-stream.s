@@ -0,0 +1,27 @@
+.intel_syntax noprefix
+.global case_6_stream
+case_6_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rdi, 5
+    mov rax, 3
+    add rax, rdi
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 63
+    add rax, rdx
+    sar rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
@@ -0,0 +1,26 @@
+.intel_syntax noprefix
+.global case_6
+case_6:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rdi, 5
+    mov rax, 3
+    add rax, rdi
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 63
+    add rax, rdx
+    sar rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
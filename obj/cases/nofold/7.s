@@ -0,0 +1,25 @@
+.intel_syntax noprefix
+.global case_7
+case_7:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    push 0
+    mov rdi, 3
+    mov rax, 0
+    sub rax, rdi
+    lea rax, [rax + rax*4]
+    mov rdi, rax
+    pop rax
+    sub rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
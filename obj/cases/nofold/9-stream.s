@@ -0,0 +1,23 @@
+.intel_syntax noprefix
+.global case_9_stream
+case_9_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+    mov rdi, 10
+    mov rax, 0
+    sub rax, rdi
+    mov rdi, 20
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
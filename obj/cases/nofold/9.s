@@ -0,0 +1,22 @@
+.intel_syntax noprefix
+.global case_9
+case_9:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    mov rdi, 10
+    mov rax, 0
+    sub rax, rdi
+    mov rdi, 20
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
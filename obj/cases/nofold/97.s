@@ -0,0 +1,20 @@
+.intel_syntax noprefix
+.global case_97
+case_97:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+    mov rdi, 3
+    mov rax, 10
+    add rax, rdi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
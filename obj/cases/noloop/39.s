@@ -0,0 +1,31 @@
+.intel_syntax noprefix
+.global case_39
+case_39:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 1
+    cmp rcx, 0
+    je .LB3
+    .p2align 4
+.LB1:
+    mov rcx, 4
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2:
+    mov rcx, 1
+    cmp rcx, 0
+    jne .LB1
+.LB3:
+    mov rcx, 0
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,28 @@
+.intel_syntax noprefix
+.global case_69
+case_69:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 0
+    mov rdi, 3000000
+    cmp rsi, rdi
+    jge .LB2
+    .p2align 4
+.LB1:
+    shl rcx, 1
+    mov rdi, 1
+    add rsi, rdi
+    mov rdi, 3000000
+    cmp rsi, rdi
+    jl .LB1
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,41 @@
+.intel_syntax noprefix
+.global case_83
+case_83:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 0
+    mov rdi, 3
+    cmp rsi, rdi
+    jge .LB4
+    .p2align 4
+.LB1:
+    mov rdi, 0
+    mov r8, 4
+    cmp rdi, r8
+    jge .LB3
+    .p2align 4
+.LB2:
+    mov r8, 1
+    add rcx, r8
+    mov r8, 1
+    add rdi, r8
+    mov r8, 4
+    cmp rdi, r8
+    jl .LB2
+.LB3:
+    mov rdi, 1
+    add rsi, rdi
+    mov rdi, 3
+    cmp rsi, rdi
+    jl .LB1
+.LB4:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
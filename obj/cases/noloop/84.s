@@ -0,0 +1,36 @@
+.intel_syntax noprefix
+.global case_84
+case_84:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    mov qword ptr [rbp-8], rbx
+.LB0:
+    call ret3
+    mov rbx, rax
+    call ret5
+    mov rcx, rax
+    mov rsi, 0
+    mov rdi, 0
+    mov r8, 10
+    cmp rdi, r8
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov r8, rbx
+    imul r8, rcx
+    add rsi, r8
+    mov r8, 1
+    add rdi, r8
+    mov r8, 10
+    cmp rdi, r8
+    jl .LB1
+.LB2:
+    mov rax, rsi
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,30 @@
+.intel_syntax noprefix
+.global case_85
+case_85:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 0
+    mov rdi, 5
+    cmp rsi, rdi
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov rdi, rsi
+    imul rdi, 7
+    add rcx, rdi
+    mov rdi, 1
+    add rsi, rdi
+    mov rdi, 5
+    cmp rsi, rdi
+    jl .LB1
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,30 @@
+.intel_syntax noprefix
+.global case_87
+case_87:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 1
+    mov rdi, 5
+    cmp rsi, rdi
+    jg .LB2
+    .p2align 4
+.LB1:
+    mov rdi, rsi
+    lea rdi, [rdi + rdi*8]
+    add rcx, rdi
+    mov rdi, 1
+    add rsi, rdi
+    mov rdi, 5
+    cmp rsi, rdi
+    jle .LB1
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,30 @@
+.intel_syntax noprefix
+.global case_88
+case_88:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 10
+    mov rdi, 0
+    cmp rsi, rdi
+    jle .LB2
+    .p2align 4
+.LB1:
+    mov rdi, rsi
+    lea rdi, [rdi + rdi*2]
+    add rcx, rdi
+    mov rdi, -2
+    add rsi, rdi
+    mov rdi, 0
+    cmp rsi, rdi
+    jg .LB1
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,34 @@
+.intel_syntax noprefix
+.global case_89
+case_89:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 0
+    mov rdi, 4
+    cmp rsi, rdi
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov rdi, rsi
+    lea rdi, [rdi + rdi*2]
+    add rdi, rcx
+    mov r8, rsi
+    lea r8, [r8 + r8*4]
+    mov rcx, rdi
+    add rcx, r8
+    mov rdi, 1
+    add rsi, rdi
+    mov rdi, 4
+    cmp rsi, rdi
+    jl .LB1
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
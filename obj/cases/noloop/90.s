@@ -0,0 +1,33 @@
+.intel_syntax noprefix
+.global case_90
+case_90:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 0
+    mov rdi, 0
+    mov r8, 5
+    cmp rdi, r8
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov rcx, rdi
+    lea rcx, [rcx + rcx*2]
+    shl rcx, 1
+    add rsi, rcx
+    mov r8, 1
+    add rdi, r8
+    mov r8, 5
+    cmp rdi, r8
+    jl .LB1
+.LB2:
+    add rcx, rsi
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,41 @@
+.intel_syntax noprefix
+.global case_92
+case_92:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 32
+
+    mov qword ptr [rbp-8], rbx
+    mov qword ptr [rbp-16], r12
+.LB0:
+    mov rbx, 0
+    mov r12, 0
+    mov rcx, 10
+    cmp r12, rcx
+    jge .LB4
+    .p2align 4
+.LB1:
+    call ret3
+    mov rcx, rax
+    mov rsi, 2
+    cmp rcx, rsi
+    jle .LB3
+.LB2:
+    mov rcx, 2
+    add r12, rcx
+.LB3:
+    mov rcx, r12
+    lea rcx, [rcx + rcx*4]
+    add rbx, rcx
+    mov rcx, 10
+    cmp r12, rcx
+    jl .LB1
+.LB4:
+    mov rax, rbx
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov r12, qword ptr [rbp-16]
+    mov rsp, rbp
+    pop rbp
+    ret
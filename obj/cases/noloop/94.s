@@ -0,0 +1,59 @@
+.intel_syntax noprefix
+.global case_94
+case_94:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 48
+
+    mov qword ptr [rbp-8], rbx
+    mov qword ptr [rbp-16], r12
+    mov qword ptr [rbp-24], r13
+    mov qword ptr [rbp-32], r14
+.LB0:
+    mov rbx, 0
+    mov r12, 0
+    mov rcx, 3
+    cmp r12, rcx
+    jge .LB4
+    .p2align 4
+.LB1:
+    mov r13, 0
+    mov rcx, 4
+    cmp r13, rcx
+    jge .LB3
+    .p2align 4
+.LB2:
+    mov rcx, r12
+    lea rcx, [rcx + rcx*2]
+    add rcx, rbx
+    mov rsi, r13
+    lea rsi, [rsi + rsi*4]
+    mov r14, rcx
+    add r14, rsi
+    call ret3
+    mov rcx, rax
+    shl rcx, 1
+    mov rbx, r14
+    add rbx, rcx
+    mov rcx, 1
+    add r13, rcx
+    mov rcx, 4
+    cmp r13, rcx
+    jl .LB2
+.LB3:
+    mov rcx, 1
+    add r12, rcx
+    mov rcx, 3
+    cmp r12, rcx
+    jl .LB1
+.LB4:
+    mov rax, rbx
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov r12, qword ptr [rbp-16]
+    mov r13, qword ptr [rbp-24]
+    mov r14, qword ptr [rbp-32]
+    mov rsp, rbp
+    pop rbp
+    ret
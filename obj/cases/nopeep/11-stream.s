@@ -0,0 +1,32 @@
+.intel_syntax noprefix
+.global case_11_stream
+case_11_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    push rax
+    push 7
+  # assign
+    pop rdi
+    pop rax
+    mov qword ptr [rax], rdi
+    push rdi
+  # discard
+    pop rax
+    push 14
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 16
@@ -0,0 +1,19 @@
+.intel_syntax noprefix
+.global case_11
+case_11:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    push 14
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,19 @@
+.intel_syntax noprefix
+.global case_12
+case_12:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    push 11
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,23 @@
+.intel_syntax noprefix
+.global case_18
+case_18:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+    call ret3
+    push rax
+    pop rax
+    mov rax, 0
+    push rax
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
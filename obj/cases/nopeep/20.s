@@ -0,0 +1,19 @@
+.intel_syntax noprefix
+.global case_20
+case_20:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+    push 9
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,19 @@
+.intel_syntax noprefix
+.global case_21
+case_21:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+    push 7
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,29 @@
+.intel_syntax noprefix
+.global case_22
+case_22:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # if else
+    call ret3
+    push rax
+    pop rax
+    cmp rax, 2
+    jle .Lelse0
+    jmp .Lend_if0
+.Lelse0:
+    jmp .Lend_if0
+.Lend_if0:
+    push 6
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
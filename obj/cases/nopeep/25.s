@@ -0,0 +1,34 @@
+.intel_syntax noprefix
+.global case_25
+case_25:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # if else
+    call ret3
+    push rax
+    pop rax
+    cmp rax, 5
+    jle .Lelse0
+    push 1
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse0:
+    jmp .Lend_if0
+.Lend_if0:
+    push 8
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,35 @@
+.intel_syntax noprefix
+.global case_26
+case_26:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+  # if else
+    call ret3
+    push rax
+    pop rax
+    cmp rax, 0
+    je .Lelse0
+    jmp .Lend_if0
+.Lelse0:
+    push 2
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    jmp .Lend_if0
+.Lend_if0:
+    push 4
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,19 @@
+.intel_syntax noprefix
+.global case_31
+case_31:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+    push 10
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
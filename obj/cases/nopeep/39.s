@@ -0,0 +1,23 @@
+.intel_syntax noprefix
+.global case_39
+case_39:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    .p2align 4
+.Lloop_while0:
+    push 4
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+    jmp .Lloop_while0
+.Lend_while0:
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
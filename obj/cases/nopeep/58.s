@@ -0,0 +1,19 @@
+.intel_syntax noprefix
+.global case_58
+case_58:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 32
+
+    push 123
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
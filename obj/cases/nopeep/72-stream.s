@@ -0,0 +1,36 @@
+.intel_syntax noprefix
+.global case_72_stream
+case_72_stream:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, OFFSET .Lframe_size
+
+  # if
+    call ret3
+    push rax
+    call ret5
+    push rax
+    pop rdi
+    pop rax
+    cmp rax, rdi
+    jge .Lend_if0
+    push 1
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if0:
+    push 0
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
+.set .Lframe_size, 8
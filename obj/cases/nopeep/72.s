@@ -0,0 +1,35 @@
+.intel_syntax noprefix
+.global case_72
+case_72:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+  # if
+    call ret3
+    push rax
+    call ret5
+    push rax
+    pop rdi
+    pop rax
+    cmp rax, rdi
+    jge .Lend_if0
+    push 1
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if0:
+    push 0
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,35 @@
+.intel_syntax noprefix
+.global case_73
+case_73:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 8
+
+  # if
+    call ret5
+    push rax
+    call ret3
+    push rax
+    pop rdi
+    pop rax
+    cmp rax, rdi
+    jg .Lend_if0
+    push 1
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if0:
+    push 0
+    pop rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
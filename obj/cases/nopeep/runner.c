@@ -0,0 +1,65 @@
+#define _XOPEN_SOURCE 700
+
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CASE_TIMEOUT 10
+
+typedef long (*CaseFn)(void);
+
+/// Defined by the generated table; NULL if the case failed to compile
+extern CaseFn CASES[][2];
+extern const int N_CASES;
+
+static sigjmp_buf gEnv;
+
+static void on_signal(int sig) {
+    siglongjmp(gEnv, sig);
+}
+
+static long long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+int main(void) {
+    // run the handler on its own stack, in case a case overflows the stack
+    static char alt_stack[1 << 16];
+    stack_t ss = {.ss_sp = alt_stack, .ss_size = sizeof alt_stack};
+    sigaltstack(&ss, NULL);
+
+    struct sigaction sa = {.sa_handler = on_signal, .sa_flags = SA_ONSTACK | SA_NODEFER};
+    sigaction(SIGSEGV, &sa, NULL);
+    sigaction(SIGBUS, &sa, NULL);
+    sigaction(SIGFPE, &sa, NULL);
+    sigaction(SIGILL, &sa, NULL);
+    sigaction(SIGALRM, &sa, NULL);
+
+    for (int i = 0; i < N_CASES; i++) {
+        if (!CASES[i][0]) {
+            continue;
+        }
+
+        int sig = sigsetjmp(gEnv, 1);
+        if (sig) {
+            printf("%d crash %d\n", i, sig);
+            continue;
+        }
+
+        alarm(CASE_TIMEOUT);
+        long long start = now_ns();
+        long actual = CASES[i][0]();
+        long long ns = now_ns() - start;
+        long actual_stream = CASES[i][1]();
+        alarm(0);
+
+        // truncated like an exit status
+        printf("%d %ld %ld %lld\n", i, actual & 0xff, actual_stream & 0xff, ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,33 @@
+.intel_syntax noprefix
+.global case_30
+case_30:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 1
+    mov rsi, 0
+    mov rdi, 3
+    cmp rsi, rdi
+    jge .LB4
+    .p2align 4
+.LB1:
+    mov rdi, 2
+    cmp rsi, rdi
+    jne .LB3
+.LB2:
+    mov rcx, 7
+.LB3:
+    mov rdi, 1
+    add rsi, rdi
+    mov rdi, 3
+    cmp rsi, rdi
+    jl .LB1
+.LB4:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,26 @@
+.intel_syntax noprefix
+.global case_37
+case_37:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 1
+    mov rsi, 6
+    cmp rcx, rsi
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov rsi, 1
+    add rcx, rsi
+    mov rsi, 6
+    cmp rcx, rsi
+    jl .LB1
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
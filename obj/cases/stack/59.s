@@ -0,0 +1,20 @@
+.intel_syntax noprefix
+.global case_59
+case_59:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call ret3
+    mov rcx, rax
+    lea rcx, [rcx + rcx*4]
+    shl rcx, 1
+    mov rsi, 5
+    add rcx, rsi
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,32 @@
+.intel_syntax noprefix
+.global case_79
+case_79:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    mov qword ptr [rbp-8], rbx
+.LB0:
+    mov rbx, 0
+    call ret5
+    mov rcx, rax
+    mov rsi, 1
+    cmp rcx, rsi
+    je .LB2
+    .p2align 4
+.LB1:
+    mov rsi, 1
+    add rbx, rsi
+    mov rsi, -1
+    add rcx, rsi
+    mov rsi, 1
+    cmp rcx, rsi
+    jne .LB1
+.LB2:
+    mov rax, rbx
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
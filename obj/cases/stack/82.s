@@ -0,0 +1,37 @@
+.intel_syntax noprefix
+.global case_82
+case_82:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 1
+    cmp rsi, 0
+    je .LB4
+    .p2align 4
+.LB1:
+    mov rsi, 2
+    add rcx, rsi
+    mov rsi, 5
+    cmp rcx, rsi
+    jle .LB3
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB3:
+    mov rsi, 1
+    cmp rsi, 0
+    jne .LB1
+.LB4:
+    mov rcx, 0
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,30 @@
+.intel_syntax noprefix
+.global case_85
+case_85:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 0
+    mov rdi, 5
+    mov r8, rsi
+    imul r8, 7
+    mov r9, 7
+    cmp rsi, rdi
+    jge .LB2
+    .p2align 4
+.LB1:
+    add rcx, r8
+    add r8, r9
+    mov rsi, 35
+    cmp r8, rsi
+    jl .LB1
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
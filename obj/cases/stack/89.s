@@ -0,0 +1,37 @@
+.intel_syntax noprefix
+.global case_89
+case_89:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 0
+    mov rdi, 4
+    mov r8, rsi
+    lea r8, [r8 + r8*2]
+    mov r9, 3
+    mov r10, rsi
+    lea r10, [r10 + r10*4]
+    mov r11, 5
+    cmp rsi, rdi
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov rsi, rcx
+    add rsi, r8
+    mov rcx, rsi
+    add rcx, r10
+    add r8, r9
+    add r10, r11
+    mov rsi, 12
+    cmp r8, rsi
+    jl .LB1
+.LB2:
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,34 @@
+.intel_syntax noprefix
+.global case_90
+case_90:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    mov rcx, 0
+    mov rsi, 0
+    mov rdi, 0
+    mov r8, 5
+    mov r9, rdi
+    lea r9, [r9 + r9*2]
+    shl r9, 1
+    mov r10, 6
+    cmp rdi, r8
+    jge .LB2
+    .p2align 4
+.LB1:
+    mov rcx, r9
+    add rsi, r9
+    add r9, r10
+    mov rdi, 30
+    cmp r9, rdi
+    jl .LB1
+.LB2:
+    add rcx, rsi
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
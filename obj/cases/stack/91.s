@@ -0,0 +1,33 @@
+.intel_syntax noprefix
+.global case_91
+case_91:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+.LB0:
+    call ret3
+    mov rcx, rax
+    mov rsi, 0
+    mov rdi, 0
+    mov r8, 6
+    mov r9, rdi
+    imul r9, rcx
+    cmp rdi, r8
+    jge .LB2
+    .p2align 4
+.LB1:
+    add rsi, r9
+    mov r8, 1
+    add rdi, r8
+    add r9, rcx
+    mov r8, 6
+    cmp rdi, r8
+    jl .LB1
+.LB2:
+    mov rax, rsi
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
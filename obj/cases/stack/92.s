@@ -0,0 +1,47 @@
+.intel_syntax noprefix
+.global case_92
+case_92:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 48
+
+    mov qword ptr [rbp-8], rbx
+    mov qword ptr [rbp-16], r12
+    mov qword ptr [rbp-24], r13
+    mov qword ptr [rbp-32], r14
+.LB0:
+    mov rbx, 0
+    mov r12, 0
+    mov rcx, 10
+    mov r13, r12
+    lea r13, [r13 + r13*4]
+    mov r14, 10
+    cmp r12, rcx
+    jge .LB4
+    .p2align 4
+.LB1:
+    call ret3
+    mov rcx, rax
+    mov rsi, 2
+    cmp rcx, rsi
+    jle .LB3
+.LB2:
+    mov rcx, 2
+    add r12, rcx
+    add r13, r14
+.LB3:
+    add rbx, r13
+    mov rcx, 10
+    cmp r12, rcx
+    jl .LB1
+.LB4:
+    mov rax, rbx
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov r12, qword ptr [rbp-16]
+    mov r13, qword ptr [rbp-24]
+    mov r14, qword ptr [rbp-32]
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,67 @@
+.intel_syntax noprefix
+.global case_94
+case_94:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 64
+
+    mov qword ptr [rbp-24], rbx
+    mov qword ptr [rbp-32], r12
+    mov qword ptr [rbp-40], r13
+    mov qword ptr [rbp-48], r14
+    mov qword ptr [rbp-56], r15
+.LB0:
+    mov qword ptr [rbp-8], 0
+    mov rcx, 0
+    mov rsi, 3
+    mov rax, rcx
+    lea rax, [rax + rax*2]
+    mov qword ptr [rbp-16], rax
+    mov r13, 3
+    cmp rcx, rsi
+    jge .LB4
+    .p2align 4
+.LB1:
+    mov rcx, 0
+    mov rsi, 4
+    mov r14, qword ptr [rbp-16]
+    mov r15, rcx
+    lea r15, [r15 + r15*4]
+    mov rbx, 5
+    cmp rcx, rsi
+    jge .LB3
+    .p2align 4
+.LB2:
+    mov rcx, qword ptr [rbp-8]
+    add rcx, r14
+    mov r12, rcx
+    add r12, r15
+    call ret3
+    mov rcx, rax
+    shl rcx, 1
+    mov rax, r12
+    add rax, rcx
+    mov qword ptr [rbp-8], rax
+    add r15, rbx
+    mov rcx, 20
+    cmp r15, rcx
+    jl .LB2
+.LB3:
+    mov rax, qword ptr [rbp-16]
+    add rax, r13
+    mov qword ptr [rbp-16], rax
+    mov rcx, 9
+    cmp qword ptr [rbp-16], rcx
+    jl .LB1
+.LB4:
+    mov rax, qword ptr [rbp-8]
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-24]
+    mov r12, qword ptr [rbp-32]
+    mov r13, qword ptr [rbp-40]
+    mov r14, qword ptr [rbp-48]
+    mov r15, qword ptr [rbp-56]
+    mov rsp, rbp
+    pop rbp
+    ret
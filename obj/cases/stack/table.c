@@ -0,0 +1,204 @@
+typedef long (*CaseFn)(void);
+long case_0(void); long case_0_stream(void);
+long case_1(void); long case_1_stream(void);
+long case_2(void); long case_2_stream(void);
+long case_3(void); long case_3_stream(void);
+long case_4(void); long case_4_stream(void);
+long case_5(void); long case_5_stream(void);
+long case_6(void); long case_6_stream(void);
+long case_7(void); long case_7_stream(void);
+long case_8(void); long case_8_stream(void);
+long case_9(void); long case_9_stream(void);
+long case_10(void); long case_10_stream(void);
+long case_11(void); long case_11_stream(void);
+long case_12(void); long case_12_stream(void);
+long case_13(void); long case_13_stream(void);
+long case_14(void); long case_14_stream(void);
+long case_15(void); long case_15_stream(void);
+long case_16(void); long case_16_stream(void);
+long case_17(void); long case_17_stream(void);
+long case_18(void); long case_18_stream(void);
+long case_19(void); long case_19_stream(void);
+long case_20(void); long case_20_stream(void);
+long case_21(void); long case_21_stream(void);
+long case_22(void); long case_22_stream(void);
+long case_23(void); long case_23_stream(void);
+long case_24(void); long case_24_stream(void);
+long case_25(void); long case_25_stream(void);
+long case_26(void); long case_26_stream(void);
+long case_27(void); long case_27_stream(void);
+long case_28(void); long case_28_stream(void);
+long case_29(void); long case_29_stream(void);
+long case_30(void); long case_30_stream(void);
+long case_31(void); long case_31_stream(void);
+long case_32(void); long case_32_stream(void);
+long case_33(void); long case_33_stream(void);
+long case_34(void); long case_34_stream(void);
+long case_35(void); long case_35_stream(void);
+long case_36(void); long case_36_stream(void);
+long case_37(void); long case_37_stream(void);
+long case_38(void); long case_38_stream(void);
+long case_39(void); long case_39_stream(void);
+long case_40(void); long case_40_stream(void);
+long case_41(void); long case_41_stream(void);
+long case_42(void); long case_42_stream(void);
+long case_43(void); long case_43_stream(void);
+long case_44(void); long case_44_stream(void);
+long case_45(void); long case_45_stream(void);
+long case_46(void); long case_46_stream(void);
+long case_47(void); long case_47_stream(void);
+long case_48(void); long case_48_stream(void);
+long case_49(void); long case_49_stream(void);
+long case_50(void); long case_50_stream(void);
+long case_51(void); long case_51_stream(void);
+long case_52(void); long case_52_stream(void);
+long case_53(void); long case_53_stream(void);
+long case_54(void); long case_54_stream(void);
+long case_55(void); long case_55_stream(void);
+long case_56(void); long case_56_stream(void);
+long case_57(void); long case_57_stream(void);
+long case_58(void); long case_58_stream(void);
+long case_59(void); long case_59_stream(void);
+long case_60(void); long case_60_stream(void);
+long case_61(void); long case_61_stream(void);
+long case_62(void); long case_62_stream(void);
+long case_63(void); long case_63_stream(void);
+long case_64(void); long case_64_stream(void);
+long case_65(void); long case_65_stream(void);
+long case_66(void); long case_66_stream(void);
+long case_67(void); long case_67_stream(void);
+long case_68(void); long case_68_stream(void);
+long case_69(void); long case_69_stream(void);
+long case_70(void); long case_70_stream(void);
+long case_71(void); long case_71_stream(void);
+long case_72(void); long case_72_stream(void);
+long case_73(void); long case_73_stream(void);
+long case_74(void); long case_74_stream(void);
+long case_75(void); long case_75_stream(void);
+long case_76(void); long case_76_stream(void);
+long case_77(void); long case_77_stream(void);
+long case_78(void); long case_78_stream(void);
+long case_79(void); long case_79_stream(void);
+long case_80(void); long case_80_stream(void);
+long case_81(void); long case_81_stream(void);
+long case_82(void); long case_82_stream(void);
+long case_83(void); long case_83_stream(void);
+long case_84(void); long case_84_stream(void);
+long case_85(void); long case_85_stream(void);
+long case_86(void); long case_86_stream(void);
+long case_87(void); long case_87_stream(void);
+long case_88(void); long case_88_stream(void);
+long case_89(void); long case_89_stream(void);
+long case_90(void); long case_90_stream(void);
+long case_91(void); long case_91_stream(void);
+long case_92(void); long case_92_stream(void);
+long case_93(void); long case_93_stream(void);
+long case_94(void); long case_94_stream(void);
+long case_95(void); long case_95_stream(void);
+long case_96(void); long case_96_stream(void);
+long case_97(void); long case_97_stream(void);
+long case_98(void); long case_98_stream(void);
+long case_99(void); long case_99_stream(void);
+const int N_CASES = 100;
+CaseFn CASES[][2] = {
+    {case_0, case_0_stream},
+    {case_1, case_1_stream},
+    {case_2, case_2_stream},
+    {case_3, case_3_stream},
+    {case_4, case_4_stream},
+    {case_5, case_5_stream},
+    {case_6, case_6_stream},
+    {case_7, case_7_stream},
+    {case_8, case_8_stream},
+    {case_9, case_9_stream},
+    {case_10, case_10_stream},
+    {case_11, case_11_stream},
+    {case_12, case_12_stream},
+    {case_13, case_13_stream},
+    {case_14, case_14_stream},
+    {case_15, case_15_stream},
+    {case_16, case_16_stream},
+    {case_17, case_17_stream},
+    {case_18, case_18_stream},
+    {case_19, case_19_stream},
+    {case_20, case_20_stream},
+    {case_21, case_21_stream},
+    {case_22, case_22_stream},
+    {case_23, case_23_stream},
+    {case_24, case_24_stream},
+    {case_25, case_25_stream},
+    {case_26, case_26_stream},
+    {case_27, case_27_stream},
+    {case_28, case_28_stream},
+    {case_29, case_29_stream},
+    {case_30, case_30_stream},
+    {case_31, case_31_stream},
+    {case_32, case_32_stream},
+    {case_33, case_33_stream},
+    {case_34, case_34_stream},
+    {case_35, case_35_stream},
+    {case_36, case_36_stream},
+    {case_37, case_37_stream},
+    {case_38, case_38_stream},
+    {case_39, case_39_stream},
+    {case_40, case_40_stream},
+    {case_41, case_41_stream},
+    {case_42, case_42_stream},
+    {case_43, case_43_stream},
+    {case_44, case_44_stream},
+    {case_45, case_45_stream},
+    {case_46, case_46_stream},
+    {case_47, case_47_stream},
+    {case_48, case_48_stream},
+    {case_49, case_49_stream},
+    {case_50, case_50_stream},
+    {case_51, case_51_stream},
+    {case_52, case_52_stream},
+    {case_53, case_53_stream},
+    {case_54, case_54_stream},
+    {case_55, case_55_stream},
+    {case_56, case_56_stream},
+    {case_57, case_57_stream},
+    {case_58, case_58_stream},
+    {case_59, case_59_stream},
+    {case_60, case_60_stream},
+    {case_61, case_61_stream},
+    {case_62, case_62_stream},
+    {case_63, case_63_stream},
+    {case_64, case_64_stream},
+    {case_65, case_65_stream},
+    {case_66, case_66_stream},
+    {case_67, case_67_stream},
+    {case_68, case_68_stream},
+    {case_69, case_69_stream},
+    {case_70, case_70_stream},
+    {case_71, case_71_stream},
+    {case_72, case_72_stream},
+    {case_73, case_73_stream},
+    {case_74, case_74_stream},
+    {case_75, case_75_stream},
+    {case_76, case_76_stream},
+    {case_77, case_77_stream},
+    {case_78, case_78_stream},
+    {case_79, case_79_stream},
+    {case_80, case_80_stream},
+    {case_81, case_81_stream},
+    {case_82, case_82_stream},
+    {case_83, case_83_stream},
+    {case_84, case_84_stream},
+    {case_85, case_85_stream},
+    {case_86, case_86_stream},
+    {case_87, case_87_stream},
+    {case_88, case_88_stream},
+    {case_89, case_89_stream},
+    {case_90, case_90_stream},
+    {case_91, case_91_stream},
+    {case_92, case_92_stream},
+    {case_93, case_93_stream},
+    {case_94, case_94_stream},
+    {case_95, case_95_stream},
+    {case_96, case_96_stream},
+    {case_97, case_97_stream},
+    {case_98, case_98_stream},
+    {case_99, case_99_stream},
+};
@@ -0,0 +1,97 @@
+typedef long (*CaseFn)(void);
+long case_0(void); long case_0_stream(void);
+long case_1(void); long case_1_stream(void);
+long case_2(void); long case_2_stream(void);
+long case_3(void); long case_3_stream(void);
+long case_4(void); long case_4_stream(void);
+long case_5(void); long case_5_stream(void);
+long case_6(void); long case_6_stream(void);
+long case_7(void); long case_7_stream(void);
+long case_8(void); long case_8_stream(void);
+long case_9(void); long case_9_stream(void);
+long case_10(void); long case_10_stream(void);
+long case_11(void); long case_11_stream(void);
+long case_12(void); long case_12_stream(void);
+long case_13(void); long case_13_stream(void);
+long case_14(void); long case_14_stream(void);
+long case_15(void); long case_15_stream(void);
+long case_16(void); long case_16_stream(void);
+long case_17(void); long case_17_stream(void);
+long case_18(void); long case_18_stream(void);
+long case_19(void); long case_19_stream(void);
+long case_20(void); long case_20_stream(void);
+long case_21(void); long case_21_stream(void);
+long case_22(void); long case_22_stream(void);
+long case_23(void); long case_23_stream(void);
+long case_24(void); long case_24_stream(void);
+long case_25(void); long case_25_stream(void);
+long case_26(void); long case_26_stream(void);
+long case_27(void); long case_27_stream(void);
+long case_28(void); long case_28_stream(void);
+long case_29(void); long case_29_stream(void);
+long case_30(void); long case_30_stream(void);
+long case_31(void); long case_31_stream(void);
+long case_32(void); long case_32_stream(void);
+long case_33(void); long case_33_stream(void);
+long case_34(void); long case_34_stream(void);
+long case_35(void); long case_35_stream(void);
+long case_36(void); long case_36_stream(void);
+long case_37(void); long case_37_stream(void);
+long case_38(void); long case_38_stream(void);
+long case_39(void); long case_39_stream(void);
+long case_40(void); long case_40_stream(void);
+long case_41(void); long case_41_stream(void);
+long case_42(void); long case_42_stream(void);
+long case_44(void); long case_44_stream(void);
+long case_45(void); long case_45_stream(void);
+long case_46(void); long case_46_stream(void);
+const int N_CASES = 47;
+CaseFn CASES[][2] = {
+    {case_0, case_0_stream},
+    {case_1, case_1_stream},
+    {case_2, case_2_stream},
+    {case_3, case_3_stream},
+    {case_4, case_4_stream},
+    {case_5, case_5_stream},
+    {case_6, case_6_stream},
+    {case_7, case_7_stream},
+    {case_8, case_8_stream},
+    {case_9, case_9_stream},
+    {case_10, case_10_stream},
+    {case_11, case_11_stream},
+    {case_12, case_12_stream},
+    {case_13, case_13_stream},
+    {case_14, case_14_stream},
+    {case_15, case_15_stream},
+    {case_16, case_16_stream},
+    {case_17, case_17_stream},
+    {case_18, case_18_stream},
+    {case_19, case_19_stream},
+    {case_20, case_20_stream},
+    {case_21, case_21_stream},
+    {case_22, case_22_stream},
+    {case_23, case_23_stream},
+    {case_24, case_24_stream},
+    {case_25, case_25_stream},
+    {case_26, case_26_stream},
+    {case_27, case_27_stream},
+    {case_28, case_28_stream},
+    {case_29, case_29_stream},
+    {case_30, case_30_stream},
+    {case_31, case_31_stream},
+    {case_32, case_32_stream},
+    {case_33, case_33_stream},
+    {case_34, case_34_stream},
+    {case_35, case_35_stream},
+    {case_36, case_36_stream},
+    {case_37, case_37_stream},
+    {case_38, case_38_stream},
+    {case_39, case_39_stream},
+    {case_40, case_40_stream},
+    {case_41, case_41_stream},
+    {case_42, case_42_stream},
+    {0, 0},
+    {case_44, case_44_stream},
+    {case_45, case_45_stream},
+    {case_46, case_46_stream},
+};
@@ -0,0 +1 @@
+a = 2; return a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a + a - a;
\ No newline at end of file
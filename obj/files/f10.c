@@ -0,0 +1,3 @@
+a = 10;
+b = 2;
+return a * b;
@@ -0,0 +1,3 @@
+a = 11;
+b = 2;
+return a * b;
@@ -0,0 +1,3 @@
+a = 12;
+b = 2;
+return a * b;
@@ -0,0 +1,3 @@
+a = 13;
+b = 2;
+return a * b;
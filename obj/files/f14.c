@@ -0,0 +1,3 @@
+a = 14;
+b = 2;
+return a * b;
@@ -0,0 +1,3 @@
+a = 15;
+b = 2;
+return a * b;
@@ -0,0 +1,3 @@
+a = 16;
+b = 2;
+return a * b;
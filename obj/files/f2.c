@@ -0,0 +1,3 @@
+a = 2;
+b = 2;
+return a * b;
@@ -0,0 +1,3 @@
+a = 3;
+b = 2;
+return a * b;
@@ -0,0 +1,3 @@
+a = 4;
+b = 2;
+return a * b;
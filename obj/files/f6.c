@@ -0,0 +1,3 @@
+a = 6;
+b = 2;
+return a * b;
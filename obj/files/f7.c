@@ -0,0 +1,3 @@
+a = 7;
+b = 2;
+return a * b;
@@ -0,0 +1,3 @@
+a = 8;
+b = 2;
+return a * b;
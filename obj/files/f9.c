@@ -0,0 +1,3 @@
+a = 9;
+b = 2;
+return a * b;
@@ -0,0 +1,2 @@
+a = 4;
+return a * 2;
@@ -0,0 +1,2 @@
+a = 5;
+return a * 3;
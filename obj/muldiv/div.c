@@ -0,0 +1,2954 @@
+x = arg(); w = which();
+if (w < 369) {
+if (w < 184) {
+if (w < 92) {
+if (w < 46) {
+if (w < 23) {
+if (w < 11) {
+if (w < 5) {
+if (w < 2) {
+if (w < 1) {
+return x / -300;
+} else {
+return x / -299;
+}
+} else {
+if (w < 3) {
+return x / -298;
+} else {
+if (w < 4) {
+return x / -297;
+} else {
+return x / -296;
+}
+}
+}
+} else {
+if (w < 8) {
+if (w < 6) {
+return x / -295;
+} else {
+if (w < 7) {
+return x / -294;
+} else {
+return x / -293;
+}
+}
+} else {
+if (w < 9) {
+return x / -292;
+} else {
+if (w < 10) {
+return x / -291;
+} else {
+return x / -290;
+}
+}
+}
+}
+} else {
+if (w < 17) {
+if (w < 14) {
+if (w < 12) {
+return x / -289;
+} else {
+if (w < 13) {
+return x / -288;
+} else {
+return x / -287;
+}
+}
+} else {
+if (w < 15) {
+return x / -286;
+} else {
+if (w < 16) {
+return x / -285;
+} else {
+return x / -284;
+}
+}
+}
+} else {
+if (w < 20) {
+if (w < 18) {
+return x / -283;
+} else {
+if (w < 19) {
+return x / -282;
+} else {
+return x / -281;
+}
+}
+} else {
+if (w < 21) {
+return x / -280;
+} else {
+if (w < 22) {
+return x / -279;
+} else {
+return x / -278;
+}
+}
+}
+}
+}
+} else {
+if (w < 34) {
+if (w < 28) {
+if (w < 25) {
+if (w < 24) {
+return x / -277;
+} else {
+return x / -276;
+}
+} else {
+if (w < 26) {
+return x / -275;
+} else {
+if (w < 27) {
+return x / -274;
+} else {
+return x / -273;
+}
+}
+}
+} else {
+if (w < 31) {
+if (w < 29) {
+return x / -272;
+} else {
+if (w < 30) {
+return x / -271;
+} else {
+return x / -270;
+}
+}
+} else {
+if (w < 32) {
+return x / -269;
+} else {
+if (w < 33) {
+return x / -268;
+} else {
+return x / -267;
+}
+}
+}
+}
+} else {
+if (w < 40) {
+if (w < 37) {
+if (w < 35) {
+return x / -266;
+} else {
+if (w < 36) {
+return x / -265;
+} else {
+return x / -264;
+}
+}
+} else {
+if (w < 38) {
+return x / -263;
+} else {
+if (w < 39) {
+return x / -262;
+} else {
+return x / -261;
+}
+}
+}
+} else {
+if (w < 43) {
+if (w < 41) {
+return x / -260;
+} else {
+if (w < 42) {
+return x / -259;
+} else {
+return x / -258;
+}
+}
+} else {
+if (w < 44) {
+return x / -257;
+} else {
+if (w < 45) {
+return x / -256;
+} else {
+return x / -255;
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 69) {
+if (w < 57) {
+if (w < 51) {
+if (w < 48) {
+if (w < 47) {
+return x / -254;
+} else {
+return x / -253;
+}
+} else {
+if (w < 49) {
+return x / -252;
+} else {
+if (w < 50) {
+return x / -251;
+} else {
+return x / -250;
+}
+}
+}
+} else {
+if (w < 54) {
+if (w < 52) {
+return x / -249;
+} else {
+if (w < 53) {
+return x / -248;
+} else {
+return x / -247;
+}
+}
+} else {
+if (w < 55) {
+return x / -246;
+} else {
+if (w < 56) {
+return x / -245;
+} else {
+return x / -244;
+}
+}
+}
+}
+} else {
+if (w < 63) {
+if (w < 60) {
+if (w < 58) {
+return x / -243;
+} else {
+if (w < 59) {
+return x / -242;
+} else {
+return x / -241;
+}
+}
+} else {
+if (w < 61) {
+return x / -240;
+} else {
+if (w < 62) {
+return x / -239;
+} else {
+return x / -238;
+}
+}
+}
+} else {
+if (w < 66) {
+if (w < 64) {
+return x / -237;
+} else {
+if (w < 65) {
+return x / -236;
+} else {
+return x / -235;
+}
+}
+} else {
+if (w < 67) {
+return x / -234;
+} else {
+if (w < 68) {
+return x / -233;
+} else {
+return x / -232;
+}
+}
+}
+}
+}
+} else {
+if (w < 80) {
+if (w < 74) {
+if (w < 71) {
+if (w < 70) {
+return x / -231;
+} else {
+return x / -230;
+}
+} else {
+if (w < 72) {
+return x / -229;
+} else {
+if (w < 73) {
+return x / -228;
+} else {
+return x / -227;
+}
+}
+}
+} else {
+if (w < 77) {
+if (w < 75) {
+return x / -226;
+} else {
+if (w < 76) {
+return x / -225;
+} else {
+return x / -224;
+}
+}
+} else {
+if (w < 78) {
+return x / -223;
+} else {
+if (w < 79) {
+return x / -222;
+} else {
+return x / -221;
+}
+}
+}
+}
+} else {
+if (w < 86) {
+if (w < 83) {
+if (w < 81) {
+return x / -220;
+} else {
+if (w < 82) {
+return x / -219;
+} else {
+return x / -218;
+}
+}
+} else {
+if (w < 84) {
+return x / -217;
+} else {
+if (w < 85) {
+return x / -216;
+} else {
+return x / -215;
+}
+}
+}
+} else {
+if (w < 89) {
+if (w < 87) {
+return x / -214;
+} else {
+if (w < 88) {
+return x / -213;
+} else {
+return x / -212;
+}
+}
+} else {
+if (w < 90) {
+return x / -211;
+} else {
+if (w < 91) {
+return x / -210;
+} else {
+return x / -209;
+}
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 138) {
+if (w < 115) {
+if (w < 103) {
+if (w < 97) {
+if (w < 94) {
+if (w < 93) {
+return x / -208;
+} else {
+return x / -207;
+}
+} else {
+if (w < 95) {
+return x / -206;
+} else {
+if (w < 96) {
+return x / -205;
+} else {
+return x / -204;
+}
+}
+}
+} else {
+if (w < 100) {
+if (w < 98) {
+return x / -203;
+} else {
+if (w < 99) {
+return x / -202;
+} else {
+return x / -201;
+}
+}
+} else {
+if (w < 101) {
+return x / -200;
+} else {
+if (w < 102) {
+return x / -199;
+} else {
+return x / -198;
+}
+}
+}
+}
+} else {
+if (w < 109) {
+if (w < 106) {
+if (w < 104) {
+return x / -197;
+} else {
+if (w < 105) {
+return x / -196;
+} else {
+return x / -195;
+}
+}
+} else {
+if (w < 107) {
+return x / -194;
+} else {
+if (w < 108) {
+return x / -193;
+} else {
+return x / -192;
+}
+}
+}
+} else {
+if (w < 112) {
+if (w < 110) {
+return x / -191;
+} else {
+if (w < 111) {
+return x / -190;
+} else {
+return x / -189;
+}
+}
+} else {
+if (w < 113) {
+return x / -188;
+} else {
+if (w < 114) {
+return x / -187;
+} else {
+return x / -186;
+}
+}
+}
+}
+}
+} else {
+if (w < 126) {
+if (w < 120) {
+if (w < 117) {
+if (w < 116) {
+return x / -185;
+} else {
+return x / -184;
+}
+} else {
+if (w < 118) {
+return x / -183;
+} else {
+if (w < 119) {
+return x / -182;
+} else {
+return x / -181;
+}
+}
+}
+} else {
+if (w < 123) {
+if (w < 121) {
+return x / -180;
+} else {
+if (w < 122) {
+return x / -179;
+} else {
+return x / -178;
+}
+}
+} else {
+if (w < 124) {
+return x / -177;
+} else {
+if (w < 125) {
+return x / -176;
+} else {
+return x / -175;
+}
+}
+}
+}
+} else {
+if (w < 132) {
+if (w < 129) {
+if (w < 127) {
+return x / -174;
+} else {
+if (w < 128) {
+return x / -173;
+} else {
+return x / -172;
+}
+}
+} else {
+if (w < 130) {
+return x / -171;
+} else {
+if (w < 131) {
+return x / -170;
+} else {
+return x / -169;
+}
+}
+}
+} else {
+if (w < 135) {
+if (w < 133) {
+return x / -168;
+} else {
+if (w < 134) {
+return x / -167;
+} else {
+return x / -166;
+}
+}
+} else {
+if (w < 136) {
+return x / -165;
+} else {
+if (w < 137) {
+return x / -164;
+} else {
+return x / -163;
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 161) {
+if (w < 149) {
+if (w < 143) {
+if (w < 140) {
+if (w < 139) {
+return x / -162;
+} else {
+return x / -161;
+}
+} else {
+if (w < 141) {
+return x / -160;
+} else {
+if (w < 142) {
+return x / -159;
+} else {
+return x / -158;
+}
+}
+}
+} else {
+if (w < 146) {
+if (w < 144) {
+return x / -157;
+} else {
+if (w < 145) {
+return x / -156;
+} else {
+return x / -155;
+}
+}
+} else {
+if (w < 147) {
+return x / -154;
+} else {
+if (w < 148) {
+return x / -153;
+} else {
+return x / -152;
+}
+}
+}
+}
+} else {
+if (w < 155) {
+if (w < 152) {
+if (w < 150) {
+return x / -151;
+} else {
+if (w < 151) {
+return x / -150;
+} else {
+return x / -149;
+}
+}
+} else {
+if (w < 153) {
+return x / -148;
+} else {
+if (w < 154) {
+return x / -147;
+} else {
+return x / -146;
+}
+}
+}
+} else {
+if (w < 158) {
+if (w < 156) {
+return x / -145;
+} else {
+if (w < 157) {
+return x / -144;
+} else {
+return x / -143;
+}
+}
+} else {
+if (w < 159) {
+return x / -142;
+} else {
+if (w < 160) {
+return x / -141;
+} else {
+return x / -140;
+}
+}
+}
+}
+}
+} else {
+if (w < 172) {
+if (w < 166) {
+if (w < 163) {
+if (w < 162) {
+return x / -139;
+} else {
+return x / -138;
+}
+} else {
+if (w < 164) {
+return x / -137;
+} else {
+if (w < 165) {
+return x / -136;
+} else {
+return x / -135;
+}
+}
+}
+} else {
+if (w < 169) {
+if (w < 167) {
+return x / -134;
+} else {
+if (w < 168) {
+return x / -133;
+} else {
+return x / -132;
+}
+}
+} else {
+if (w < 170) {
+return x / -131;
+} else {
+if (w < 171) {
+return x / -130;
+} else {
+return x / -129;
+}
+}
+}
+}
+} else {
+if (w < 178) {
+if (w < 175) {
+if (w < 173) {
+return x / -128;
+} else {
+if (w < 174) {
+return x / -127;
+} else {
+return x / -126;
+}
+}
+} else {
+if (w < 176) {
+return x / -125;
+} else {
+if (w < 177) {
+return x / -124;
+} else {
+return x / -123;
+}
+}
+}
+} else {
+if (w < 181) {
+if (w < 179) {
+return x / -122;
+} else {
+if (w < 180) {
+return x / -121;
+} else {
+return x / -120;
+}
+}
+} else {
+if (w < 182) {
+return x / -119;
+} else {
+if (w < 183) {
+return x / -118;
+} else {
+return x / -117;
+}
+}
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 276) {
+if (w < 230) {
+if (w < 207) {
+if (w < 195) {
+if (w < 189) {
+if (w < 186) {
+if (w < 185) {
+return x / -116;
+} else {
+return x / -115;
+}
+} else {
+if (w < 187) {
+return x / -114;
+} else {
+if (w < 188) {
+return x / -113;
+} else {
+return x / -112;
+}
+}
+}
+} else {
+if (w < 192) {
+if (w < 190) {
+return x / -111;
+} else {
+if (w < 191) {
+return x / -110;
+} else {
+return x / -109;
+}
+}
+} else {
+if (w < 193) {
+return x / -108;
+} else {
+if (w < 194) {
+return x / -107;
+} else {
+return x / -106;
+}
+}
+}
+}
+} else {
+if (w < 201) {
+if (w < 198) {
+if (w < 196) {
+return x / -105;
+} else {
+if (w < 197) {
+return x / -104;
+} else {
+return x / -103;
+}
+}
+} else {
+if (w < 199) {
+return x / -102;
+} else {
+if (w < 200) {
+return x / -101;
+} else {
+return x / -100;
+}
+}
+}
+} else {
+if (w < 204) {
+if (w < 202) {
+return x / -99;
+} else {
+if (w < 203) {
+return x / -98;
+} else {
+return x / -97;
+}
+}
+} else {
+if (w < 205) {
+return x / -96;
+} else {
+if (w < 206) {
+return x / -95;
+} else {
+return x / -94;
+}
+}
+}
+}
+}
+} else {
+if (w < 218) {
+if (w < 212) {
+if (w < 209) {
+if (w < 208) {
+return x / -93;
+} else {
+return x / -92;
+}
+} else {
+if (w < 210) {
+return x / -91;
+} else {
+if (w < 211) {
+return x / -90;
+} else {
+return x / -89;
+}
+}
+}
+} else {
+if (w < 215) {
+if (w < 213) {
+return x / -88;
+} else {
+if (w < 214) {
+return x / -87;
+} else {
+return x / -86;
+}
+}
+} else {
+if (w < 216) {
+return x / -85;
+} else {
+if (w < 217) {
+return x / -84;
+} else {
+return x / -83;
+}
+}
+}
+}
+} else {
+if (w < 224) {
+if (w < 221) {
+if (w < 219) {
+return x / -82;
+} else {
+if (w < 220) {
+return x / -81;
+} else {
+return x / -80;
+}
+}
+} else {
+if (w < 222) {
+return x / -79;
+} else {
+if (w < 223) {
+return x / -78;
+} else {
+return x / -77;
+}
+}
+}
+} else {
+if (w < 227) {
+if (w < 225) {
+return x / -76;
+} else {
+if (w < 226) {
+return x / -75;
+} else {
+return x / -74;
+}
+}
+} else {
+if (w < 228) {
+return x / -73;
+} else {
+if (w < 229) {
+return x / -72;
+} else {
+return x / -71;
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 253) {
+if (w < 241) {
+if (w < 235) {
+if (w < 232) {
+if (w < 231) {
+return x / -70;
+} else {
+return x / -69;
+}
+} else {
+if (w < 233) {
+return x / -68;
+} else {
+if (w < 234) {
+return x / -67;
+} else {
+return x / -66;
+}
+}
+}
+} else {
+if (w < 238) {
+if (w < 236) {
+return x / -65;
+} else {
+if (w < 237) {
+return x / -64;
+} else {
+return x / -63;
+}
+}
+} else {
+if (w < 239) {
+return x / -62;
+} else {
+if (w < 240) {
+return x / -61;
+} else {
+return x / -60;
+}
+}
+}
+}
+} else {
+if (w < 247) {
+if (w < 244) {
+if (w < 242) {
+return x / -59;
+} else {
+if (w < 243) {
+return x / -58;
+} else {
+return x / -57;
+}
+}
+} else {
+if (w < 245) {
+return x / -56;
+} else {
+if (w < 246) {
+return x / -55;
+} else {
+return x / -54;
+}
+}
+}
+} else {
+if (w < 250) {
+if (w < 248) {
+return x / -53;
+} else {
+if (w < 249) {
+return x / -52;
+} else {
+return x / -51;
+}
+}
+} else {
+if (w < 251) {
+return x / -50;
+} else {
+if (w < 252) {
+return x / -49;
+} else {
+return x / -48;
+}
+}
+}
+}
+}
+} else {
+if (w < 264) {
+if (w < 258) {
+if (w < 255) {
+if (w < 254) {
+return x / -47;
+} else {
+return x / -46;
+}
+} else {
+if (w < 256) {
+return x / -45;
+} else {
+if (w < 257) {
+return x / -44;
+} else {
+return x / -43;
+}
+}
+}
+} else {
+if (w < 261) {
+if (w < 259) {
+return x / -42;
+} else {
+if (w < 260) {
+return x / -41;
+} else {
+return x / -40;
+}
+}
+} else {
+if (w < 262) {
+return x / -39;
+} else {
+if (w < 263) {
+return x / -38;
+} else {
+return x / -37;
+}
+}
+}
+}
+} else {
+if (w < 270) {
+if (w < 267) {
+if (w < 265) {
+return x / -36;
+} else {
+if (w < 266) {
+return x / -35;
+} else {
+return x / -34;
+}
+}
+} else {
+if (w < 268) {
+return x / -33;
+} else {
+if (w < 269) {
+return x / -32;
+} else {
+return x / -31;
+}
+}
+}
+} else {
+if (w < 273) {
+if (w < 271) {
+return x / -30;
+} else {
+if (w < 272) {
+return x / -29;
+} else {
+return x / -28;
+}
+}
+} else {
+if (w < 274) {
+return x / -27;
+} else {
+if (w < 275) {
+return x / -26;
+} else {
+return x / -25;
+}
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 322) {
+if (w < 299) {
+if (w < 287) {
+if (w < 281) {
+if (w < 278) {
+if (w < 277) {
+return x / -24;
+} else {
+return x / -23;
+}
+} else {
+if (w < 279) {
+return x / -22;
+} else {
+if (w < 280) {
+return x / -21;
+} else {
+return x / -20;
+}
+}
+}
+} else {
+if (w < 284) {
+if (w < 282) {
+return x / -19;
+} else {
+if (w < 283) {
+return x / -18;
+} else {
+return x / -17;
+}
+}
+} else {
+if (w < 285) {
+return x / -16;
+} else {
+if (w < 286) {
+return x / -15;
+} else {
+return x / -14;
+}
+}
+}
+}
+} else {
+if (w < 293) {
+if (w < 290) {
+if (w < 288) {
+return x / -13;
+} else {
+if (w < 289) {
+return x / -12;
+} else {
+return x / -11;
+}
+}
+} else {
+if (w < 291) {
+return x / -10;
+} else {
+if (w < 292) {
+return x / -9;
+} else {
+return x / -8;
+}
+}
+}
+} else {
+if (w < 296) {
+if (w < 294) {
+return x / -7;
+} else {
+if (w < 295) {
+return x / -6;
+} else {
+return x / -5;
+}
+}
+} else {
+if (w < 297) {
+return x / -4;
+} else {
+if (w < 298) {
+return x / -3;
+} else {
+return x / -2;
+}
+}
+}
+}
+}
+} else {
+if (w < 310) {
+if (w < 304) {
+if (w < 301) {
+if (w < 300) {
+return x / -1;
+} else {
+return 0;
+}
+} else {
+if (w < 302) {
+return x / 1;
+} else {
+if (w < 303) {
+return x / 2;
+} else {
+return x / 3;
+}
+}
+}
+} else {
+if (w < 307) {
+if (w < 305) {
+return x / 4;
+} else {
+if (w < 306) {
+return x / 5;
+} else {
+return x / 6;
+}
+}
+} else {
+if (w < 308) {
+return x / 7;
+} else {
+if (w < 309) {
+return x / 8;
+} else {
+return x / 9;
+}
+}
+}
+}
+} else {
+if (w < 316) {
+if (w < 313) {
+if (w < 311) {
+return x / 10;
+} else {
+if (w < 312) {
+return x / 11;
+} else {
+return x / 12;
+}
+}
+} else {
+if (w < 314) {
+return x / 13;
+} else {
+if (w < 315) {
+return x / 14;
+} else {
+return x / 15;
+}
+}
+}
+} else {
+if (w < 319) {
+if (w < 317) {
+return x / 16;
+} else {
+if (w < 318) {
+return x / 17;
+} else {
+return x / 18;
+}
+}
+} else {
+if (w < 320) {
+return x / 19;
+} else {
+if (w < 321) {
+return x / 20;
+} else {
+return x / 21;
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 345) {
+if (w < 333) {
+if (w < 327) {
+if (w < 324) {
+if (w < 323) {
+return x / 22;
+} else {
+return x / 23;
+}
+} else {
+if (w < 325) {
+return x / 24;
+} else {
+if (w < 326) {
+return x / 25;
+} else {
+return x / 26;
+}
+}
+}
+} else {
+if (w < 330) {
+if (w < 328) {
+return x / 27;
+} else {
+if (w < 329) {
+return x / 28;
+} else {
+return x / 29;
+}
+}
+} else {
+if (w < 331) {
+return x / 30;
+} else {
+if (w < 332) {
+return x / 31;
+} else {
+return x / 32;
+}
+}
+}
+}
+} else {
+if (w < 339) {
+if (w < 336) {
+if (w < 334) {
+return x / 33;
+} else {
+if (w < 335) {
+return x / 34;
+} else {
+return x / 35;
+}
+}
+} else {
+if (w < 337) {
+return x / 36;
+} else {
+if (w < 338) {
+return x / 37;
+} else {
+return x / 38;
+}
+}
+}
+} else {
+if (w < 342) {
+if (w < 340) {
+return x / 39;
+} else {
+if (w < 341) {
+return x / 40;
+} else {
+return x / 41;
+}
+}
+} else {
+if (w < 343) {
+return x / 42;
+} else {
+if (w < 344) {
+return x / 43;
+} else {
+return x / 44;
+}
+}
+}
+}
+}
+} else {
+if (w < 357) {
+if (w < 351) {
+if (w < 348) {
+if (w < 346) {
+return x / 45;
+} else {
+if (w < 347) {
+return x / 46;
+} else {
+return x / 47;
+}
+}
+} else {
+if (w < 349) {
+return x / 48;
+} else {
+if (w < 350) {
+return x / 49;
+} else {
+return x / 50;
+}
+}
+}
+} else {
+if (w < 354) {
+if (w < 352) {
+return x / 51;
+} else {
+if (w < 353) {
+return x / 52;
+} else {
+return x / 53;
+}
+}
+} else {
+if (w < 355) {
+return x / 54;
+} else {
+if (w < 356) {
+return x / 55;
+} else {
+return x / 56;
+}
+}
+}
+}
+} else {
+if (w < 363) {
+if (w < 360) {
+if (w < 358) {
+return x / 57;
+} else {
+if (w < 359) {
+return x / 58;
+} else {
+return x / 59;
+}
+}
+} else {
+if (w < 361) {
+return x / 60;
+} else {
+if (w < 362) {
+return x / 61;
+} else {
+return x / 62;
+}
+}
+}
+} else {
+if (w < 366) {
+if (w < 364) {
+return x / 63;
+} else {
+if (w < 365) {
+return x / 64;
+} else {
+return x / 65;
+}
+}
+} else {
+if (w < 367) {
+return x / 66;
+} else {
+if (w < 368) {
+return x / 67;
+} else {
+return x / 68;
+}
+}
+}
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 554) {
+if (w < 461) {
+if (w < 415) {
+if (w < 392) {
+if (w < 380) {
+if (w < 374) {
+if (w < 371) {
+if (w < 370) {
+return x / 69;
+} else {
+return x / 70;
+}
+} else {
+if (w < 372) {
+return x / 71;
+} else {
+if (w < 373) {
+return x / 72;
+} else {
+return x / 73;
+}
+}
+}
+} else {
+if (w < 377) {
+if (w < 375) {
+return x / 74;
+} else {
+if (w < 376) {
+return x / 75;
+} else {
+return x / 76;
+}
+}
+} else {
+if (w < 378) {
+return x / 77;
+} else {
+if (w < 379) {
+return x / 78;
+} else {
+return x / 79;
+}
+}
+}
+}
+} else {
+if (w < 386) {
+if (w < 383) {
+if (w < 381) {
+return x / 80;
+} else {
+if (w < 382) {
+return x / 81;
+} else {
+return x / 82;
+}
+}
+} else {
+if (w < 384) {
+return x / 83;
+} else {
+if (w < 385) {
+return x / 84;
+} else {
+return x / 85;
+}
+}
+}
+} else {
+if (w < 389) {
+if (w < 387) {
+return x / 86;
+} else {
+if (w < 388) {
+return x / 87;
+} else {
+return x / 88;
+}
+}
+} else {
+if (w < 390) {
+return x / 89;
+} else {
+if (w < 391) {
+return x / 90;
+} else {
+return x / 91;
+}
+}
+}
+}
+}
+} else {
+if (w < 403) {
+if (w < 397) {
+if (w < 394) {
+if (w < 393) {
+return x / 92;
+} else {
+return x / 93;
+}
+} else {
+if (w < 395) {
+return x / 94;
+} else {
+if (w < 396) {
+return x / 95;
+} else {
+return x / 96;
+}
+}
+}
+} else {
+if (w < 400) {
+if (w < 398) {
+return x / 97;
+} else {
+if (w < 399) {
+return x / 98;
+} else {
+return x / 99;
+}
+}
+} else {
+if (w < 401) {
+return x / 100;
+} else {
+if (w < 402) {
+return x / 101;
+} else {
+return x / 102;
+}
+}
+}
+}
+} else {
+if (w < 409) {
+if (w < 406) {
+if (w < 404) {
+return x / 103;
+} else {
+if (w < 405) {
+return x / 104;
+} else {
+return x / 105;
+}
+}
+} else {
+if (w < 407) {
+return x / 106;
+} else {
+if (w < 408) {
+return x / 107;
+} else {
+return x / 108;
+}
+}
+}
+} else {
+if (w < 412) {
+if (w < 410) {
+return x / 109;
+} else {
+if (w < 411) {
+return x / 110;
+} else {
+return x / 111;
+}
+}
+} else {
+if (w < 413) {
+return x / 112;
+} else {
+if (w < 414) {
+return x / 113;
+} else {
+return x / 114;
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 438) {
+if (w < 426) {
+if (w < 420) {
+if (w < 417) {
+if (w < 416) {
+return x / 115;
+} else {
+return x / 116;
+}
+} else {
+if (w < 418) {
+return x / 117;
+} else {
+if (w < 419) {
+return x / 118;
+} else {
+return x / 119;
+}
+}
+}
+} else {
+if (w < 423) {
+if (w < 421) {
+return x / 120;
+} else {
+if (w < 422) {
+return x / 121;
+} else {
+return x / 122;
+}
+}
+} else {
+if (w < 424) {
+return x / 123;
+} else {
+if (w < 425) {
+return x / 124;
+} else {
+return x / 125;
+}
+}
+}
+}
+} else {
+if (w < 432) {
+if (w < 429) {
+if (w < 427) {
+return x / 126;
+} else {
+if (w < 428) {
+return x / 127;
+} else {
+return x / 128;
+}
+}
+} else {
+if (w < 430) {
+return x / 129;
+} else {
+if (w < 431) {
+return x / 130;
+} else {
+return x / 131;
+}
+}
+}
+} else {
+if (w < 435) {
+if (w < 433) {
+return x / 132;
+} else {
+if (w < 434) {
+return x / 133;
+} else {
+return x / 134;
+}
+}
+} else {
+if (w < 436) {
+return x / 135;
+} else {
+if (w < 437) {
+return x / 136;
+} else {
+return x / 137;
+}
+}
+}
+}
+}
+} else {
+if (w < 449) {
+if (w < 443) {
+if (w < 440) {
+if (w < 439) {
+return x / 138;
+} else {
+return x / 139;
+}
+} else {
+if (w < 441) {
+return x / 140;
+} else {
+if (w < 442) {
+return x / 141;
+} else {
+return x / 142;
+}
+}
+}
+} else {
+if (w < 446) {
+if (w < 444) {
+return x / 143;
+} else {
+if (w < 445) {
+return x / 144;
+} else {
+return x / 145;
+}
+}
+} else {
+if (w < 447) {
+return x / 146;
+} else {
+if (w < 448) {
+return x / 147;
+} else {
+return x / 148;
+}
+}
+}
+}
+} else {
+if (w < 455) {
+if (w < 452) {
+if (w < 450) {
+return x / 149;
+} else {
+if (w < 451) {
+return x / 150;
+} else {
+return x / 151;
+}
+}
+} else {
+if (w < 453) {
+return x / 152;
+} else {
+if (w < 454) {
+return x / 153;
+} else {
+return x / 154;
+}
+}
+}
+} else {
+if (w < 458) {
+if (w < 456) {
+return x / 155;
+} else {
+if (w < 457) {
+return x / 156;
+} else {
+return x / 157;
+}
+}
+} else {
+if (w < 459) {
+return x / 158;
+} else {
+if (w < 460) {
+return x / 159;
+} else {
+return x / 160;
+}
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 507) {
+if (w < 484) {
+if (w < 472) {
+if (w < 466) {
+if (w < 463) {
+if (w < 462) {
+return x / 161;
+} else {
+return x / 162;
+}
+} else {
+if (w < 464) {
+return x / 163;
+} else {
+if (w < 465) {
+return x / 164;
+} else {
+return x / 165;
+}
+}
+}
+} else {
+if (w < 469) {
+if (w < 467) {
+return x / 166;
+} else {
+if (w < 468) {
+return x / 167;
+} else {
+return x / 168;
+}
+}
+} else {
+if (w < 470) {
+return x / 169;
+} else {
+if (w < 471) {
+return x / 170;
+} else {
+return x / 171;
+}
+}
+}
+}
+} else {
+if (w < 478) {
+if (w < 475) {
+if (w < 473) {
+return x / 172;
+} else {
+if (w < 474) {
+return x / 173;
+} else {
+return x / 174;
+}
+}
+} else {
+if (w < 476) {
+return x / 175;
+} else {
+if (w < 477) {
+return x / 176;
+} else {
+return x / 177;
+}
+}
+}
+} else {
+if (w < 481) {
+if (w < 479) {
+return x / 178;
+} else {
+if (w < 480) {
+return x / 179;
+} else {
+return x / 180;
+}
+}
+} else {
+if (w < 482) {
+return x / 181;
+} else {
+if (w < 483) {
+return x / 182;
+} else {
+return x / 183;
+}
+}
+}
+}
+}
+} else {
+if (w < 495) {
+if (w < 489) {
+if (w < 486) {
+if (w < 485) {
+return x / 184;
+} else {
+return x / 185;
+}
+} else {
+if (w < 487) {
+return x / 186;
+} else {
+if (w < 488) {
+return x / 187;
+} else {
+return x / 188;
+}
+}
+}
+} else {
+if (w < 492) {
+if (w < 490) {
+return x / 189;
+} else {
+if (w < 491) {
+return x / 190;
+} else {
+return x / 191;
+}
+}
+} else {
+if (w < 493) {
+return x / 192;
+} else {
+if (w < 494) {
+return x / 193;
+} else {
+return x / 194;
+}
+}
+}
+}
+} else {
+if (w < 501) {
+if (w < 498) {
+if (w < 496) {
+return x / 195;
+} else {
+if (w < 497) {
+return x / 196;
+} else {
+return x / 197;
+}
+}
+} else {
+if (w < 499) {
+return x / 198;
+} else {
+if (w < 500) {
+return x / 199;
+} else {
+return x / 200;
+}
+}
+}
+} else {
+if (w < 504) {
+if (w < 502) {
+return x / 201;
+} else {
+if (w < 503) {
+return x / 202;
+} else {
+return x / 203;
+}
+}
+} else {
+if (w < 505) {
+return x / 204;
+} else {
+if (w < 506) {
+return x / 205;
+} else {
+return x / 206;
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 530) {
+if (w < 518) {
+if (w < 512) {
+if (w < 509) {
+if (w < 508) {
+return x / 207;
+} else {
+return x / 208;
+}
+} else {
+if (w < 510) {
+return x / 209;
+} else {
+if (w < 511) {
+return x / 210;
+} else {
+return x / 211;
+}
+}
+}
+} else {
+if (w < 515) {
+if (w < 513) {
+return x / 212;
+} else {
+if (w < 514) {
+return x / 213;
+} else {
+return x / 214;
+}
+}
+} else {
+if (w < 516) {
+return x / 215;
+} else {
+if (w < 517) {
+return x / 216;
+} else {
+return x / 217;
+}
+}
+}
+}
+} else {
+if (w < 524) {
+if (w < 521) {
+if (w < 519) {
+return x / 218;
+} else {
+if (w < 520) {
+return x / 219;
+} else {
+return x / 220;
+}
+}
+} else {
+if (w < 522) {
+return x / 221;
+} else {
+if (w < 523) {
+return x / 222;
+} else {
+return x / 223;
+}
+}
+}
+} else {
+if (w < 527) {
+if (w < 525) {
+return x / 224;
+} else {
+if (w < 526) {
+return x / 225;
+} else {
+return x / 226;
+}
+}
+} else {
+if (w < 528) {
+return x / 227;
+} else {
+if (w < 529) {
+return x / 228;
+} else {
+return x / 229;
+}
+}
+}
+}
+}
+} else {
+if (w < 542) {
+if (w < 536) {
+if (w < 533) {
+if (w < 531) {
+return x / 230;
+} else {
+if (w < 532) {
+return x / 231;
+} else {
+return x / 232;
+}
+}
+} else {
+if (w < 534) {
+return x / 233;
+} else {
+if (w < 535) {
+return x / 234;
+} else {
+return x / 235;
+}
+}
+}
+} else {
+if (w < 539) {
+if (w < 537) {
+return x / 236;
+} else {
+if (w < 538) {
+return x / 237;
+} else {
+return x / 238;
+}
+}
+} else {
+if (w < 540) {
+return x / 239;
+} else {
+if (w < 541) {
+return x / 240;
+} else {
+return x / 241;
+}
+}
+}
+}
+} else {
+if (w < 548) {
+if (w < 545) {
+if (w < 543) {
+return x / 242;
+} else {
+if (w < 544) {
+return x / 243;
+} else {
+return x / 244;
+}
+}
+} else {
+if (w < 546) {
+return x / 245;
+} else {
+if (w < 547) {
+return x / 246;
+} else {
+return x / 247;
+}
+}
+}
+} else {
+if (w < 551) {
+if (w < 549) {
+return x / 248;
+} else {
+if (w < 550) {
+return x / 249;
+} else {
+return x / 250;
+}
+}
+} else {
+if (w < 552) {
+return x / 251;
+} else {
+if (w < 553) {
+return x / 252;
+} else {
+return x / 253;
+}
+}
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 646) {
+if (w < 600) {
+if (w < 577) {
+if (w < 565) {
+if (w < 559) {
+if (w < 556) {
+if (w < 555) {
+return x / 254;
+} else {
+return x / 255;
+}
+} else {
+if (w < 557) {
+return x / 256;
+} else {
+if (w < 558) {
+return x / 257;
+} else {
+return x / 258;
+}
+}
+}
+} else {
+if (w < 562) {
+if (w < 560) {
+return x / 259;
+} else {
+if (w < 561) {
+return x / 260;
+} else {
+return x / 261;
+}
+}
+} else {
+if (w < 563) {
+return x / 262;
+} else {
+if (w < 564) {
+return x / 263;
+} else {
+return x / 264;
+}
+}
+}
+}
+} else {
+if (w < 571) {
+if (w < 568) {
+if (w < 566) {
+return x / 265;
+} else {
+if (w < 567) {
+return x / 266;
+} else {
+return x / 267;
+}
+}
+} else {
+if (w < 569) {
+return x / 268;
+} else {
+if (w < 570) {
+return x / 269;
+} else {
+return x / 270;
+}
+}
+}
+} else {
+if (w < 574) {
+if (w < 572) {
+return x / 271;
+} else {
+if (w < 573) {
+return x / 272;
+} else {
+return x / 273;
+}
+}
+} else {
+if (w < 575) {
+return x / 274;
+} else {
+if (w < 576) {
+return x / 275;
+} else {
+return x / 276;
+}
+}
+}
+}
+}
+} else {
+if (w < 588) {
+if (w < 582) {
+if (w < 579) {
+if (w < 578) {
+return x / 277;
+} else {
+return x / 278;
+}
+} else {
+if (w < 580) {
+return x / 279;
+} else {
+if (w < 581) {
+return x / 280;
+} else {
+return x / 281;
+}
+}
+}
+} else {
+if (w < 585) {
+if (w < 583) {
+return x / 282;
+} else {
+if (w < 584) {
+return x / 283;
+} else {
+return x / 284;
+}
+}
+} else {
+if (w < 586) {
+return x / 285;
+} else {
+if (w < 587) {
+return x / 286;
+} else {
+return x / 287;
+}
+}
+}
+}
+} else {
+if (w < 594) {
+if (w < 591) {
+if (w < 589) {
+return x / 288;
+} else {
+if (w < 590) {
+return x / 289;
+} else {
+return x / 290;
+}
+}
+} else {
+if (w < 592) {
+return x / 291;
+} else {
+if (w < 593) {
+return x / 292;
+} else {
+return x / 293;
+}
+}
+}
+} else {
+if (w < 597) {
+if (w < 595) {
+return x / 294;
+} else {
+if (w < 596) {
+return x / 295;
+} else {
+return x / 296;
+}
+}
+} else {
+if (w < 598) {
+return x / 297;
+} else {
+if (w < 599) {
+return x / 298;
+} else {
+return x / 299;
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 623) {
+if (w < 611) {
+if (w < 605) {
+if (w < 602) {
+if (w < 601) {
+return x / 300;
+} else {
+return x / 511;
+}
+} else {
+if (w < 603) {
+return x / 512;
+} else {
+if (w < 604) {
+return x / 513;
+} else {
+return x / -511;
+}
+}
+}
+} else {
+if (w < 608) {
+if (w < 606) {
+return x / -512;
+} else {
+if (w < 607) {
+return x / -513;
+} else {
+return x / 1023;
+}
+}
+} else {
+if (w < 609) {
+return x / 1024;
+} else {
+if (w < 610) {
+return x / 1025;
+} else {
+return x / -1023;
+}
+}
+}
+}
+} else {
+if (w < 617) {
+if (w < 614) {
+if (w < 612) {
+return x / -1024;
+} else {
+if (w < 613) {
+return x / -1025;
+} else {
+return x / 2047;
+}
+}
+} else {
+if (w < 615) {
+return x / 2048;
+} else {
+if (w < 616) {
+return x / 2049;
+} else {
+return x / -2047;
+}
+}
+}
+} else {
+if (w < 620) {
+if (w < 618) {
+return x / -2048;
+} else {
+if (w < 619) {
+return x / -2049;
+} else {
+return x / 4095;
+}
+}
+} else {
+if (w < 621) {
+return x / 4096;
+} else {
+if (w < 622) {
+return x / 4097;
+} else {
+return x / -4095;
+}
+}
+}
+}
+}
+} else {
+if (w < 634) {
+if (w < 628) {
+if (w < 625) {
+if (w < 624) {
+return x / -4096;
+} else {
+return x / -4097;
+}
+} else {
+if (w < 626) {
+return x / 8191;
+} else {
+if (w < 627) {
+return x / 8192;
+} else {
+return x / 8193;
+}
+}
+}
+} else {
+if (w < 631) {
+if (w < 629) {
+return x / -8191;
+} else {
+if (w < 630) {
+return x / -8192;
+} else {
+return x / -8193;
+}
+}
+} else {
+if (w < 632) {
+return x / 16383;
+} else {
+if (w < 633) {
+return x / 16384;
+} else {
+return x / 16385;
+}
+}
+}
+}
+} else {
+if (w < 640) {
+if (w < 637) {
+if (w < 635) {
+return x / -16383;
+} else {
+if (w < 636) {
+return x / -16384;
+} else {
+return x / -16385;
+}
+}
+} else {
+if (w < 638) {
+return x / 32767;
+} else {
+if (w < 639) {
+return x / 32768;
+} else {
+return x / 32769;
+}
+}
+}
+} else {
+if (w < 643) {
+if (w < 641) {
+return x / -32767;
+} else {
+if (w < 642) {
+return x / -32768;
+} else {
+return x / -32769;
+}
+}
+} else {
+if (w < 644) {
+return x / 65535;
+} else {
+if (w < 645) {
+return x / 65536;
+} else {
+return x / 65537;
+}
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 692) {
+if (w < 669) {
+if (w < 657) {
+if (w < 651) {
+if (w < 648) {
+if (w < 647) {
+return x / -65535;
+} else {
+return x / -65536;
+}
+} else {
+if (w < 649) {
+return x / -65537;
+} else {
+if (w < 650) {
+return x / 131071;
+} else {
+return x / 131072;
+}
+}
+}
+} else {
+if (w < 654) {
+if (w < 652) {
+return x / 131073;
+} else {
+if (w < 653) {
+return x / -131071;
+} else {
+return x / -131072;
+}
+}
+} else {
+if (w < 655) {
+return x / -131073;
+} else {
+if (w < 656) {
+return x / 262143;
+} else {
+return x / 262144;
+}
+}
+}
+}
+} else {
+if (w < 663) {
+if (w < 660) {
+if (w < 658) {
+return x / 262145;
+} else {
+if (w < 659) {
+return x / -262143;
+} else {
+return x / -262144;
+}
+}
+} else {
+if (w < 661) {
+return x / -262145;
+} else {
+if (w < 662) {
+return x / 524287;
+} else {
+return x / 524288;
+}
+}
+}
+} else {
+if (w < 666) {
+if (w < 664) {
+return x / 524289;
+} else {
+if (w < 665) {
+return x / -524287;
+} else {
+return x / -524288;
+}
+}
+} else {
+if (w < 667) {
+return x / -524289;
+} else {
+if (w < 668) {
+return x / 1048575;
+} else {
+return x / 1048576;
+}
+}
+}
+}
+}
+} else {
+if (w < 680) {
+if (w < 674) {
+if (w < 671) {
+if (w < 670) {
+return x / 1048577;
+} else {
+return x / -1048575;
+}
+} else {
+if (w < 672) {
+return x / -1048576;
+} else {
+if (w < 673) {
+return x / -1048577;
+} else {
+return x / 2097151;
+}
+}
+}
+} else {
+if (w < 677) {
+if (w < 675) {
+return x / 2097152;
+} else {
+if (w < 676) {
+return x / 2097153;
+} else {
+return x / -2097151;
+}
+}
+} else {
+if (w < 678) {
+return x / -2097152;
+} else {
+if (w < 679) {
+return x / -2097153;
+} else {
+return x / 4194303;
+}
+}
+}
+}
+} else {
+if (w < 686) {
+if (w < 683) {
+if (w < 681) {
+return x / 4194304;
+} else {
+if (w < 682) {
+return x / 4194305;
+} else {
+return x / -4194303;
+}
+}
+} else {
+if (w < 684) {
+return x / -4194304;
+} else {
+if (w < 685) {
+return x / -4194305;
+} else {
+return x / 8388607;
+}
+}
+}
+} else {
+if (w < 689) {
+if (w < 687) {
+return x / 8388608;
+} else {
+if (w < 688) {
+return x / 8388609;
+} else {
+return x / -8388607;
+}
+}
+} else {
+if (w < 690) {
+return x / -8388608;
+} else {
+if (w < 691) {
+return x / -8388609;
+} else {
+return x / 16777215;
+}
+}
+}
+}
+}
+}
+} else {
+if (w < 715) {
+if (w < 703) {
+if (w < 697) {
+if (w < 694) {
+if (w < 693) {
+return x / 16777216;
+} else {
+return x / 16777217;
+}
+} else {
+if (w < 695) {
+return x / -16777215;
+} else {
+if (w < 696) {
+return x / -16777216;
+} else {
+return x / -16777217;
+}
+}
+}
+} else {
+if (w < 700) {
+if (w < 698) {
+return x / 33554431;
+} else {
+if (w < 699) {
+return x / 33554432;
+} else {
+return x / 33554433;
+}
+}
+} else {
+if (w < 701) {
+return x / -33554431;
+} else {
+if (w < 702) {
+return x / -33554432;
+} else {
+return x / -33554433;
+}
+}
+}
+}
+} else {
+if (w < 709) {
+if (w < 706) {
+if (w < 704) {
+return x / 67108863;
+} else {
+if (w < 705) {
+return x / 67108864;
+} else {
+return x / 67108865;
+}
+}
+} else {
+if (w < 707) {
+return x / -67108863;
+} else {
+if (w < 708) {
+return x / -67108864;
+} else {
+return x / -67108865;
+}
+}
+}
+} else {
+if (w < 712) {
+if (w < 710) {
+return x / 134217727;
+} else {
+if (w < 711) {
+return x / 134217728;
+} else {
+return x / 134217729;
+}
+}
+} else {
+if (w < 713) {
+return x / -134217727;
+} else {
+if (w < 714) {
+return x / -134217728;
+} else {
+return x / -134217729;
+}
+}
+}
+}
+}
+} else {
+if (w < 727) {
+if (w < 721) {
+if (w < 718) {
+if (w < 716) {
+return x / 268435455;
+} else {
+if (w < 717) {
+return x / 268435456;
+} else {
+return x / 268435457;
+}
+}
+} else {
+if (w < 719) {
+return x / -268435455;
+} else {
+if (w < 720) {
+return x / -268435456;
+} else {
+return x / -268435457;
+}
+}
+}
+} else {
+if (w < 724) {
+if (w < 722) {
+return x / 536870911;
+} else {
+if (w < 723) {
+return x / 536870912;
+} else {
+return x / 536870913;
+}
+}
+} else {
+if (w < 725) {
+return x / -536870911;
+} else {
+if (w < 726) {
+return x / -536870912;
+} else {
+return x / -536870913;
+}
+}
+}
+}
+} else {
+if (w < 733) {
+if (w < 730) {
+if (w < 728) {
+return x / 1073741823;
+} else {
+if (w < 729) {
+return x / 1073741824;
+} else {
+return x / 1073741825;
+}
+}
+} else {
+if (w < 731) {
+return x / -1073741823;
+} else {
+if (w < 732) {
+return x / -1073741824;
+} else {
+return x / -1073741825;
+}
+}
+}
+} else {
+if (w < 736) {
+if (w < 734) {
+return x / 641;
+} else {
+if (w < 735) {
+return x / 1000003;
+} else {
+return x / -1000003;
+}
+}
+} else {
+if (w < 737) {
+return x / 2147483647;
+} else {
+if (w < 738) {
+return x / -2147483647;
+} else {
+return x / (-2147483647 - 1);
+}
+}
+}
+}
+}
+}
+}
+}
+}
+}
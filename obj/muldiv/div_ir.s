@@ -0,0 +1,14034 @@
+.intel_syntax noprefix
+.global div_ir
+div_ir:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+
+    mov qword ptr [rbp-8], rbx
+.LB0:
+    call arg
+    mov rbx, rax
+    call which
+    mov rcx, rax
+    mov rsi, 369
+    cmp rcx, rsi
+    jge .LB1106
+.LB1:
+    mov rsi, 184
+    cmp rcx, rsi
+    jge .LB552
+.LB2:
+    mov rsi, 92
+    cmp rcx, rsi
+    jge .LB277
+.LB3:
+    mov rsi, 46
+    cmp rcx, rsi
+    jge .LB140
+.LB4:
+    mov rsi, 23
+    cmp rcx, rsi
+    jge .LB72
+.LB5:
+    mov rsi, 11
+    cmp rcx, rsi
+    jge .LB37
+.LB6:
+    mov rsi, 5
+    cmp rcx, rsi
+    jge .LB20
+.LB7:
+    mov rsi, 2
+    cmp rcx, rsi
+    jge .LB12
+.LB8:
+    mov rsi, 1
+    cmp rcx, rsi
+    jge .LB10
+.LB9:
+    mov rax, 7870610804782742023
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB10:
+    mov rax, 7896933917842216077
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB11:
+    jmp .LB19
+.LB12:
+    mov rsi, 3
+    cmp rcx, rsi
+    jge .LB14
+.LB13:
+    mov rax, 1980858424022502187
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB14:
+    mov rsi, 4
+    cmp rcx, rsi
+    jge .LB16
+.LB15:
+    mov rax, 7950111924022971741
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB16:
+    mov rax, 3988485205126389539
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB17:
+.LB18:
+.LB19:
+    jmp .LB36
+.LB20:
+    mov rsi, 8
+    cmp rcx, rsi
+    jge .LB28
+.LB21:
+    mov rsi, 6
+    cmp rcx, rsi
+    jge .LB23
+.LB22:
+    mov rax, 8004010987914652905
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB23:
+    mov rsi, 7
+    cmp rcx, rsi
+    jge .LB25
+.LB24:
+    mov rax, 2007808878771107659
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB25:
+    mov rax, 503665367200260795
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB26:
+.LB27:
+    jmp .LB35
+.LB28:
+    mov rsi, 9
+    cmp rcx, rsi
+    jge .LB30
+.LB29:
+    mov rax, 8086243977516515777
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB30:
+    mov rsi, 10
+    cmp rcx, rsi
+    jge .LB32
+.LB31:
+    mov rax, 8114031757507981467
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB32:
+    mov rax, 8142011177361457265
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB33:
+.LB34:
+.LB35:
+.LB36:
+    jmp .LB71
+.LB37:
+    mov rsi, 17
+    cmp rcx, rsi
+    jge .LB54
+.LB38:
+    mov rsi, 14
+    cmp rcx, rsi
+    jge .LB46
+.LB39:
+    mov rsi, 12
+    cmp rcx, rsi
+    jge .LB41
+.LB40:
+    mov rax, 1021273028302258913
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB41:
+    mov rsi, 13
+    cmp rcx, rsi
+    jge .LB43
+.LB42:
+    mov rax, 1024819115206086201
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB43:
+    mov rax, 1028389913516908801
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB44:
+.LB45:
+    jmp .LB53
+.LB46:
+    mov rsi, 15
+    cmp rcx, rsi
+    jge .LB48
+.LB47:
+    mov rax, 1031985682445289601
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB48:
+    mov rsi, 16
+    cmp rcx, rsi
+    jge .LB50
+.LB49:
+    mov rax, 4142426739359337907
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB50:
+    mov rax, 8314025498009938757
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB51:
+.LB52:
+.LB53:
+    jmp .LB70
+.LB54:
+    mov rsi, 20
+    cmp rcx, rsi
+    jge .LB62
+.LB55:
+    mov rsi, 18
+    cmp rcx, rsi
+    jge .LB57
+.LB56:
+    mov rax, 8343403679981705325
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB57:
+    mov rsi, 19
+    cmp rcx, rsi
+    jge .LB59
+.LB58:
+    mov rax, 2093247554463495219
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB59:
+    mov rax, -1641169401575582883
+    imul rbx
+    add rdx, rbx
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB60:
+.LB61:
+    jmp .LB69
+.LB62:
+    mov rsi, 21
+    cmp rcx, rsi
+    jge .LB64
+.LB63:
+    mov rax, 1054099661354831521
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB64:
+    mov rsi, 22
+    cmp rcx, rsi
+    jge .LB66
+.LB65:
+    mov rax, 1057877796341766401
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB66:
+    mov rax, 4246732448623781667
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB67:
+.LB68:
+.LB69:
+.LB70:
+.LB71:
+    jmp .LB139
+.LB72:
+    mov rsi, 34
+    cmp rcx, rsi
+    jge .LB104
+.LB73:
+    mov rsi, 28
+    cmp rcx, rsi
+    jge .LB87
+.LB74:
+    mov rsi, 25
+    cmp rcx, rsi
+    jge .LB79
+.LB75:
+    mov rsi, 24
+    cmp rcx, rsi
+    jge .LB77
+.LB76:
+    mov rax, 8524127225396471505
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB77:
+    mov rax, 8555011744329067417
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB78:
+    jmp .LB86
+.LB79:
+    mov rsi, 26
+    cmp rcx, rsi
+    jge .LB81
+.LB80:
+    mov rax, 1073265109743101185
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB81:
+    mov rsi, 27
+    cmp rcx, rsi
+    jge .LB83
+.LB82:
+    mov rax, -1211829902652452295
+    imul rbx
+    add rdx, rbx
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB83:
+    mov rax, 1081127857799827201
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB84:
+.LB85:
+.LB86:
+    jmp .LB103
+.LB87:
+    mov rsi, 31
+    cmp rcx, rsi
+    jge .LB95
+.LB88:
+    mov rsi, 29
+    cmp rcx, rsi
+    jge .LB90
+.LB89:
+    mov rax, 8680820740569200761
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB90:
+    mov rsi, 30
+    cmp rcx, rsi
+    jge .LB92
+.LB91:
+    mov rax, 4356426644713694847
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB92:
+    mov rax, 8745123116425268915
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB93:
+.LB94:
+    jmp .LB102
+.LB95:
+    mov rsi, 32
+    cmp rcx, rsi
+    jge .LB97
+.LB96:
+    mov rax, 2194408216946861159
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB97:
+    mov rsi, 33
+    cmp rcx, rsi
+    jge .LB99
+.LB98:
+    mov rax, 8810385229234412713
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB99:
+    mov rax, 8843382926722182049
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB100:
+.LB101:
+.LB102:
+.LB103:
+    jmp .LB138
+.LB104:
+    mov rsi, 40
+    cmp rcx, rsi
+    jge .LB121
+.LB105:
+    mov rsi, 37
+    cmp rcx, rsi
+    jge .LB113
+.LB106:
+    mov rsi, 35
+    cmp rcx, rsi
+    jge .LB108
+.LB107:
+    mov rax, 8876628727198581229
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB108:
+    mov rsi, 36
+    cmp rcx, rsi
+    jge .LB110
+.LB109:
+    mov rax, 8910125439376689083
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB110:
+    mov rax, 1117984489315730401
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB111:
+.LB112:
+    jmp .LB120
+.LB113:
+    mov rsi, 38
+    cmp rcx, rsi
+    jge .LB115
+.LB114:
+    mov rax, 8977883047280694323
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB115:
+    mov rsi, 39
+    cmp rcx, rsi
+    jge .LB117
+.LB116:
+    mov rax, 281629680514649643
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB117:
+    mov rax, 9046679085957174739
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB118:
+.LB119:
+.LB120:
+    jmp .LB137
+.LB121:
+    mov rsi, 43
+    cmp rcx, rsi
+    jge .LB129
+.LB122:
+    mov rsi, 41
+    cmp rcx, rsi
+    jge .LB124
+.LB123:
+    mov rax, 1135184250689818561
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB124:
+    mov rsi, 42
+    cmp rcx, rsi
+    jge .LB126
+.LB125:
+    mov rax, 9116537611717461803
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB126:
+    mov rax, 71499008037633921
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB127:
+.LB128:
+    jmp .LB136
+.LB129:
+    mov rsi, 44
+    cmp rcx, rsi
+    jge .LB131
+.LB130:
+    mov rax, 9187483429707480961
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB131:
+    mov rsi, 45
+    cmp rcx, rsi
+    jge .LB133
+.LB132:
+    mov rax, rbx
+    cqo
+    shr rdx, 56
+    add rax, rdx
+    sar rax, 8
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB133:
+    mov rax, -9187201950435737471
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB134:
+.LB135:
+.LB136:
+.LB137:
+.LB138:
+.LB139:
+    jmp .LB276
+.LB140:
+    mov rsi, 69
+    cmp rcx, rsi
+    jge .LB208
+.LB141:
+    mov rsi, 57
+    cmp rcx, rsi
+    jge .LB173
+.LB142:
+    mov rsi, 51
+    cmp rcx, rsi
+    jge .LB156
+.LB143:
+    mov rsi, 48
+    cmp rcx, rsi
+    jge .LB148
+.LB144:
+    mov rsi, 47
+    cmp rcx, rsi
+    jge .LB146
+.LB145:
+    mov rax, 4647998506761461825
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB146:
+    mov rax, 1166592510590327375
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB147:
+    jmp .LB155
+.LB148:
+    mov rsi, 49
+    cmp rcx, rsi
+    jge .LB150
+.LB149:
+    mov rax, -9076969306111049207
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB150:
+    mov rsi, 50
+    cmp rcx, rsi
+    jge .LB152
+.LB151:
+    mov rax, 2351776136887273513
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB152:
+    mov rax, 2361183241434822607
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB153:
+.LB154:
+.LB155:
+    jmp .LB172
+.LB156:
+    mov rsi, 54
+    cmp rcx, rsi
+    jge .LB164
+.LB157:
+    mov rsi, 52
+    cmp rcx, rsi
+    jge .LB159
+.LB158:
+    mov rax, 1185332952527521389
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB159:
+    mov rsi, 53
+    cmp rcx, rsi
+    jge .LB161
+.LB160:
+    mov rax, -8925843906633654007
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB161:
+    mov rax, -8887297752111079523
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB162:
+.LB163:
+    jmp .LB171
+.LB164:
+    mov rsi, 55
+    cmp rcx, rsi
+    jge .LB166
+.LB165:
+    mov rax, -8848438214218402807
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB166:
+    mov rsi, 56
+    cmp rcx, rsi
+    jge .LB168
+.LB167:
+    mov rax, -8809261455608234853
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB168:
+    mov rax, -8769763576025852407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB169:
+.LB170:
+.LB171:
+.LB172:
+    jmp .LB207
+.LB173:
+    mov rsi, 63
+    cmp rcx, rsi
+    jge .LB190
+.LB174:
+    mov rsi, 60
+    cmp rcx, rsi
+    jge .LB182
+.LB175:
+    mov rsi, 58
+    cmp rcx, rsi
+    jge .LB177
+.LB176:
+    mov rax, -8729940611014808377
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB177:
+    mov rsi, 59
+    cmp rcx, rsi
+    jge .LB179
+.LB178:
+    mov rax, 4878477771559550841
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB179:
+    mov rax, 1224680104478642431
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB180:
+.LB181:
+    jmp .LB189
+.LB182:
+    mov rsi, 61
+    cmp rcx, rsi
+    jge .LB184
+.LB183:
+    mov rax, -8608480567731124087
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB184:
+    mov rsi, 62
+    cmp rcx, rsi
+    jge .LB186
+.LB185:
+    mov rax, -8567316285279331503
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB186:
+    mov rax, -8525806084487607889
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB187:
+.LB188:
+.LB189:
+    jmp .LB206
+.LB190:
+    mov rsi, 66
+    cmp rcx, rsi
+    jge .LB198
+.LB191:
+    mov rsi, 64
+    cmp rcx, rsi
+    jge .LB193
+.LB192:
+    mov rax, -8483945586642789561
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB193:
+    mov rsi, 65
+    cmp rcx, rsi
+    jge .LB195
+.LB194:
+    mov rax, -8441730338816235485
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB195:
+    mov rax, -8399155812284774565
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB196:
+.LB197:
+    jmp .LB205
+.LB198:
+    mov rsi, 67
+    cmp rcx, rsi
+    jge .LB200
+.LB199:
+    mov rax, -8356217400911164407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB200:
+    mov rsi, 68
+    cmp rcx, rsi
+    jge .LB202
+.LB201:
+    mov rax, 2533458413556676617
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB202:
+    mov rax, 5088756985850910791
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB203:
+.LB204:
+.LB205:
+.LB206:
+.LB207:
+    jmp .LB275
+.LB208:
+    mov rsi, 80
+    cmp rcx, rsi
+    jge .LB240
+.LB209:
+    mov rsi, 74
+    cmp rcx, rsi
+    jge .LB223
+.LB210:
+    mov rsi, 71
+    cmp rcx, rsi
+    jge .LB215
+.LB211:
+    mov rsi, 70
+    cmp rcx, rsi
+    jge .LB213
+.LB212:
+    mov rax, -8225171599965730807
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB213:
+    mov rax, 2566503523298720225
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB214:
+    jmp .LB222
+.LB215:
+    mov rsi, 72
+    cmp rcx, rsi
+    jge .LB217
+.LB216:
+    mov rax, -8135900224649190887
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB217:
+    mov rsi, 73
+    cmp rcx, rsi
+    jge .LB219
+.LB218:
+    mov rax, 161813544506224137
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB219:
+    mov rax, -8045055785450421189
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB220:
+.LB221:
+.LB222:
+    jmp .LB239
+.LB223:
+    mov rsi, 77
+    cmp rcx, rsi
+    jge .LB231
+.LB224:
+    mov rsi, 75
+    cmp rcx, rsi
+    jge .LB226
+.LB225:
+    mov rax, 5223856728838103113
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB226:
+    mov rsi, 76
+    cmp rcx, rsi
+    jge .LB228
+.LB227:
+    mov rax, 5247073869855161349
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB228:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB229:
+.LB230:
+    jmp .LB238
+.LB231:
+    mov rsi, 78
+    cmp rcx, rsi
+    jge .LB233
+.LB232:
+    mov rax, -7858478417051154275
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB233:
+    mov rsi, 79
+    cmp rcx, rsi
+    jge .LB235
+.LB234:
+    mov rax, -7810783526705846179
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB235:
+    mov rax, 5342043532657969699
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB236:
+.LB237:
+.LB238:
+.LB239:
+    jmp .LB274
+.LB240:
+    mov rsi, 86
+    cmp rcx, rsi
+    jge .LB257
+.LB241:
+    mov rsi, 83
+    cmp rcx, rsi
+    jge .LB249
+.LB242:
+    mov rsi, 81
+    cmp rcx, rsi
+    jge .LB244
+.LB243:
+    mov rax, 5366325548715505925
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB244:
+    mov rsi, 82
+    cmp rcx, rsi
+    jge .LB246
+.LB245:
+    mov rax, -7665085437020863913
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB246:
+    mov rax, -7615628287311282777
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB247:
+.LB248:
+    jmp .LB256
+.LB249:
+    mov rsi, 84
+    cmp rcx, rsi
+    jge .LB251
+.LB250:
+    mov rax, 5440514381186227205
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB251:
+    mov rsi, 85
+    cmp rcx, rsi
+    jge .LB253
+.LB252:
+    mov rax, 341606371735362067
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB253:
+    mov rax, -7464496439128981351
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB254:
+.LB255:
+.LB256:
+    jmp .LB273
+.LB257:
+    mov rsi, 89
+    cmp rcx, rsi
+    jge .LB265
+.LB258:
+    mov rsi, 87
+    cmp rcx, rsi
+    jge .LB260
+.LB259:
+    mov rax, 1379195818595106663
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB260:
+    mov rsi, 88
+    cmp rcx, rsi
+    jge .LB262
+.LB261:
+    mov rax, -7361376743029633273
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB262:
+    mov rax, 5568828399610430677
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB263:
+.LB264:
+    jmp .LB272
+.LB265:
+    mov rsi, 90
+    cmp rcx, rsi
+    jge .LB267
+.LB266:
+    mov rax, 5595220951267352149
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB267:
+    mov rsi, 91
+    cmp rcx, rsi
+    jge .LB269
+.LB268:
+    mov rax, 5621864860559101445
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB269:
+    mov rax, 5648763735490006237
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB270:
+.LB271:
+.LB272:
+.LB273:
+.LB274:
+.LB275:
+.LB276:
+    jmp .LB551
+.LB277:
+    mov rsi, 138
+    cmp rcx, rsi
+    jge .LB414
+.LB278:
+    mov rsi, 115
+    cmp rcx, rsi
+    jge .LB346
+.LB279:
+    mov rsi, 103
+    cmp rcx, rsi
+    jge .LB311
+.LB280:
+    mov rsi, 97
+    cmp rcx, rsi
+    jge .LB294
+.LB281:
+    mov rsi, 94
+    cmp rcx, rsi
+    jge .LB286
+.LB282:
+    mov rsi, 93
+    cmp rcx, rsi
+    jge .LB284
+.LB283:
+    mov rax, 5675921253449092805
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB284:
+    mov rax, -7040061747937461727
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB285:
+    jmp .LB293
+.LB286:
+    mov rsi, 95
+    cmp rcx, rsi
+    jge .LB288
+.LB287:
+    mov rax, -6984689503637597213
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB288:
+    mov rsi, 96
+    cmp rcx, rsi
+    jge .LB290
+.LB289:
+    mov rax, 5758983515694689285
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB290:
+    mov rax, -6872316419617283935
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB291:
+.LB292:
+.LB293:
+    jmp .LB310
+.LB294:
+    mov rsi, 100
+    cmp rcx, rsi
+    jge .LB302
+.LB295:
+    mov rsi, 98
+    cmp rcx, rsi
+    jge .LB297
+.LB296:
+    mov rax, 5815722269543898047
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB297:
+    mov rsi, 99
+    cmp rcx, rsi
+    jge .LB299
+.LB298:
+    mov rax, -6757718126012409997
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB299:
+    mov rax, -6699563768063667999
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB300:
+.LB301:
+    jmp .LB309
+.LB302:
+    mov rsi, 101
+    cmp rcx, rsi
+    jge .LB304
+.LB303:
+    mov rax, -6640827866535438581
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB304:
+    mov rsi, 102
+    cmp rcx, rsi
+    jge .LB306
+.LB305:
+    mov rax, 5932621209635232681
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB306:
+    mov rax, -6521576187675094005
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB307:
+.LB308:
+.LB309:
+.LB310:
+    jmp .LB345
+.LB311:
+    mov rsi, 109
+    cmp rcx, rsi
+    jge .LB328
+.LB312:
+    mov rsi, 106
+    cmp rcx, rsi
+    jge .LB320
+.LB313:
+    mov rsi, 104
+    cmp rcx, rsi
+    jge .LB315
+.LB314:
+    mov rax, 1498212716646461045
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB315:
+    mov rsi, 105
+    cmp rcx, rsi
+    jge .LB317
+.LB316:
+    mov rax, 6023426636313322977
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB317:
+    mov rax, -6338112066351486965
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB318:
+.LB319:
+    jmp .LB327
+.LB320:
+    mov rsi, 107
+    cmp rcx, rsi
+    jge .LB322
+.LB321:
+    mov rax, -6275696437447579415
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB322:
+    mov rsi, 108
+    cmp rcx, rsi
+    jge .LB324
+.LB323:
+    mov rax, 1529263757405973191
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB324:
+    mov rax, 3074457345618258603
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB325:
+.LB326:
+.LB327:
+    jmp .LB344
+.LB328:
+    mov rsi, 112
+    cmp rcx, rsi
+    jge .LB336
+.LB329:
+    mov rsi, 110
+    cmp rcx, rsi
+    jge .LB331
+.LB330:
+    mov rax, 6181107961871263369
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB331:
+    mov rsi, 111
+    cmp rcx, rsi
+    jge .LB333
+.LB332:
+    mov rax, -6019463855631537895
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB333:
+    mov rax, 6246516511732334939
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB334:
+.LB335:
+    jmp .LB343
+.LB336:
+    mov rsi, 113
+    cmp rcx, rsi
+    jge .LB338
+.LB337:
+    mov rax, 6279742663390485657
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB338:
+    mov rsi, 114
+    cmp rcx, rsi
+    jge .LB340
+.LB339:
+    mov rax, 6313324174959418735
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB340:
+    mov rax, 3173633389025299203
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB341:
+.LB342:
+.LB343:
+.LB344:
+.LB345:
+    jmp .LB413
+.LB346:
+    mov rsi, 126
+    cmp rcx, rsi
+    jge .LB378
+.LB347:
+    mov rsi, 120
+    cmp rcx, rsi
+    jge .LB361
+.LB348:
+    mov rsi, 117
+    cmp rcx, rsi
+    jge .LB353
+.LB349:
+    mov rsi, 116
+    cmp rcx, rsi
+    jge .LB351
+.LB350:
+    mov rax, 3190788164101111631
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB351:
+    mov rax, -5614226457215950491
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB352:
+    jmp .LB360
+.LB353:
+    mov rsi, 118
+    cmp rcx, rsi
+    jge .LB355
+.LB354:
+    mov rax, 3225660165894566403
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB355:
+    mov rsi, 119
+    cmp rcx, rsi
+    jge .LB357
+.LB356:
+    mov rax, 3243383573399481603
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB357:
+    mov rax, 407662852457669649
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB358:
+.LB359:
+.LB360:
+    jmp .LB377
+.LB361:
+    mov rsi, 123
+    cmp rcx, rsi
+    jge .LB369
+.LB362:
+    mov rsi, 121
+    cmp rcx, rsi
+    jge .LB364
+.LB363:
+    mov rax, 3279421168659475843
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB364:
+    mov rsi, 122
+    cmp rcx, rsi
+    jge .LB366
+.LB365:
+    mov rax, 6595483914622409517
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB366:
+    mov rax, -5181669683626278543
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB367:
+.LB368:
+    jmp .LB376
+.LB369:
+    mov rsi, 124
+    cmp rcx, rsi
+    jge .LB371
+.LB370:
+    mov rax, -5106725760518463441
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB371:
+    mov rsi, 125
+    cmp rcx, rsi
+    jge .LB373
+.LB372:
+    mov rax, 3353953467947191203
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB373:
+    mov rax, 3373118916335460867
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB374:
+.LB375:
+.LB376:
+.LB377:
+    jmp .LB412
+.LB378:
+    mov rsi, 132
+    cmp rcx, rsi
+    jge .LB395
+.LB379:
+    mov rsi, 129
+    cmp rcx, rsi
+    jge .LB387
+.LB380:
+    mov rsi, 127
+    cmp rcx, rsi
+    jge .LB382
+.LB381:
+    mov rax, -4876725444773789507
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB382:
+    mov rsi, 128
+    cmp rcx, rsi
+    jge .LB384
+.LB383:
+    mov rax, 3412114510743963305
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB384:
+    mov rax, 214497024112901763
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB385:
+.LB386:
+    jmp .LB394
+.LB387:
+    mov rsi, 130
+    cmp rcx, rsi
+    jge .LB389
+.LB388:
+    mov rax, 107875696337482758
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB389:
+    mov rsi, 131
+    cmp rcx, rsi
+    jge .LB391
+.LB390:
+    mov rax, 6944656592455360609
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB391:
+    mov rax, 1746437308753567017
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB392:
+.LB393:
+.LB394:
+    jmp .LB411
+.LB395:
+    mov rsi, 135
+    cmp rcx, rsi
+    jge .LB403
+.LB396:
+    mov rsi, 133
+    cmp rcx, rsi
+    jge .LB398
+.LB397:
+    mov rax, -4392081922311798003
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB398:
+    mov rsi, 134
+    cmp rcx, rsi
+    jge .LB400
+.LB399:
+    mov rax, 7069410902499468883
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB400:
+    mov rax, 3555998857582564167
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB401:
+.LB402:
+    jmp .LB410
+.LB403:
+    mov rsi, 136
+    cmp rcx, rsi
+    jge .LB405
+.LB404:
+    mov rax, -4136542610468202483
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB405:
+    mov rsi, 137
+    cmp rcx, rsi
+    jge .LB407
+.LB406:
+    mov rax, 7198729394618361607
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB407:
+    mov rax, 7242893378634425175
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB408:
+.LB409:
+.LB410:
+.LB411:
+.LB412:
+.LB413:
+    jmp .LB550
+.LB414:
+    mov rsi, 161
+    cmp rcx, rsi
+    jge .LB482
+.LB415:
+    mov rsi, 149
+    cmp rcx, rsi
+    jge .LB447
+.LB416:
+    mov rsi, 143
+    cmp rcx, rsi
+    jge .LB430
+.LB417:
+    mov rsi, 140
+    cmp rcx, rsi
+    jge .LB422
+.LB418:
+    mov rsi, 139
+    cmp rcx, rsi
+    jge .LB420
+.LB419:
+    mov rax, 7287602597021057429
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB420:
+    mov rax, -3781009654859721759
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB421:
+    jmp .LB429
+.LB422:
+    mov rsi, 141
+    cmp rcx, rsi
+    jge .LB424
+.LB423:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB424:
+    mov rsi, 142
+    cmp rcx, rsi
+    jge .LB426
+.LB425:
+    mov rax, 7425104532813907569
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB426:
+    mov rax, 7472098865300071541
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB427:
+.LB428:
+.LB429:
+    jmp .LB446
+.LB430:
+    mov rsi, 146
+    cmp rcx, rsi
+    jge .LB438
+.LB431:
+    mov rsi, 144
+    cmp rcx, rsi
+    jge .LB433
+.LB432:
+    mov rax, 3759845925851628355
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB433:
+    mov rsi, 145
+    cmp rcx, rsi
+    jge .LB435
+.LB434:
+    mov rax, 7567895004598790407
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB435:
+    mov rax, 7616720133660718087
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB436:
+.LB437:
+    jmp .LB445
+.LB438:
+    mov rsi, 147
+    cmp rcx, rsi
+    jge .LB440
+.LB439:
+    mov rax, 7666179355307865607
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB440:
+    mov rsi, 148
+    cmp rcx, rsi
+    jge .LB442
+.LB441:
+    mov rax, 3858142551364089227
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB442:
+    mov rax, 485440633518672411
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB443:
+.LB444:
+.LB445:
+.LB446:
+    jmp .LB481
+.LB447:
+    mov rsi, 155
+    cmp rcx, rsi
+    jge .LB464
+.LB448:
+    mov rsi, 152
+    cmp rcx, rsi
+    jge .LB456
+.LB449:
+    mov rsi, 150
+    cmp rcx, rsi
+    jge .LB451
+.LB450:
+    mov rax, 7818487554419942407
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB451:
+    mov rsi, 151
+    cmp rcx, rsi
+    jge .LB453
+.LB452:
+    mov rax, 7870610804782742023
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB453:
+    mov rax, 1980858424022502187
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB454:
+.LB455:
+    jmp .LB463
+.LB456:
+    mov rsi, 153
+    cmp rcx, rsi
+    jge .LB458
+.LB457:
+    mov rax, 3988485205126389539
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB458:
+    mov rsi, 154
+    cmp rcx, rsi
+    jge .LB460
+.LB459:
+    mov rax, 2007808878771107659
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB460:
+    mov rax, 8086243977516515777
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB461:
+.LB462:
+.LB463:
+    jmp .LB480
+.LB464:
+    mov rsi, 158
+    cmp rcx, rsi
+    jge .LB472
+.LB465:
+    mov rsi, 156
+    cmp rcx, rsi
+    jge .LB467
+.LB466:
+    mov rax, 8142011177361457265
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB467:
+    mov rsi, 157
+    cmp rcx, rsi
+    jge .LB469
+.LB468:
+    mov rax, 1024819115206086201
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB469:
+    mov rax, 1031985682445289601
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB470:
+.LB471:
+    jmp .LB479
+.LB472:
+    mov rsi, 159
+    cmp rcx, rsi
+    jge .LB474
+.LB473:
+    mov rax, 8314025498009938757
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB474:
+    mov rsi, 160
+    cmp rcx, rsi
+    jge .LB476
+.LB475:
+    mov rax, 2093247554463495219
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB476:
+    mov rax, 1054099661354831521
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB477:
+.LB478:
+.LB479:
+.LB480:
+.LB481:
+    jmp .LB549
+.LB482:
+    mov rsi, 172
+    cmp rcx, rsi
+    jge .LB514
+.LB483:
+    mov rsi, 166
+    cmp rcx, rsi
+    jge .LB497
+.LB484:
+    mov rsi, 163
+    cmp rcx, rsi
+    jge .LB489
+.LB485:
+    mov rsi, 162
+    cmp rcx, rsi
+    jge .LB487
+.LB486:
+    mov rax, 4246732448623781667
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB487:
+    mov rax, 8555011744329067417
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB488:
+    jmp .LB496
+.LB489:
+    mov rsi, 164
+    cmp rcx, rsi
+    jge .LB491
+.LB490:
+    mov rax, -1211829902652452295
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB491:
+    mov rsi, 165
+    cmp rcx, rsi
+    jge .LB493
+.LB492:
+    mov rax, 8680820740569200761
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB493:
+    mov rax, 8745123116425268915
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB494:
+.LB495:
+.LB496:
+    jmp .LB513
+.LB497:
+    mov rsi, 169
+    cmp rcx, rsi
+    jge .LB505
+.LB498:
+    mov rsi, 167
+    cmp rcx, rsi
+    jge .LB500
+.LB499:
+    mov rax, 8810385229234412713
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB500:
+    mov rsi, 168
+    cmp rcx, rsi
+    jge .LB502
+.LB501:
+    mov rax, 8876628727198581229
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB502:
+    mov rax, 1117984489315730401
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB503:
+.LB504:
+    jmp .LB512
+.LB505:
+    mov rsi, 170
+    cmp rcx, rsi
+    jge .LB507
+.LB506:
+    mov rax, 281629680514649643
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB507:
+    mov rsi, 171
+    cmp rcx, rsi
+    jge .LB509
+.LB508:
+    mov rax, 1135184250689818561
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB509:
+    mov rax, 142998016075267842
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB510:
+.LB511:
+.LB512:
+.LB513:
+    jmp .LB548
+.LB514:
+    mov rsi, 178
+    cmp rcx, rsi
+    jge .LB531
+.LB515:
+    mov rsi, 175
+    cmp rcx, rsi
+    jge .LB523
+.LB516:
+    mov rsi, 173
+    cmp rcx, rsi
+    jge .LB518
+.LB517:
+    mov rax, rbx
+    cqo
+    shr rdx, 57
+    add rax, rdx
+    sar rax, 7
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB518:
+    mov rsi, 174
+    cmp rcx, rsi
+    jge .LB520
+.LB519:
+    mov rax, 4647998506761461825
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB520:
+    mov rax, -9076969306111049207
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB521:
+.LB522:
+    jmp .LB530
+.LB523:
+    mov rsi, 176
+    cmp rcx, rsi
+    jge .LB525
+.LB524:
+    mov rax, 2361183241434822607
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB525:
+    mov rsi, 177
+    cmp rcx, rsi
+    jge .LB527
+.LB526:
+    mov rax, -8925843906633654007
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB527:
+    mov rax, -8848438214218402807
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB528:
+.LB529:
+.LB530:
+    jmp .LB547
+.LB531:
+    mov rsi, 181
+    cmp rcx, rsi
+    jge .LB539
+.LB532:
+    mov rsi, 179
+    cmp rcx, rsi
+    jge .LB534
+.LB533:
+    mov rax, -8769763576025852407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB534:
+    mov rsi, 180
+    cmp rcx, rsi
+    jge .LB536
+.LB535:
+    mov rax, 4878477771559550841
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB536:
+    mov rax, -8608480567731124087
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB537:
+.LB538:
+    jmp .LB546
+.LB539:
+    mov rsi, 182
+    cmp rcx, rsi
+    jge .LB541
+.LB540:
+    mov rax, -8525806084487607889
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB541:
+    mov rsi, 183
+    cmp rcx, rsi
+    jge .LB543
+.LB542:
+    mov rax, -8441730338816235485
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB543:
+    mov rax, -8356217400911164407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB544:
+.LB545:
+.LB546:
+.LB547:
+.LB548:
+.LB549:
+.LB550:
+.LB551:
+    jmp .LB1105
+.LB552:
+    mov rsi, 276
+    cmp rcx, rsi
+    jge .LB827
+.LB553:
+    mov rsi, 230
+    cmp rcx, rsi
+    jge .LB690
+.LB554:
+    mov rsi, 207
+    cmp rcx, rsi
+    jge .LB622
+.LB555:
+    mov rsi, 195
+    cmp rcx, rsi
+    jge .LB587
+.LB556:
+    mov rsi, 189
+    cmp rcx, rsi
+    jge .LB570
+.LB557:
+    mov rsi, 186
+    cmp rcx, rsi
+    jge .LB562
+.LB558:
+    mov rsi, 185
+    cmp rcx, rsi
+    jge .LB560
+.LB559:
+    mov rax, 5088756985850910791
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB560:
+    mov rax, 2566503523298720225
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB561:
+    jmp .LB569
+.LB562:
+    mov rsi, 187
+    cmp rcx, rsi
+    jge .LB564
+.LB563:
+    mov rax, 161813544506224137
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB564:
+    mov rsi, 188
+    cmp rcx, rsi
+    jge .LB566
+.LB565:
+    mov rax, 5223856728838103113
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB566:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB567:
+.LB568:
+.LB569:
+    jmp .LB586
+.LB570:
+    mov rsi, 192
+    cmp rcx, rsi
+    jge .LB578
+.LB571:
+    mov rsi, 190
+    cmp rcx, rsi
+    jge .LB573
+.LB572:
+    mov rax, -7810783526705846179
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB573:
+    mov rsi, 191
+    cmp rcx, rsi
+    jge .LB575
+.LB574:
+    mov rax, 5366325548715505925
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB575:
+    mov rax, -7615628287311282777
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB576:
+.LB577:
+    jmp .LB585
+.LB578:
+    mov rsi, 193
+    cmp rcx, rsi
+    jge .LB580
+.LB579:
+    mov rax, 341606371735362067
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB580:
+    mov rsi, 194
+    cmp rcx, rsi
+    jge .LB582
+.LB581:
+    mov rax, 1379195818595106663
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB582:
+    mov rax, 5568828399610430677
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB583:
+.LB584:
+.LB585:
+.LB586:
+    jmp .LB621
+.LB587:
+    mov rsi, 201
+    cmp rcx, rsi
+    jge .LB604
+.LB588:
+    mov rsi, 198
+    cmp rcx, rsi
+    jge .LB596
+.LB589:
+    mov rsi, 196
+    cmp rcx, rsi
+    jge .LB591
+.LB590:
+    mov rax, 5621864860559101445
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB591:
+    mov rsi, 197
+    cmp rcx, rsi
+    jge .LB593
+.LB592:
+    mov rax, 5675921253449092805
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB593:
+    mov rax, -6984689503637597213
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB594:
+.LB595:
+    jmp .LB603
+.LB596:
+    mov rsi, 199
+    cmp rcx, rsi
+    jge .LB598
+.LB597:
+    mov rax, -6872316419617283935
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB598:
+    mov rsi, 200
+    cmp rcx, rsi
+    jge .LB600
+.LB599:
+    mov rax, -6757718126012409997
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB600:
+    mov rax, -6640827866535438581
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB601:
+.LB602:
+.LB603:
+    jmp .LB620
+.LB604:
+    mov rsi, 204
+    cmp rcx, rsi
+    jge .LB612
+.LB605:
+    mov rsi, 202
+    cmp rcx, rsi
+    jge .LB607
+.LB606:
+    mov rax, -6521576187675094005
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB607:
+    mov rsi, 203
+    cmp rcx, rsi
+    jge .LB609
+.LB608:
+    mov rax, 6023426636313322977
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB609:
+    mov rax, -6275696437447579415
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB610:
+.LB611:
+    jmp .LB619
+.LB612:
+    mov rsi, 205
+    cmp rcx, rsi
+    jge .LB614
+.LB613:
+    mov rax, 3074457345618258603
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB614:
+    mov rsi, 206
+    cmp rcx, rsi
+    jge .LB616
+.LB615:
+    mov rax, -6019463855631537895
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB616:
+    mov rax, 6279742663390485657
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB617:
+.LB618:
+.LB619:
+.LB620:
+.LB621:
+    jmp .LB689
+.LB622:
+    mov rsi, 218
+    cmp rcx, rsi
+    jge .LB654
+.LB623:
+    mov rsi, 212
+    cmp rcx, rsi
+    jge .LB637
+.LB624:
+    mov rsi, 209
+    cmp rcx, rsi
+    jge .LB629
+.LB625:
+    mov rsi, 208
+    cmp rcx, rsi
+    jge .LB627
+.LB626:
+    mov rax, 3173633389025299203
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB627:
+    mov rax, -5614226457215950491
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB628:
+    jmp .LB636
+.LB629:
+    mov rsi, 210
+    cmp rcx, rsi
+    jge .LB631
+.LB630:
+    mov rax, 3243383573399481603
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB631:
+    mov rsi, 211
+    cmp rcx, rsi
+    jge .LB633
+.LB632:
+    mov rax, 3279421168659475843
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB633:
+    mov rax, -5181669683626278543
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB634:
+.LB635:
+.LB636:
+    jmp .LB653
+.LB637:
+    mov rsi, 215
+    cmp rcx, rsi
+    jge .LB645
+.LB638:
+    mov rsi, 213
+    cmp rcx, rsi
+    jge .LB640
+.LB639:
+    mov rax, 3353953467947191203
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB640:
+    mov rsi, 214
+    cmp rcx, rsi
+    jge .LB642
+.LB641:
+    mov rax, -4876725444773789507
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB642:
+    mov rax, 214497024112901763
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB643:
+.LB644:
+    jmp .LB652
+.LB645:
+    mov rsi, 216
+    cmp rcx, rsi
+    jge .LB647
+.LB646:
+    mov rax, 6944656592455360609
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB647:
+    mov rsi, 217
+    cmp rcx, rsi
+    jge .LB649
+.LB648:
+    mov rax, -4392081922311798003
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB649:
+    mov rax, 3555998857582564167
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB650:
+.LB651:
+.LB652:
+.LB653:
+    jmp .LB688
+.LB654:
+    mov rsi, 224
+    cmp rcx, rsi
+    jge .LB671
+.LB655:
+    mov rsi, 221
+    cmp rcx, rsi
+    jge .LB663
+.LB656:
+    mov rsi, 219
+    cmp rcx, rsi
+    jge .LB658
+.LB657:
+    mov rax, 7198729394618361607
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB658:
+    mov rsi, 220
+    cmp rcx, rsi
+    jge .LB660
+.LB659:
+    mov rax, 7287602597021057429
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB660:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB661:
+.LB662:
+    jmp .LB670
+.LB663:
+    mov rsi, 222
+    cmp rcx, rsi
+    jge .LB665
+.LB664:
+    mov rax, 7472098865300071541
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB665:
+    mov rsi, 223
+    cmp rcx, rsi
+    jge .LB667
+.LB666:
+    mov rax, 7567895004598790407
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB667:
+    mov rax, 7666179355307865607
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB668:
+.LB669:
+.LB670:
+    jmp .LB687
+.LB671:
+    mov rsi, 227
+    cmp rcx, rsi
+    jge .LB679
+.LB672:
+    mov rsi, 225
+    cmp rcx, rsi
+    jge .LB674
+.LB673:
+    mov rax, 485440633518672411
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB674:
+    mov rsi, 226
+    cmp rcx, rsi
+    jge .LB676
+.LB675:
+    mov rax, 7870610804782742023
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB676:
+    mov rax, 3988485205126389539
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB677:
+.LB678:
+    jmp .LB686
+.LB679:
+    mov rsi, 228
+    cmp rcx, rsi
+    jge .LB681
+.LB680:
+    mov rax, 8086243977516515777
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB681:
+    mov rsi, 229
+    cmp rcx, rsi
+    jge .LB683
+.LB682:
+    mov rax, 1024819115206086201
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB683:
+    mov rax, 8314025498009938757
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB684:
+.LB685:
+.LB686:
+.LB687:
+.LB688:
+.LB689:
+    jmp .LB826
+.LB690:
+    mov rsi, 253
+    cmp rcx, rsi
+    jge .LB758
+.LB691:
+    mov rsi, 241
+    cmp rcx, rsi
+    jge .LB723
+.LB692:
+    mov rsi, 235
+    cmp rcx, rsi
+    jge .LB706
+.LB693:
+    mov rsi, 232
+    cmp rcx, rsi
+    jge .LB698
+.LB694:
+    mov rsi, 231
+    cmp rcx, rsi
+    jge .LB696
+.LB695:
+    mov rax, 1054099661354831521
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB696:
+    mov rax, 8555011744329067417
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB697:
+    jmp .LB705
+.LB698:
+    mov rsi, 233
+    cmp rcx, rsi
+    jge .LB700
+.LB699:
+    mov rax, 8680820740569200761
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB700:
+    mov rsi, 234
+    cmp rcx, rsi
+    jge .LB702
+.LB701:
+    mov rax, 8810385229234412713
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB702:
+    mov rax, 1117984489315730401
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB703:
+.LB704:
+.LB705:
+    jmp .LB722
+.LB706:
+    mov rsi, 238
+    cmp rcx, rsi
+    jge .LB714
+.LB707:
+    mov rsi, 236
+    cmp rcx, rsi
+    jge .LB709
+.LB708:
+    mov rax, 1135184250689818561
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB709:
+    mov rsi, 237
+    cmp rcx, rsi
+    jge .LB711
+.LB710:
+    mov rax, rbx
+    cqo
+    shr rdx, 58
+    add rax, rdx
+    sar rax, 6
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB711:
+    mov rax, -9076969306111049207
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB712:
+.LB713:
+    jmp .LB721
+.LB714:
+    mov rsi, 239
+    cmp rcx, rsi
+    jge .LB716
+.LB715:
+    mov rax, -8925843906633654007
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB716:
+    mov rsi, 240
+    cmp rcx, rsi
+    jge .LB718
+.LB717:
+    mov rax, -8769763576025852407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB718:
+    mov rax, -8608480567731124087
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB719:
+.LB720:
+.LB721:
+.LB722:
+    jmp .LB757
+.LB723:
+    mov rsi, 247
+    cmp rcx, rsi
+    jge .LB740
+.LB724:
+    mov rsi, 244
+    cmp rcx, rsi
+    jge .LB732
+.LB725:
+    mov rsi, 242
+    cmp rcx, rsi
+    jge .LB727
+.LB726:
+    mov rax, -8441730338816235485
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB727:
+    mov rsi, 243
+    cmp rcx, rsi
+    jge .LB729
+.LB728:
+    mov rax, 5088756985850910791
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB729:
+    mov rax, 323627089012448274
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB730:
+.LB731:
+    jmp .LB739
+.LB732:
+    mov rsi, 245
+    cmp rcx, rsi
+    jge .LB734
+.LB733:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB734:
+    mov rsi, 246
+    cmp rcx, rsi
+    jge .LB736
+.LB735:
+    mov rax, 5366325548715505925
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB736:
+    mov rax, 341606371735362067
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB737:
+.LB738:
+.LB739:
+    jmp .LB756
+.LB740:
+    mov rsi, 250
+    cmp rcx, rsi
+    jge .LB748
+.LB741:
+    mov rsi, 248
+    cmp rcx, rsi
+    jge .LB743
+.LB742:
+    mov rax, 5568828399610430677
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB743:
+    mov rsi, 249
+    cmp rcx, rsi
+    jge .LB745
+.LB744:
+    mov rax, 5675921253449092805
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB745:
+    mov rax, -6872316419617283935
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB746:
+.LB747:
+    jmp .LB755
+.LB748:
+    mov rsi, 251
+    cmp rcx, rsi
+    jge .LB750
+.LB749:
+    mov rax, -6640827866535438581
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB750:
+    mov rsi, 252
+    cmp rcx, rsi
+    jge .LB752
+.LB751:
+    mov rax, 6023426636313322977
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB752:
+    mov rax, 3074457345618258603
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB753:
+.LB754:
+.LB755:
+.LB756:
+.LB757:
+    jmp .LB825
+.LB758:
+    mov rsi, 264
+    cmp rcx, rsi
+    jge .LB790
+.LB759:
+    mov rsi, 258
+    cmp rcx, rsi
+    jge .LB773
+.LB760:
+    mov rsi, 255
+    cmp rcx, rsi
+    jge .LB765
+.LB761:
+    mov rsi, 254
+    cmp rcx, rsi
+    jge .LB763
+.LB762:
+    mov rax, 6279742663390485657
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB763:
+    mov rax, -5614226457215950491
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB764:
+    jmp .LB772
+.LB765:
+    mov rsi, 256
+    cmp rcx, rsi
+    jge .LB767
+.LB766:
+    mov rax, 3279421168659475843
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB767:
+    mov rsi, 257
+    cmp rcx, rsi
+    jge .LB769
+.LB768:
+    mov rax, 3353953467947191203
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB769:
+    mov rax, 428994048225803526
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB770:
+.LB771:
+.LB772:
+    jmp .LB789
+.LB773:
+    mov rsi, 261
+    cmp rcx, rsi
+    jge .LB781
+.LB774:
+    mov rsi, 259
+    cmp rcx, rsi
+    jge .LB776
+.LB775:
+    mov rax, -4392081922311798003
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB776:
+    mov rsi, 260
+    cmp rcx, rsi
+    jge .LB778
+.LB777:
+    mov rax, 7198729394618361607
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB778:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB779:
+.LB780:
+    jmp .LB788
+.LB781:
+    mov rsi, 262
+    cmp rcx, rsi
+    jge .LB783
+.LB782:
+    mov rax, 7567895004598790407
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB783:
+    mov rsi, 263
+    cmp rcx, rsi
+    jge .LB785
+.LB784:
+    mov rax, 485440633518672411
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB785:
+    mov rax, 3988485205126389539
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB786:
+.LB787:
+.LB788:
+.LB789:
+    jmp .LB824
+.LB790:
+    mov rsi, 270
+    cmp rcx, rsi
+    jge .LB807
+.LB791:
+    mov rsi, 267
+    cmp rcx, rsi
+    jge .LB799
+.LB792:
+    mov rsi, 265
+    cmp rcx, rsi
+    jge .LB794
+.LB793:
+    mov rax, 1024819115206086201
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB794:
+    mov rsi, 266
+    cmp rcx, rsi
+    jge .LB796
+.LB795:
+    mov rax, 1054099661354831521
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB796:
+    mov rax, 8680820740569200761
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB797:
+.LB798:
+    jmp .LB806
+.LB799:
+    mov rsi, 268
+    cmp rcx, rsi
+    jge .LB801
+.LB800:
+    mov rax, 1117984489315730401
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB801:
+    mov rsi, 269
+    cmp rcx, rsi
+    jge .LB803
+.LB802:
+    mov rax, rbx
+    cqo
+    shr rdx, 59
+    add rax, rdx
+    sar rax, 5
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB803:
+    mov rax, -8925843906633654007
+    imul rbx
+    add rdx, rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB804:
+.LB805:
+.LB806:
+    jmp .LB823
+.LB807:
+    mov rsi, 273
+    cmp rcx, rsi
+    jge .LB815
+.LB808:
+    mov rsi, 271
+    cmp rcx, rsi
+    jge .LB810
+.LB809:
+    mov rax, -8608480567731124087
+    imul rbx
+    add rdx, rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB810:
+    mov rsi, 272
+    cmp rcx, rsi
+    jge .LB812
+.LB811:
+    mov rax, 5088756985850910791
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB812:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB813:
+.LB814:
+    jmp .LB822
+.LB815:
+    mov rsi, 274
+    cmp rcx, rsi
+    jge .LB817
+.LB816:
+    mov rax, 683212743470724134
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB817:
+    mov rsi, 275
+    cmp rcx, rsi
+    jge .LB819
+.LB818:
+    mov rax, 5675921253449092805
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB819:
+    mov rax, -6640827866535438581
+    imul rbx
+    add rdx, rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB820:
+.LB821:
+.LB822:
+.LB823:
+.LB824:
+.LB825:
+.LB826:
+    jmp .LB1104
+.LB827:
+    mov rsi, 322
+    cmp rcx, rsi
+    jge .LB964
+.LB828:
+    mov rsi, 299
+    cmp rcx, rsi
+    jge .LB896
+.LB829:
+    mov rsi, 287
+    cmp rcx, rsi
+    jge .LB861
+.LB830:
+    mov rsi, 281
+    cmp rcx, rsi
+    jge .LB844
+.LB831:
+    mov rsi, 278
+    cmp rcx, rsi
+    jge .LB836
+.LB832:
+    mov rsi, 277
+    cmp rcx, rsi
+    jge .LB834
+.LB833:
+    mov rax, 3074457345618258603
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB834:
+    mov rax, -5614226457215950491
+    imul rbx
+    add rdx, rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB835:
+    jmp .LB843
+.LB836:
+    mov rsi, 279
+    cmp rcx, rsi
+    jge .LB838
+.LB837:
+    mov rax, 3353953467947191203
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB838:
+    mov rsi, 280
+    cmp rcx, rsi
+    jge .LB840
+.LB839:
+    mov rax, -4392081922311798003
+    imul rbx
+    add rdx, rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB840:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB841:
+.LB842:
+.LB843:
+    jmp .LB860
+.LB844:
+    mov rsi, 284
+    cmp rcx, rsi
+    jge .LB852
+.LB845:
+    mov rsi, 282
+    cmp rcx, rsi
+    jge .LB847
+.LB846:
+    mov rax, 970881267037344822
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB847:
+    mov rsi, 283
+    cmp rcx, rsi
+    jge .LB849
+.LB848:
+    mov rax, 1024819115206086201
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB849:
+    mov rax, 8680820740569200761
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB850:
+.LB851:
+    jmp .LB859
+.LB852:
+    mov rsi, 285
+    cmp rcx, rsi
+    jge .LB854
+.LB853:
+    mov rax, rbx
+    cqo
+    shr rdx, 60
+    add rax, rdx
+    sar rax, 4
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB854:
+    mov rsi, 286
+    cmp rcx, rsi
+    jge .LB856
+.LB855:
+    mov rax, -8608480567731124087
+    imul rbx
+    add rdx, rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB856:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB857:
+.LB858:
+.LB859:
+.LB860:
+    jmp .LB895
+.LB861:
+    mov rsi, 293
+    cmp rcx, rsi
+    jge .LB878
+.LB862:
+    mov rsi, 290
+    cmp rcx, rsi
+    jge .LB870
+.LB863:
+    mov rsi, 288
+    cmp rcx, rsi
+    jge .LB865
+.LB864:
+    mov rax, 5675921253449092805
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB865:
+    mov rsi, 289
+    cmp rcx, rsi
+    jge .LB867
+.LB866:
+    mov rax, 3074457345618258603
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB867:
+    mov rax, 3353953467947191203
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB868:
+.LB869:
+    jmp .LB877
+.LB870:
+    mov rsi, 291
+    cmp rcx, rsi
+    jge .LB872
+.LB871:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB872:
+    mov rsi, 292
+    cmp rcx, rsi
+    jge .LB874
+.LB873:
+    mov rax, 2049638230412172402
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB874:
+    mov rax, rbx
+    cqo
+    shr rdx, 61
+    add rax, rdx
+    sar rax, 3
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB875:
+.LB876:
+.LB877:
+    jmp .LB894
+.LB878:
+    mov rsi, 296
+    cmp rcx, rsi
+    jge .LB886
+.LB879:
+    mov rsi, 294
+    cmp rcx, rsi
+    jge .LB881
+.LB880:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB881:
+    mov rsi, 295
+    cmp rcx, rsi
+    jge .LB883
+.LB882:
+    mov rax, 3074457345618258603
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB883:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB884:
+.LB885:
+    jmp .LB893
+.LB886:
+    mov rsi, 297
+    cmp rcx, rsi
+    jge .LB888
+.LB887:
+    mov rax, rbx
+    cqo
+    shr rdx, 62
+    add rax, rdx
+    sar rax, 2
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB888:
+    mov rsi, 298
+    cmp rcx, rsi
+    jge .LB890
+.LB889:
+    mov rax, 6148914691236517206
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB890:
+    mov rax, rbx
+    cqo
+    shr rdx, 63
+    add rax, rdx
+    sar rax, 1
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB891:
+.LB892:
+.LB893:
+.LB894:
+.LB895:
+    jmp .LB963
+.LB896:
+    mov rsi, 310
+    cmp rcx, rsi
+    jge .LB928
+.LB897:
+    mov rsi, 304
+    cmp rcx, rsi
+    jge .LB911
+.LB898:
+    mov rsi, 301
+    cmp rcx, rsi
+    jge .LB903
+.LB899:
+    mov rsi, 300
+    cmp rcx, rsi
+    jge .LB901
+.LB900:
+    mov rax, rbx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB901:
+    mov rsi, 0
+    mov rax, rsi
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB902:
+    jmp .LB910
+.LB903:
+    mov rsi, 302
+    cmp rcx, rsi
+    jge .LB905
+.LB904:
+    mov rax, rbx
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB905:
+    mov rsi, 303
+    cmp rcx, rsi
+    jge .LB907
+.LB906:
+    mov rax, rbx
+    cqo
+    shr rdx, 63
+    add rax, rdx
+    sar rax, 1
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB907:
+    mov rax, 6148914691236517206
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB908:
+.LB909:
+.LB910:
+    jmp .LB927
+.LB911:
+    mov rsi, 307
+    cmp rcx, rsi
+    jge .LB919
+.LB912:
+    mov rsi, 305
+    cmp rcx, rsi
+    jge .LB914
+.LB913:
+    mov rax, rbx
+    cqo
+    shr rdx, 62
+    add rax, rdx
+    sar rax, 2
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB914:
+    mov rsi, 306
+    cmp rcx, rsi
+    jge .LB916
+.LB915:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB916:
+    mov rax, 3074457345618258603
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB917:
+.LB918:
+    jmp .LB926
+.LB919:
+    mov rsi, 308
+    cmp rcx, rsi
+    jge .LB921
+.LB920:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB921:
+    mov rsi, 309
+    cmp rcx, rsi
+    jge .LB923
+.LB922:
+    mov rax, rbx
+    cqo
+    shr rdx, 61
+    add rax, rdx
+    sar rax, 3
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB923:
+    mov rax, 2049638230412172402
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB924:
+.LB925:
+.LB926:
+.LB927:
+    jmp .LB962
+.LB928:
+    mov rsi, 316
+    cmp rcx, rsi
+    jge .LB945
+.LB929:
+    mov rsi, 313
+    cmp rcx, rsi
+    jge .LB937
+.LB930:
+    mov rsi, 311
+    cmp rcx, rsi
+    jge .LB932
+.LB931:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB932:
+    mov rsi, 312
+    cmp rcx, rsi
+    jge .LB934
+.LB933:
+    mov rax, 3353953467947191203
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB934:
+    mov rax, 3074457345618258603
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB935:
+.LB936:
+    jmp .LB944
+.LB937:
+    mov rsi, 314
+    cmp rcx, rsi
+    jge .LB939
+.LB938:
+    mov rax, 5675921253449092805
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB939:
+    mov rsi, 315
+    cmp rcx, rsi
+    jge .LB941
+.LB940:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB941:
+    mov rax, -8608480567731124087
+    imul rbx
+    add rdx, rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB942:
+.LB943:
+.LB944:
+    jmp .LB961
+.LB945:
+    mov rsi, 319
+    cmp rcx, rsi
+    jge .LB953
+.LB946:
+    mov rsi, 317
+    cmp rcx, rsi
+    jge .LB948
+.LB947:
+    mov rax, rbx
+    cqo
+    shr rdx, 60
+    add rax, rdx
+    sar rax, 4
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB948:
+    mov rsi, 318
+    cmp rcx, rsi
+    jge .LB950
+.LB949:
+    mov rax, 8680820740569200761
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB950:
+    mov rax, 1024819115206086201
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB951:
+.LB952:
+    jmp .LB960
+.LB953:
+    mov rsi, 320
+    cmp rcx, rsi
+    jge .LB955
+.LB954:
+    mov rax, 970881267037344822
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB955:
+    mov rsi, 321
+    cmp rcx, rsi
+    jge .LB957
+.LB956:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB957:
+    mov rax, -4392081922311798003
+    imul rbx
+    add rdx, rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB958:
+.LB959:
+.LB960:
+.LB961:
+.LB962:
+.LB963:
+    jmp .LB1103
+.LB964:
+    mov rsi, 345
+    cmp rcx, rsi
+    jge .LB1032
+.LB965:
+    mov rsi, 333
+    cmp rcx, rsi
+    jge .LB997
+.LB966:
+    mov rsi, 327
+    cmp rcx, rsi
+    jge .LB980
+.LB967:
+    mov rsi, 324
+    cmp rcx, rsi
+    jge .LB972
+.LB968:
+    mov rsi, 323
+    cmp rcx, rsi
+    jge .LB970
+.LB969:
+    mov rax, 3353953467947191203
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB970:
+    mov rax, -5614226457215950491
+    imul rbx
+    add rdx, rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB971:
+    jmp .LB979
+.LB972:
+    mov rsi, 325
+    cmp rcx, rsi
+    jge .LB974
+.LB973:
+    mov rax, 3074457345618258603
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB974:
+    mov rsi, 326
+    cmp rcx, rsi
+    jge .LB976
+.LB975:
+    mov rax, -6640827866535438581
+    imul rbx
+    add rdx, rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB976:
+    mov rax, 5675921253449092805
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB977:
+.LB978:
+.LB979:
+    jmp .LB996
+.LB980:
+    mov rsi, 330
+    cmp rcx, rsi
+    jge .LB988
+.LB981:
+    mov rsi, 328
+    cmp rcx, rsi
+    jge .LB983
+.LB982:
+    mov rax, 683212743470724134
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB983:
+    mov rsi, 329
+    cmp rcx, rsi
+    jge .LB985
+.LB984:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB985:
+    mov rax, 5088756985850910791
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB986:
+.LB987:
+    jmp .LB995
+.LB988:
+    mov rsi, 331
+    cmp rcx, rsi
+    jge .LB990
+.LB989:
+    mov rax, -8608480567731124087
+    imul rbx
+    add rdx, rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB990:
+    mov rsi, 332
+    cmp rcx, rsi
+    jge .LB992
+.LB991:
+    mov rax, -8925843906633654007
+    imul rbx
+    add rdx, rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB992:
+    mov rax, rbx
+    cqo
+    shr rdx, 59
+    add rax, rdx
+    sar rax, 5
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB993:
+.LB994:
+.LB995:
+.LB996:
+    jmp .LB1031
+.LB997:
+    mov rsi, 339
+    cmp rcx, rsi
+    jge .LB1014
+.LB998:
+    mov rsi, 336
+    cmp rcx, rsi
+    jge .LB1006
+.LB999:
+    mov rsi, 334
+    cmp rcx, rsi
+    jge .LB1001
+.LB1000:
+    mov rax, 1117984489315730401
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1001:
+    mov rsi, 335
+    cmp rcx, rsi
+    jge .LB1003
+.LB1002:
+    mov rax, 8680820740569200761
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1003:
+    mov rax, 1054099661354831521
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1004:
+.LB1005:
+    jmp .LB1013
+.LB1006:
+    mov rsi, 337
+    cmp rcx, rsi
+    jge .LB1008
+.LB1007:
+    mov rax, 1024819115206086201
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1008:
+    mov rsi, 338
+    cmp rcx, rsi
+    jge .LB1010
+.LB1009:
+    mov rax, 3988485205126389539
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1010:
+    mov rax, 485440633518672411
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1011:
+.LB1012:
+.LB1013:
+    jmp .LB1030
+.LB1014:
+    mov rsi, 342
+    cmp rcx, rsi
+    jge .LB1022
+.LB1015:
+    mov rsi, 340
+    cmp rcx, rsi
+    jge .LB1017
+.LB1016:
+    mov rax, 7567895004598790407
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1017:
+    mov rsi, 341
+    cmp rcx, rsi
+    jge .LB1019
+.LB1018:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1019:
+    mov rax, 7198729394618361607
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1020:
+.LB1021:
+    jmp .LB1029
+.LB1022:
+    mov rsi, 343
+    cmp rcx, rsi
+    jge .LB1024
+.LB1023:
+    mov rax, -4392081922311798003
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1024:
+    mov rsi, 344
+    cmp rcx, rsi
+    jge .LB1026
+.LB1025:
+    mov rax, 428994048225803526
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1026:
+    mov rax, 3353953467947191203
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1027:
+.LB1028:
+.LB1029:
+.LB1030:
+.LB1031:
+    jmp .LB1102
+.LB1032:
+    mov rsi, 357
+    cmp rcx, rsi
+    jge .LB1067
+.LB1033:
+    mov rsi, 351
+    cmp rcx, rsi
+    jge .LB1050
+.LB1034:
+    mov rsi, 348
+    cmp rcx, rsi
+    jge .LB1042
+.LB1035:
+    mov rsi, 346
+    cmp rcx, rsi
+    jge .LB1037
+.LB1036:
+    mov rax, 3279421168659475843
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1037:
+    mov rsi, 347
+    cmp rcx, rsi
+    jge .LB1039
+.LB1038:
+    mov rax, -5614226457215950491
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1039:
+    mov rax, 6279742663390485657
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1040:
+.LB1041:
+    jmp .LB1049
+.LB1042:
+    mov rsi, 349
+    cmp rcx, rsi
+    jge .LB1044
+.LB1043:
+    mov rax, 3074457345618258603
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1044:
+    mov rsi, 350
+    cmp rcx, rsi
+    jge .LB1046
+.LB1045:
+    mov rax, 6023426636313322977
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1046:
+    mov rax, -6640827866535438581
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1047:
+.LB1048:
+.LB1049:
+    jmp .LB1066
+.LB1050:
+    mov rsi, 354
+    cmp rcx, rsi
+    jge .LB1058
+.LB1051:
+    mov rsi, 352
+    cmp rcx, rsi
+    jge .LB1053
+.LB1052:
+    mov rax, -6872316419617283935
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1053:
+    mov rsi, 353
+    cmp rcx, rsi
+    jge .LB1055
+.LB1054:
+    mov rax, 5675921253449092805
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1055:
+    mov rax, 5568828399610430677
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1056:
+.LB1057:
+    jmp .LB1065
+.LB1058:
+    mov rsi, 355
+    cmp rcx, rsi
+    jge .LB1060
+.LB1059:
+    mov rax, 341606371735362067
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1060:
+    mov rsi, 356
+    cmp rcx, rsi
+    jge .LB1062
+.LB1061:
+    mov rax, 5366325548715505925
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1062:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1063:
+.LB1064:
+.LB1065:
+.LB1066:
+    jmp .LB1101
+.LB1067:
+    mov rsi, 363
+    cmp rcx, rsi
+    jge .LB1084
+.LB1068:
+    mov rsi, 360
+    cmp rcx, rsi
+    jge .LB1076
+.LB1069:
+    mov rsi, 358
+    cmp rcx, rsi
+    jge .LB1071
+.LB1070:
+    mov rax, 323627089012448274
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1071:
+    mov rsi, 359
+    cmp rcx, rsi
+    jge .LB1073
+.LB1072:
+    mov rax, 5088756985850910791
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1073:
+    mov rax, -8441730338816235485
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1074:
+.LB1075:
+    jmp .LB1083
+.LB1076:
+    mov rsi, 361
+    cmp rcx, rsi
+    jge .LB1078
+.LB1077:
+    mov rax, -8608480567731124087
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1078:
+    mov rsi, 362
+    cmp rcx, rsi
+    jge .LB1080
+.LB1079:
+    mov rax, -8769763576025852407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1080:
+    mov rax, -8925843906633654007
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1081:
+.LB1082:
+.LB1083:
+    jmp .LB1100
+.LB1084:
+    mov rsi, 366
+    cmp rcx, rsi
+    jge .LB1092
+.LB1085:
+    mov rsi, 364
+    cmp rcx, rsi
+    jge .LB1087
+.LB1086:
+    mov rax, -9076969306111049207
+    imul rbx
+    add rdx, rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1087:
+    mov rsi, 365
+    cmp rcx, rsi
+    jge .LB1089
+.LB1088:
+    mov rax, rbx
+    cqo
+    shr rdx, 58
+    add rax, rdx
+    sar rax, 6
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1089:
+    mov rax, 1135184250689818561
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1090:
+.LB1091:
+    jmp .LB1099
+.LB1092:
+    mov rsi, 367
+    cmp rcx, rsi
+    jge .LB1094
+.LB1093:
+    mov rax, 1117984489315730401
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1094:
+    mov rsi, 368
+    cmp rcx, rsi
+    jge .LB1096
+.LB1095:
+    mov rax, 8810385229234412713
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1096:
+    mov rax, 8680820740569200761
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1097:
+.LB1098:
+.LB1099:
+.LB1100:
+.LB1101:
+.LB1102:
+.LB1103:
+.LB1104:
+.LB1105:
+    jmp .LB2214
+.LB1106:
+    mov rsi, 554
+    cmp rcx, rsi
+    jge .LB1660
+.LB1107:
+    mov rsi, 461
+    cmp rcx, rsi
+    jge .LB1382
+.LB1108:
+    mov rsi, 415
+    cmp rcx, rsi
+    jge .LB1245
+.LB1109:
+    mov rsi, 392
+    cmp rcx, rsi
+    jge .LB1177
+.LB1110:
+    mov rsi, 380
+    cmp rcx, rsi
+    jge .LB1142
+.LB1111:
+    mov rsi, 374
+    cmp rcx, rsi
+    jge .LB1125
+.LB1112:
+    mov rsi, 371
+    cmp rcx, rsi
+    jge .LB1117
+.LB1113:
+    mov rsi, 370
+    cmp rcx, rsi
+    jge .LB1115
+.LB1114:
+    mov rax, 8555011744329067417
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1115:
+    mov rax, 1054099661354831521
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1116:
+    jmp .LB1124
+.LB1117:
+    mov rsi, 372
+    cmp rcx, rsi
+    jge .LB1119
+.LB1118:
+    mov rax, 8314025498009938757
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1119:
+    mov rsi, 373
+    cmp rcx, rsi
+    jge .LB1121
+.LB1120:
+    mov rax, 1024819115206086201
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1121:
+    mov rax, 8086243977516515777
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1122:
+.LB1123:
+.LB1124:
+    jmp .LB1141
+.LB1125:
+    mov rsi, 377
+    cmp rcx, rsi
+    jge .LB1133
+.LB1126:
+    mov rsi, 375
+    cmp rcx, rsi
+    jge .LB1128
+.LB1127:
+    mov rax, 3988485205126389539
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1128:
+    mov rsi, 376
+    cmp rcx, rsi
+    jge .LB1130
+.LB1129:
+    mov rax, 7870610804782742023
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1130:
+    mov rax, 485440633518672411
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1131:
+.LB1132:
+    jmp .LB1140
+.LB1133:
+    mov rsi, 378
+    cmp rcx, rsi
+    jge .LB1135
+.LB1134:
+    mov rax, 7666179355307865607
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1135:
+    mov rsi, 379
+    cmp rcx, rsi
+    jge .LB1137
+.LB1136:
+    mov rax, 7567895004598790407
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1137:
+    mov rax, 7472098865300071541
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1138:
+.LB1139:
+.LB1140:
+.LB1141:
+    jmp .LB1176
+.LB1142:
+    mov rsi, 386
+    cmp rcx, rsi
+    jge .LB1159
+.LB1143:
+    mov rsi, 383
+    cmp rcx, rsi
+    jge .LB1151
+.LB1144:
+    mov rsi, 381
+    cmp rcx, rsi
+    jge .LB1146
+.LB1145:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1146:
+    mov rsi, 382
+    cmp rcx, rsi
+    jge .LB1148
+.LB1147:
+    mov rax, 7287602597021057429
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1148:
+    mov rax, 7198729394618361607
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1149:
+.LB1150:
+    jmp .LB1158
+.LB1151:
+    mov rsi, 384
+    cmp rcx, rsi
+    jge .LB1153
+.LB1152:
+    mov rax, 3555998857582564167
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1153:
+    mov rsi, 385
+    cmp rcx, rsi
+    jge .LB1155
+.LB1154:
+    mov rax, -4392081922311798003
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1155:
+    mov rax, 6944656592455360609
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1156:
+.LB1157:
+.LB1158:
+    jmp .LB1175
+.LB1159:
+    mov rsi, 389
+    cmp rcx, rsi
+    jge .LB1167
+.LB1160:
+    mov rsi, 387
+    cmp rcx, rsi
+    jge .LB1162
+.LB1161:
+    mov rax, 214497024112901763
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1162:
+    mov rsi, 388
+    cmp rcx, rsi
+    jge .LB1164
+.LB1163:
+    mov rax, -4876725444773789507
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1164:
+    mov rax, 3353953467947191203
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1165:
+.LB1166:
+    jmp .LB1174
+.LB1167:
+    mov rsi, 390
+    cmp rcx, rsi
+    jge .LB1169
+.LB1168:
+    mov rax, -5181669683626278543
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1169:
+    mov rsi, 391
+    cmp rcx, rsi
+    jge .LB1171
+.LB1170:
+    mov rax, 3279421168659475843
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1171:
+    mov rax, 3243383573399481603
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1172:
+.LB1173:
+.LB1174:
+.LB1175:
+.LB1176:
+    jmp .LB1244
+.LB1177:
+    mov rsi, 403
+    cmp rcx, rsi
+    jge .LB1209
+.LB1178:
+    mov rsi, 397
+    cmp rcx, rsi
+    jge .LB1192
+.LB1179:
+    mov rsi, 394
+    cmp rcx, rsi
+    jge .LB1184
+.LB1180:
+    mov rsi, 393
+    cmp rcx, rsi
+    jge .LB1182
+.LB1181:
+    mov rax, -5614226457215950491
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1182:
+    mov rax, 3173633389025299203
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1183:
+    jmp .LB1191
+.LB1184:
+    mov rsi, 395
+    cmp rcx, rsi
+    jge .LB1186
+.LB1185:
+    mov rax, 6279742663390485657
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1186:
+    mov rsi, 396
+    cmp rcx, rsi
+    jge .LB1188
+.LB1187:
+    mov rax, -6019463855631537895
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1188:
+    mov rax, 3074457345618258603
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1189:
+.LB1190:
+.LB1191:
+    jmp .LB1208
+.LB1192:
+    mov rsi, 400
+    cmp rcx, rsi
+    jge .LB1200
+.LB1193:
+    mov rsi, 398
+    cmp rcx, rsi
+    jge .LB1195
+.LB1194:
+    mov rax, -6275696437447579415
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1195:
+    mov rsi, 399
+    cmp rcx, rsi
+    jge .LB1197
+.LB1196:
+    mov rax, 6023426636313322977
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1197:
+    mov rax, -6521576187675094005
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1198:
+.LB1199:
+    jmp .LB1207
+.LB1200:
+    mov rsi, 401
+    cmp rcx, rsi
+    jge .LB1202
+.LB1201:
+    mov rax, -6640827866535438581
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1202:
+    mov rsi, 402
+    cmp rcx, rsi
+    jge .LB1204
+.LB1203:
+    mov rax, -6757718126012409997
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1204:
+    mov rax, -6872316419617283935
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1205:
+.LB1206:
+.LB1207:
+.LB1208:
+    jmp .LB1243
+.LB1209:
+    mov rsi, 409
+    cmp rcx, rsi
+    jge .LB1226
+.LB1210:
+    mov rsi, 406
+    cmp rcx, rsi
+    jge .LB1218
+.LB1211:
+    mov rsi, 404
+    cmp rcx, rsi
+    jge .LB1213
+.LB1212:
+    mov rax, -6984689503637597213
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1213:
+    mov rsi, 405
+    cmp rcx, rsi
+    jge .LB1215
+.LB1214:
+    mov rax, 5675921253449092805
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1215:
+    mov rax, 5621864860559101445
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1216:
+.LB1217:
+    jmp .LB1225
+.LB1218:
+    mov rsi, 407
+    cmp rcx, rsi
+    jge .LB1220
+.LB1219:
+    mov rax, 5568828399610430677
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1220:
+    mov rsi, 408
+    cmp rcx, rsi
+    jge .LB1222
+.LB1221:
+    mov rax, 1379195818595106663
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1222:
+    mov rax, 341606371735362067
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1223:
+.LB1224:
+.LB1225:
+    jmp .LB1242
+.LB1226:
+    mov rsi, 412
+    cmp rcx, rsi
+    jge .LB1234
+.LB1227:
+    mov rsi, 410
+    cmp rcx, rsi
+    jge .LB1229
+.LB1228:
+    mov rax, -7615628287311282777
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1229:
+    mov rsi, 411
+    cmp rcx, rsi
+    jge .LB1231
+.LB1230:
+    mov rax, 5366325548715505925
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1231:
+    mov rax, -7810783526705846179
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1232:
+.LB1233:
+    jmp .LB1241
+.LB1234:
+    mov rsi, 413
+    cmp rcx, rsi
+    jge .LB1236
+.LB1235:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1236:
+    mov rsi, 414
+    cmp rcx, rsi
+    jge .LB1238
+.LB1237:
+    mov rax, 5223856728838103113
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1238:
+    mov rax, 161813544506224137
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1239:
+.LB1240:
+.LB1241:
+.LB1242:
+.LB1243:
+.LB1244:
+    jmp .LB1381
+.LB1245:
+    mov rsi, 438
+    cmp rcx, rsi
+    jge .LB1313
+.LB1246:
+    mov rsi, 426
+    cmp rcx, rsi
+    jge .LB1278
+.LB1247:
+    mov rsi, 420
+    cmp rcx, rsi
+    jge .LB1261
+.LB1248:
+    mov rsi, 417
+    cmp rcx, rsi
+    jge .LB1253
+.LB1249:
+    mov rsi, 416
+    cmp rcx, rsi
+    jge .LB1251
+.LB1250:
+    mov rax, 2566503523298720225
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1251:
+    mov rax, 5088756985850910791
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1252:
+    jmp .LB1260
+.LB1253:
+    mov rsi, 418
+    cmp rcx, rsi
+    jge .LB1255
+.LB1254:
+    mov rax, -8356217400911164407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1255:
+    mov rsi, 419
+    cmp rcx, rsi
+    jge .LB1257
+.LB1256:
+    mov rax, -8441730338816235485
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1257:
+    mov rax, -8525806084487607889
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1258:
+.LB1259:
+.LB1260:
+    jmp .LB1277
+.LB1261:
+    mov rsi, 423
+    cmp rcx, rsi
+    jge .LB1269
+.LB1262:
+    mov rsi, 421
+    cmp rcx, rsi
+    jge .LB1264
+.LB1263:
+    mov rax, -8608480567731124087
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1264:
+    mov rsi, 422
+    cmp rcx, rsi
+    jge .LB1266
+.LB1265:
+    mov rax, 4878477771559550841
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1266:
+    mov rax, -8769763576025852407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1267:
+.LB1268:
+    jmp .LB1276
+.LB1269:
+    mov rsi, 424
+    cmp rcx, rsi
+    jge .LB1271
+.LB1270:
+    mov rax, -8848438214218402807
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1271:
+    mov rsi, 425
+    cmp rcx, rsi
+    jge .LB1273
+.LB1272:
+    mov rax, -8925843906633654007
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1273:
+    mov rax, 2361183241434822607
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1274:
+.LB1275:
+.LB1276:
+.LB1277:
+    jmp .LB1312
+.LB1278:
+    mov rsi, 432
+    cmp rcx, rsi
+    jge .LB1295
+.LB1279:
+    mov rsi, 429
+    cmp rcx, rsi
+    jge .LB1287
+.LB1280:
+    mov rsi, 427
+    cmp rcx, rsi
+    jge .LB1282
+.LB1281:
+    mov rax, -9076969306111049207
+    imul rbx
+    add rdx, rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1282:
+    mov rsi, 428
+    cmp rcx, rsi
+    jge .LB1284
+.LB1283:
+    mov rax, 4647998506761461825
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1284:
+    mov rax, rbx
+    cqo
+    shr rdx, 57
+    add rax, rdx
+    sar rax, 7
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1285:
+.LB1286:
+    jmp .LB1294
+.LB1287:
+    mov rsi, 430
+    cmp rcx, rsi
+    jge .LB1289
+.LB1288:
+    mov rax, 142998016075267842
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1289:
+    mov rsi, 431
+    cmp rcx, rsi
+    jge .LB1291
+.LB1290:
+    mov rax, 1135184250689818561
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1291:
+    mov rax, 281629680514649643
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1292:
+.LB1293:
+.LB1294:
+    jmp .LB1311
+.LB1295:
+    mov rsi, 435
+    cmp rcx, rsi
+    jge .LB1303
+.LB1296:
+    mov rsi, 433
+    cmp rcx, rsi
+    jge .LB1298
+.LB1297:
+    mov rax, 1117984489315730401
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1298:
+    mov rsi, 434
+    cmp rcx, rsi
+    jge .LB1300
+.LB1299:
+    mov rax, 8876628727198581229
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1300:
+    mov rax, 8810385229234412713
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1301:
+.LB1302:
+    jmp .LB1310
+.LB1303:
+    mov rsi, 436
+    cmp rcx, rsi
+    jge .LB1305
+.LB1304:
+    mov rax, 8745123116425268915
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1305:
+    mov rsi, 437
+    cmp rcx, rsi
+    jge .LB1307
+.LB1306:
+    mov rax, 8680820740569200761
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1307:
+    mov rax, -1211829902652452295
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1308:
+.LB1309:
+.LB1310:
+.LB1311:
+.LB1312:
+    jmp .LB1380
+.LB1313:
+    mov rsi, 449
+    cmp rcx, rsi
+    jge .LB1345
+.LB1314:
+    mov rsi, 443
+    cmp rcx, rsi
+    jge .LB1328
+.LB1315:
+    mov rsi, 440
+    cmp rcx, rsi
+    jge .LB1320
+.LB1316:
+    mov rsi, 439
+    cmp rcx, rsi
+    jge .LB1318
+.LB1317:
+    mov rax, 8555011744329067417
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1318:
+    mov rax, 4246732448623781667
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1319:
+    jmp .LB1327
+.LB1320:
+    mov rsi, 441
+    cmp rcx, rsi
+    jge .LB1322
+.LB1321:
+    mov rax, 1054099661354831521
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1322:
+    mov rsi, 442
+    cmp rcx, rsi
+    jge .LB1324
+.LB1323:
+    mov rax, 2093247554463495219
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1324:
+    mov rax, 8314025498009938757
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1325:
+.LB1326:
+.LB1327:
+    jmp .LB1344
+.LB1328:
+    mov rsi, 446
+    cmp rcx, rsi
+    jge .LB1336
+.LB1329:
+    mov rsi, 444
+    cmp rcx, rsi
+    jge .LB1331
+.LB1330:
+    mov rax, 1031985682445289601
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1331:
+    mov rsi, 445
+    cmp rcx, rsi
+    jge .LB1333
+.LB1332:
+    mov rax, 1024819115206086201
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1333:
+    mov rax, 8142011177361457265
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1334:
+.LB1335:
+    jmp .LB1343
+.LB1336:
+    mov rsi, 447
+    cmp rcx, rsi
+    jge .LB1338
+.LB1337:
+    mov rax, 8086243977516515777
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1338:
+    mov rsi, 448
+    cmp rcx, rsi
+    jge .LB1340
+.LB1339:
+    mov rax, 2007808878771107659
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1340:
+    mov rax, 3988485205126389539
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1341:
+.LB1342:
+.LB1343:
+.LB1344:
+    jmp .LB1379
+.LB1345:
+    mov rsi, 455
+    cmp rcx, rsi
+    jge .LB1362
+.LB1346:
+    mov rsi, 452
+    cmp rcx, rsi
+    jge .LB1354
+.LB1347:
+    mov rsi, 450
+    cmp rcx, rsi
+    jge .LB1349
+.LB1348:
+    mov rax, 1980858424022502187
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1349:
+    mov rsi, 451
+    cmp rcx, rsi
+    jge .LB1351
+.LB1350:
+    mov rax, 7870610804782742023
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1351:
+    mov rax, 7818487554419942407
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1352:
+.LB1353:
+    jmp .LB1361
+.LB1354:
+    mov rsi, 453
+    cmp rcx, rsi
+    jge .LB1356
+.LB1355:
+    mov rax, 485440633518672411
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1356:
+    mov rsi, 454
+    cmp rcx, rsi
+    jge .LB1358
+.LB1357:
+    mov rax, 3858142551364089227
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1358:
+    mov rax, 7666179355307865607
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1359:
+.LB1360:
+.LB1361:
+    jmp .LB1378
+.LB1362:
+    mov rsi, 458
+    cmp rcx, rsi
+    jge .LB1370
+.LB1363:
+    mov rsi, 456
+    cmp rcx, rsi
+    jge .LB1365
+.LB1364:
+    mov rax, 7616720133660718087
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1365:
+    mov rsi, 457
+    cmp rcx, rsi
+    jge .LB1367
+.LB1366:
+    mov rax, 7567895004598790407
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1367:
+    mov rax, 3759845925851628355
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1368:
+.LB1369:
+    jmp .LB1377
+.LB1370:
+    mov rsi, 459
+    cmp rcx, rsi
+    jge .LB1372
+.LB1371:
+    mov rax, 7472098865300071541
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1372:
+    mov rsi, 460
+    cmp rcx, rsi
+    jge .LB1374
+.LB1373:
+    mov rax, 7425104532813907569
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1374:
+    mov rax, 7378697629483820647
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1375:
+.LB1376:
+.LB1377:
+.LB1378:
+.LB1379:
+.LB1380:
+.LB1381:
+    jmp .LB1659
+.LB1382:
+    mov rsi, 507
+    cmp rcx, rsi
+    jge .LB1519
+.LB1383:
+    mov rsi, 484
+    cmp rcx, rsi
+    jge .LB1451
+.LB1384:
+    mov rsi, 472
+    cmp rcx, rsi
+    jge .LB1416
+.LB1385:
+    mov rsi, 466
+    cmp rcx, rsi
+    jge .LB1399
+.LB1386:
+    mov rsi, 463
+    cmp rcx, rsi
+    jge .LB1391
+.LB1387:
+    mov rsi, 462
+    cmp rcx, rsi
+    jge .LB1389
+.LB1388:
+    mov rax, -3781009654859721759
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1389:
+    mov rax, 7287602597021057429
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1390:
+    jmp .LB1398
+.LB1391:
+    mov rsi, 464
+    cmp rcx, rsi
+    jge .LB1393
+.LB1392:
+    mov rax, 7242893378634425175
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1393:
+    mov rsi, 465
+    cmp rcx, rsi
+    jge .LB1395
+.LB1394:
+    mov rax, 7198729394618361607
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1395:
+    mov rax, -4136542610468202483
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1396:
+.LB1397:
+.LB1398:
+    jmp .LB1415
+.LB1399:
+    mov rsi, 469
+    cmp rcx, rsi
+    jge .LB1407
+.LB1400:
+    mov rsi, 467
+    cmp rcx, rsi
+    jge .LB1402
+.LB1401:
+    mov rax, 3555998857582564167
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1402:
+    mov rsi, 468
+    cmp rcx, rsi
+    jge .LB1404
+.LB1403:
+    mov rax, 7069410902499468883
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1404:
+    mov rax, -4392081922311798003
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1405:
+.LB1406:
+    jmp .LB1414
+.LB1407:
+    mov rsi, 470
+    cmp rcx, rsi
+    jge .LB1409
+.LB1408:
+    mov rax, 1746437308753567017
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1409:
+    mov rsi, 471
+    cmp rcx, rsi
+    jge .LB1411
+.LB1410:
+    mov rax, 6944656592455360609
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1411:
+    mov rax, 107875696337482758
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1412:
+.LB1413:
+.LB1414:
+.LB1415:
+    jmp .LB1450
+.LB1416:
+    mov rsi, 478
+    cmp rcx, rsi
+    jge .LB1433
+.LB1417:
+    mov rsi, 475
+    cmp rcx, rsi
+    jge .LB1425
+.LB1418:
+    mov rsi, 473
+    cmp rcx, rsi
+    jge .LB1420
+.LB1419:
+    mov rax, 214497024112901763
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1420:
+    mov rsi, 474
+    cmp rcx, rsi
+    jge .LB1422
+.LB1421:
+    mov rax, 3412114510743963305
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1422:
+    mov rax, -4876725444773789507
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1423:
+.LB1424:
+    jmp .LB1432
+.LB1425:
+    mov rsi, 476
+    cmp rcx, rsi
+    jge .LB1427
+.LB1426:
+    mov rax, 3373118916335460867
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1427:
+    mov rsi, 477
+    cmp rcx, rsi
+    jge .LB1429
+.LB1428:
+    mov rax, 3353953467947191203
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1429:
+    mov rax, -5106725760518463441
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1430:
+.LB1431:
+.LB1432:
+    jmp .LB1449
+.LB1433:
+    mov rsi, 481
+    cmp rcx, rsi
+    jge .LB1441
+.LB1434:
+    mov rsi, 479
+    cmp rcx, rsi
+    jge .LB1436
+.LB1435:
+    mov rax, -5181669683626278543
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1436:
+    mov rsi, 480
+    cmp rcx, rsi
+    jge .LB1438
+.LB1437:
+    mov rax, 6595483914622409517
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1438:
+    mov rax, 3279421168659475843
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1439:
+.LB1440:
+    jmp .LB1448
+.LB1441:
+    mov rsi, 482
+    cmp rcx, rsi
+    jge .LB1443
+.LB1442:
+    mov rax, 407662852457669649
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1443:
+    mov rsi, 483
+    cmp rcx, rsi
+    jge .LB1445
+.LB1444:
+    mov rax, 3243383573399481603
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1445:
+    mov rax, 3225660165894566403
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1446:
+.LB1447:
+.LB1448:
+.LB1449:
+.LB1450:
+    jmp .LB1518
+.LB1451:
+    mov rsi, 495
+    cmp rcx, rsi
+    jge .LB1483
+.LB1452:
+    mov rsi, 489
+    cmp rcx, rsi
+    jge .LB1466
+.LB1453:
+    mov rsi, 486
+    cmp rcx, rsi
+    jge .LB1458
+.LB1454:
+    mov rsi, 485
+    cmp rcx, rsi
+    jge .LB1456
+.LB1455:
+    mov rax, -5614226457215950491
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1456:
+    mov rax, 3190788164101111631
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1457:
+    jmp .LB1465
+.LB1458:
+    mov rsi, 487
+    cmp rcx, rsi
+    jge .LB1460
+.LB1459:
+    mov rax, 3173633389025299203
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1460:
+    mov rsi, 488
+    cmp rcx, rsi
+    jge .LB1462
+.LB1461:
+    mov rax, 6313324174959418735
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1462:
+    mov rax, 6279742663390485657
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1463:
+.LB1464:
+.LB1465:
+    jmp .LB1482
+.LB1466:
+    mov rsi, 492
+    cmp rcx, rsi
+    jge .LB1474
+.LB1467:
+    mov rsi, 490
+    cmp rcx, rsi
+    jge .LB1469
+.LB1468:
+    mov rax, 6246516511732334939
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1469:
+    mov rsi, 491
+    cmp rcx, rsi
+    jge .LB1471
+.LB1470:
+    mov rax, -6019463855631537895
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1471:
+    mov rax, 6181107961871263369
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1472:
+.LB1473:
+    jmp .LB1481
+.LB1474:
+    mov rsi, 493
+    cmp rcx, rsi
+    jge .LB1476
+.LB1475:
+    mov rax, 3074457345618258603
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1476:
+    mov rsi, 494
+    cmp rcx, rsi
+    jge .LB1478
+.LB1477:
+    mov rax, 1529263757405973191
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1478:
+    mov rax, -6275696437447579415
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1479:
+.LB1480:
+.LB1481:
+.LB1482:
+    jmp .LB1517
+.LB1483:
+    mov rsi, 501
+    cmp rcx, rsi
+    jge .LB1500
+.LB1484:
+    mov rsi, 498
+    cmp rcx, rsi
+    jge .LB1492
+.LB1485:
+    mov rsi, 496
+    cmp rcx, rsi
+    jge .LB1487
+.LB1486:
+    mov rax, -6338112066351486965
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1487:
+    mov rsi, 497
+    cmp rcx, rsi
+    jge .LB1489
+.LB1488:
+    mov rax, 6023426636313322977
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1489:
+    mov rax, 1498212716646461045
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1490:
+.LB1491:
+    jmp .LB1499
+.LB1492:
+    mov rsi, 499
+    cmp rcx, rsi
+    jge .LB1494
+.LB1493:
+    mov rax, -6521576187675094005
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1494:
+    mov rsi, 500
+    cmp rcx, rsi
+    jge .LB1496
+.LB1495:
+    mov rax, 5932621209635232681
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1496:
+    mov rax, -6640827866535438581
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1497:
+.LB1498:
+.LB1499:
+    jmp .LB1516
+.LB1500:
+    mov rsi, 504
+    cmp rcx, rsi
+    jge .LB1508
+.LB1501:
+    mov rsi, 502
+    cmp rcx, rsi
+    jge .LB1503
+.LB1502:
+    mov rax, -6699563768063667999
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1503:
+    mov rsi, 503
+    cmp rcx, rsi
+    jge .LB1505
+.LB1504:
+    mov rax, -6757718126012409997
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1505:
+    mov rax, 5815722269543898047
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1506:
+.LB1507:
+    jmp .LB1515
+.LB1508:
+    mov rsi, 505
+    cmp rcx, rsi
+    jge .LB1510
+.LB1509:
+    mov rax, -6872316419617283935
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1510:
+    mov rsi, 506
+    cmp rcx, rsi
+    jge .LB1512
+.LB1511:
+    mov rax, 5758983515694689285
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1512:
+    mov rax, -6984689503637597213
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1513:
+.LB1514:
+.LB1515:
+.LB1516:
+.LB1517:
+.LB1518:
+    jmp .LB1658
+.LB1519:
+    mov rsi, 530
+    cmp rcx, rsi
+    jge .LB1587
+.LB1520:
+    mov rsi, 518
+    cmp rcx, rsi
+    jge .LB1552
+.LB1521:
+    mov rsi, 512
+    cmp rcx, rsi
+    jge .LB1535
+.LB1522:
+    mov rsi, 509
+    cmp rcx, rsi
+    jge .LB1527
+.LB1523:
+    mov rsi, 508
+    cmp rcx, rsi
+    jge .LB1525
+.LB1524:
+    mov rax, -7040061747937461727
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1525:
+    mov rax, 5675921253449092805
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1526:
+    jmp .LB1534
+.LB1527:
+    mov rsi, 510
+    cmp rcx, rsi
+    jge .LB1529
+.LB1528:
+    mov rax, 5648763735490006237
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1529:
+    mov rsi, 511
+    cmp rcx, rsi
+    jge .LB1531
+.LB1530:
+    mov rax, 5621864860559101445
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1531:
+    mov rax, 5595220951267352149
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1532:
+.LB1533:
+.LB1534:
+    jmp .LB1551
+.LB1535:
+    mov rsi, 515
+    cmp rcx, rsi
+    jge .LB1543
+.LB1536:
+    mov rsi, 513
+    cmp rcx, rsi
+    jge .LB1538
+.LB1537:
+    mov rax, 5568828399610430677
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1538:
+    mov rsi, 514
+    cmp rcx, rsi
+    jge .LB1540
+.LB1539:
+    mov rax, -7361376743029633273
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1540:
+    mov rax, 1379195818595106663
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1541:
+.LB1542:
+    jmp .LB1550
+.LB1543:
+    mov rsi, 516
+    cmp rcx, rsi
+    jge .LB1545
+.LB1544:
+    mov rax, -7464496439128981351
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1545:
+    mov rsi, 517
+    cmp rcx, rsi
+    jge .LB1547
+.LB1546:
+    mov rax, 341606371735362067
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1547:
+    mov rax, 5440514381186227205
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1548:
+.LB1549:
+.LB1550:
+.LB1551:
+    jmp .LB1586
+.LB1552:
+    mov rsi, 524
+    cmp rcx, rsi
+    jge .LB1569
+.LB1553:
+    mov rsi, 521
+    cmp rcx, rsi
+    jge .LB1561
+.LB1554:
+    mov rsi, 519
+    cmp rcx, rsi
+    jge .LB1556
+.LB1555:
+    mov rax, -7615628287311282777
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1556:
+    mov rsi, 520
+    cmp rcx, rsi
+    jge .LB1558
+.LB1557:
+    mov rax, -7665085437020863913
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1558:
+    mov rax, 5366325548715505925
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1559:
+.LB1560:
+    jmp .LB1568
+.LB1561:
+    mov rsi, 522
+    cmp rcx, rsi
+    jge .LB1563
+.LB1562:
+    mov rax, 5342043532657969699
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1563:
+    mov rsi, 523
+    cmp rcx, rsi
+    jge .LB1565
+.LB1564:
+    mov rax, -7810783526705846179
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1565:
+    mov rax, -7858478417051154275
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1566:
+.LB1567:
+.LB1568:
+    jmp .LB1585
+.LB1569:
+    mov rsi, 527
+    cmp rcx, rsi
+    jge .LB1577
+.LB1570:
+    mov rsi, 525
+    cmp rcx, rsi
+    jge .LB1572
+.LB1571:
+    mov rax, 5270498306774157605
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1572:
+    mov rsi, 526
+    cmp rcx, rsi
+    jge .LB1574
+.LB1573:
+    mov rax, 5247073869855161349
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1574:
+    mov rax, 5223856728838103113
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1575:
+.LB1576:
+    jmp .LB1584
+.LB1577:
+    mov rsi, 528
+    cmp rcx, rsi
+    jge .LB1579
+.LB1578:
+    mov rax, -8045055785450421189
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1579:
+    mov rsi, 529
+    cmp rcx, rsi
+    jge .LB1581
+.LB1580:
+    mov rax, 161813544506224137
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1581:
+    mov rax, -8135900224649190887
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1582:
+.LB1583:
+.LB1584:
+.LB1585:
+.LB1586:
+    jmp .LB1657
+.LB1587:
+    mov rsi, 542
+    cmp rcx, rsi
+    jge .LB1622
+.LB1588:
+    mov rsi, 536
+    cmp rcx, rsi
+    jge .LB1605
+.LB1589:
+    mov rsi, 533
+    cmp rcx, rsi
+    jge .LB1597
+.LB1590:
+    mov rsi, 531
+    cmp rcx, rsi
+    jge .LB1592
+.LB1591:
+    mov rax, 2566503523298720225
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1592:
+    mov rsi, 532
+    cmp rcx, rsi
+    jge .LB1594
+.LB1593:
+    mov rax, -8225171599965730807
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1594:
+    mov rax, 5088756985850910791
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1595:
+.LB1596:
+    jmp .LB1604
+.LB1597:
+    mov rsi, 534
+    cmp rcx, rsi
+    jge .LB1599
+.LB1598:
+    mov rax, 2533458413556676617
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1599:
+    mov rsi, 535
+    cmp rcx, rsi
+    jge .LB1601
+.LB1600:
+    mov rax, -8356217400911164407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1601:
+    mov rax, -8399155812284774565
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1602:
+.LB1603:
+.LB1604:
+    jmp .LB1621
+.LB1605:
+    mov rsi, 539
+    cmp rcx, rsi
+    jge .LB1613
+.LB1606:
+    mov rsi, 537
+    cmp rcx, rsi
+    jge .LB1608
+.LB1607:
+    mov rax, -8441730338816235485
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1608:
+    mov rsi, 538
+    cmp rcx, rsi
+    jge .LB1610
+.LB1609:
+    mov rax, -8483945586642789561
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1610:
+    mov rax, -8525806084487607889
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1611:
+.LB1612:
+    jmp .LB1620
+.LB1613:
+    mov rsi, 540
+    cmp rcx, rsi
+    jge .LB1615
+.LB1614:
+    mov rax, -8567316285279331503
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1615:
+    mov rsi, 541
+    cmp rcx, rsi
+    jge .LB1617
+.LB1616:
+    mov rax, -8608480567731124087
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1617:
+    mov rax, 1224680104478642431
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1618:
+.LB1619:
+.LB1620:
+.LB1621:
+    jmp .LB1656
+.LB1622:
+    mov rsi, 548
+    cmp rcx, rsi
+    jge .LB1639
+.LB1623:
+    mov rsi, 545
+    cmp rcx, rsi
+    jge .LB1631
+.LB1624:
+    mov rsi, 543
+    cmp rcx, rsi
+    jge .LB1626
+.LB1625:
+    mov rax, 4878477771559550841
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1626:
+    mov rsi, 544
+    cmp rcx, rsi
+    jge .LB1628
+.LB1627:
+    mov rax, -8729940611014808377
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1628:
+    mov rax, -8769763576025852407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1629:
+.LB1630:
+    jmp .LB1638
+.LB1631:
+    mov rsi, 546
+    cmp rcx, rsi
+    jge .LB1633
+.LB1632:
+    mov rax, -8809261455608234853
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1633:
+    mov rsi, 547
+    cmp rcx, rsi
+    jge .LB1635
+.LB1634:
+    mov rax, -8848438214218402807
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1635:
+    mov rax, -8887297752111079523
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1636:
+.LB1637:
+.LB1638:
+    jmp .LB1655
+.LB1639:
+    mov rsi, 551
+    cmp rcx, rsi
+    jge .LB1647
+.LB1640:
+    mov rsi, 549
+    cmp rcx, rsi
+    jge .LB1642
+.LB1641:
+    mov rax, -8925843906633654007
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1642:
+    mov rsi, 550
+    cmp rcx, rsi
+    jge .LB1644
+.LB1643:
+    mov rax, 1185332952527521389
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1644:
+    mov rax, 2361183241434822607
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1645:
+.LB1646:
+    jmp .LB1654
+.LB1647:
+    mov rsi, 552
+    cmp rcx, rsi
+    jge .LB1649
+.LB1648:
+    mov rax, 2351776136887273513
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1649:
+    mov rsi, 553
+    cmp rcx, rsi
+    jge .LB1651
+.LB1650:
+    mov rax, -9076969306111049207
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1651:
+    mov rax, 1166592510590327375
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1652:
+.LB1653:
+.LB1654:
+.LB1655:
+.LB1656:
+.LB1657:
+.LB1658:
+.LB1659:
+    jmp .LB2213
+.LB1660:
+    mov rsi, 646
+    cmp rcx, rsi
+    jge .LB1935
+.LB1661:
+    mov rsi, 600
+    cmp rcx, rsi
+    jge .LB1798
+.LB1662:
+    mov rsi, 577
+    cmp rcx, rsi
+    jge .LB1730
+.LB1663:
+    mov rsi, 565
+    cmp rcx, rsi
+    jge .LB1695
+.LB1664:
+    mov rsi, 559
+    cmp rcx, rsi
+    jge .LB1678
+.LB1665:
+    mov rsi, 556
+    cmp rcx, rsi
+    jge .LB1670
+.LB1666:
+    mov rsi, 555
+    cmp rcx, rsi
+    jge .LB1668
+.LB1667:
+    mov rax, 4647998506761461825
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1668:
+    mov rax, -9187201950435737471
+    imul rbx
+    add rdx, rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1669:
+    jmp .LB1677
+.LB1670:
+    mov rsi, 557
+    cmp rcx, rsi
+    jge .LB1672
+.LB1671:
+    mov rax, rbx
+    cqo
+    shr rdx, 56
+    add rax, rdx
+    sar rax, 8
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1672:
+    mov rsi, 558
+    cmp rcx, rsi
+    jge .LB1674
+.LB1673:
+    mov rax, 9187483429707480961
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1674:
+    mov rax, 71499008037633921
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1675:
+.LB1676:
+.LB1677:
+    jmp .LB1694
+.LB1678:
+    mov rsi, 562
+    cmp rcx, rsi
+    jge .LB1686
+.LB1679:
+    mov rsi, 560
+    cmp rcx, rsi
+    jge .LB1681
+.LB1680:
+    mov rax, 9116537611717461803
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1681:
+    mov rsi, 561
+    cmp rcx, rsi
+    jge .LB1683
+.LB1682:
+    mov rax, 1135184250689818561
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1683:
+    mov rax, 9046679085957174739
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1684:
+.LB1685:
+    jmp .LB1693
+.LB1686:
+    mov rsi, 563
+    cmp rcx, rsi
+    jge .LB1688
+.LB1687:
+    mov rax, 281629680514649643
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1688:
+    mov rsi, 564
+    cmp rcx, rsi
+    jge .LB1690
+.LB1689:
+    mov rax, 8977883047280694323
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1690:
+    mov rax, 1117984489315730401
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1691:
+.LB1692:
+.LB1693:
+.LB1694:
+    jmp .LB1729
+.LB1695:
+    mov rsi, 571
+    cmp rcx, rsi
+    jge .LB1712
+.LB1696:
+    mov rsi, 568
+    cmp rcx, rsi
+    jge .LB1704
+.LB1697:
+    mov rsi, 566
+    cmp rcx, rsi
+    jge .LB1699
+.LB1698:
+    mov rax, 8910125439376689083
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1699:
+    mov rsi, 567
+    cmp rcx, rsi
+    jge .LB1701
+.LB1700:
+    mov rax, 8876628727198581229
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1701:
+    mov rax, 8843382926722182049
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1702:
+.LB1703:
+    jmp .LB1711
+.LB1704:
+    mov rsi, 569
+    cmp rcx, rsi
+    jge .LB1706
+.LB1705:
+    mov rax, 8810385229234412713
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1706:
+    mov rsi, 570
+    cmp rcx, rsi
+    jge .LB1708
+.LB1707:
+    mov rax, 2194408216946861159
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1708:
+    mov rax, 8745123116425268915
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1709:
+.LB1710:
+.LB1711:
+    jmp .LB1728
+.LB1712:
+    mov rsi, 574
+    cmp rcx, rsi
+    jge .LB1720
+.LB1713:
+    mov rsi, 572
+    cmp rcx, rsi
+    jge .LB1715
+.LB1714:
+    mov rax, 4356426644713694847
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1715:
+    mov rsi, 573
+    cmp rcx, rsi
+    jge .LB1717
+.LB1716:
+    mov rax, 8680820740569200761
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1717:
+    mov rax, 1081127857799827201
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1718:
+.LB1719:
+    jmp .LB1727
+.LB1720:
+    mov rsi, 575
+    cmp rcx, rsi
+    jge .LB1722
+.LB1721:
+    mov rax, -1211829902652452295
+    imul rbx
+    add rdx, rbx
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1722:
+    mov rsi, 576
+    cmp rcx, rsi
+    jge .LB1724
+.LB1723:
+    mov rax, 1073265109743101185
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1724:
+    mov rax, 8555011744329067417
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1725:
+.LB1726:
+.LB1727:
+.LB1728:
+.LB1729:
+    jmp .LB1797
+.LB1730:
+    mov rsi, 588
+    cmp rcx, rsi
+    jge .LB1762
+.LB1731:
+    mov rsi, 582
+    cmp rcx, rsi
+    jge .LB1745
+.LB1732:
+    mov rsi, 579
+    cmp rcx, rsi
+    jge .LB1737
+.LB1733:
+    mov rsi, 578
+    cmp rcx, rsi
+    jge .LB1735
+.LB1734:
+    mov rax, 8524127225396471505
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1735:
+    mov rax, 4246732448623781667
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1736:
+    jmp .LB1744
+.LB1737:
+    mov rsi, 580
+    cmp rcx, rsi
+    jge .LB1739
+.LB1738:
+    mov rax, 1057877796341766401
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1739:
+    mov rsi, 581
+    cmp rcx, rsi
+    jge .LB1741
+.LB1740:
+    mov rax, 1054099661354831521
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1741:
+    mov rax, -1641169401575582883
+    imul rbx
+    add rdx, rbx
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1742:
+.LB1743:
+.LB1744:
+    jmp .LB1761
+.LB1745:
+    mov rsi, 585
+    cmp rcx, rsi
+    jge .LB1753
+.LB1746:
+    mov rsi, 583
+    cmp rcx, rsi
+    jge .LB1748
+.LB1747:
+    mov rax, 2093247554463495219
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1748:
+    mov rsi, 584
+    cmp rcx, rsi
+    jge .LB1750
+.LB1749:
+    mov rax, 8343403679981705325
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1750:
+    mov rax, 8314025498009938757
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1751:
+.LB1752:
+    jmp .LB1760
+.LB1753:
+    mov rsi, 586
+    cmp rcx, rsi
+    jge .LB1755
+.LB1754:
+    mov rax, 4142426739359337907
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1755:
+    mov rsi, 587
+    cmp rcx, rsi
+    jge .LB1757
+.LB1756:
+    mov rax, 1031985682445289601
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1757:
+    mov rax, 1028389913516908801
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1758:
+.LB1759:
+.LB1760:
+.LB1761:
+    jmp .LB1796
+.LB1762:
+    mov rsi, 594
+    cmp rcx, rsi
+    jge .LB1779
+.LB1763:
+    mov rsi, 591
+    cmp rcx, rsi
+    jge .LB1771
+.LB1764:
+    mov rsi, 589
+    cmp rcx, rsi
+    jge .LB1766
+.LB1765:
+    mov rax, 1024819115206086201
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1766:
+    mov rsi, 590
+    cmp rcx, rsi
+    jge .LB1768
+.LB1767:
+    mov rax, 1021273028302258913
+    imul rbx
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1768:
+    mov rax, 8142011177361457265
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1769:
+.LB1770:
+    jmp .LB1778
+.LB1771:
+    mov rsi, 592
+    cmp rcx, rsi
+    jge .LB1773
+.LB1772:
+    mov rax, 8114031757507981467
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1773:
+    mov rsi, 593
+    cmp rcx, rsi
+    jge .LB1775
+.LB1774:
+    mov rax, 8086243977516515777
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1775:
+    mov rax, 503665367200260795
+    imul rbx
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1776:
+.LB1777:
+.LB1778:
+    jmp .LB1795
+.LB1779:
+    mov rsi, 597
+    cmp rcx, rsi
+    jge .LB1787
+.LB1780:
+    mov rsi, 595
+    cmp rcx, rsi
+    jge .LB1782
+.LB1781:
+    mov rax, 2007808878771107659
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1782:
+    mov rsi, 596
+    cmp rcx, rsi
+    jge .LB1784
+.LB1783:
+    mov rax, 8004010987914652905
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1784:
+    mov rax, 3988485205126389539
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1785:
+.LB1786:
+    jmp .LB1794
+.LB1787:
+    mov rsi, 598
+    cmp rcx, rsi
+    jge .LB1789
+.LB1788:
+    mov rax, 7950111924022971741
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1789:
+    mov rsi, 599
+    cmp rcx, rsi
+    jge .LB1791
+.LB1790:
+    mov rax, 1980858424022502187
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1791:
+    mov rax, 7896933917842216077
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1792:
+.LB1793:
+.LB1794:
+.LB1795:
+.LB1796:
+.LB1797:
+    jmp .LB1934
+.LB1798:
+    mov rsi, 623
+    cmp rcx, rsi
+    jge .LB1866
+.LB1799:
+    mov rsi, 611
+    cmp rcx, rsi
+    jge .LB1831
+.LB1800:
+    mov rsi, 605
+    cmp rcx, rsi
+    jge .LB1814
+.LB1801:
+    mov rsi, 602
+    cmp rcx, rsi
+    jge .LB1806
+.LB1802:
+    mov rsi, 601
+    cmp rcx, rsi
+    jge .LB1804
+.LB1803:
+    mov rax, 7870610804782742023
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1804:
+    mov rax, 4620710844295151873
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1805:
+    jmp .LB1813
+.LB1806:
+    mov rsi, 603
+    cmp rcx, rsi
+    jge .LB1808
+.LB1807:
+    mov rax, rbx
+    cqo
+    shr rdx, 55
+    add rax, rdx
+    sar rax, 9
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1808:
+    mov rsi, 604
+    cmp rcx, rsi
+    jge .LB1810
+.LB1809:
+    mov rax, 35958565445827586
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1810:
+    mov rax, 4620710844295151873
+    imul rbx
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1811:
+.LB1812:
+.LB1813:
+    jmp .LB1830
+.LB1814:
+    mov rsi, 608
+    cmp rcx, rsi
+    jge .LB1822
+.LB1815:
+    mov rsi, 606
+    cmp rcx, rsi
+    jge .LB1817
+.LB1816:
+    mov rax, rbx
+    cqo
+    shr rdx, 55
+    add rax, rdx
+    sar rax, 9
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1817:
+    mov rsi, 607
+    cmp rcx, rsi
+    jge .LB1819
+.LB1818:
+    mov rax, 35958565445827586
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1819:
+    mov rax, -9214356032908681207
+    imul rbx
+    add rdx, rbx
+    sar rdx, 9
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1820:
+.LB1821:
+    jmp .LB1829
+.LB1822:
+    mov rsi, 609
+    cmp rcx, rsi
+    jge .LB1824
+.LB1823:
+    mov rax, rbx
+    cqo
+    shr rdx, 54
+    add rax, rdx
+    sar rax, 10
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1824:
+    mov rsi, 610
+    cmp rcx, rsi
+    jge .LB1826
+.LB1825:
+    mov rax, 1151796703138937857
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1826:
+    mov rax, -9214356032908681207
+    imul rbx
+    add rdx, rbx
+    sar rdx, 9
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1827:
+.LB1828:
+.LB1829:
+.LB1830:
+    jmp .LB1865
+.LB1831:
+    mov rsi, 617
+    cmp rcx, rsi
+    jge .LB1848
+.LB1832:
+    mov rsi, 614
+    cmp rcx, rsi
+    jge .LB1840
+.LB1833:
+    mov rsi, 612
+    cmp rcx, rsi
+    jge .LB1835
+.LB1834:
+    mov rax, rbx
+    cqo
+    shr rdx, 54
+    add rax, rdx
+    sar rax, 10
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1835:
+    mov rsi, 613
+    cmp rcx, rsi
+    jge .LB1837
+.LB1836:
+    mov rax, 1151796703138937857
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1837:
+    mov rax, -9218866237129883391
+    imul rbx
+    add rdx, rbx
+    sar rdx, 10
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1838:
+.LB1839:
+    jmp .LB1847
+.LB1840:
+    mov rsi, 615
+    cmp rcx, rsi
+    jge .LB1842
+.LB1841:
+    mov rax, rbx
+    cqo
+    shr rdx, 53
+    add rax, rdx
+    sar rax, 11
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1842:
+    mov rsi, 616
+    cmp rcx, rsi
+    jge .LB1844
+.LB1843:
+    mov rax, 9218870635177443073
+    imul rbx
+    sar rdx, 10
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1844:
+    mov rax, -9218866237129883391
+    imul rbx
+    add rdx, rbx
+    sar rdx, 10
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1845:
+.LB1846:
+.LB1847:
+    jmp .LB1864
+.LB1848:
+    mov rsi, 620
+    cmp rcx, rsi
+    jge .LB1856
+.LB1849:
+    mov rsi, 618
+    cmp rcx, rsi
+    jge .LB1851
+.LB1850:
+    mov rax, rbx
+    cqo
+    shr rdx, 53
+    add rax, rdx
+    sar rax, 11
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1851:
+    mov rsi, 619
+    cmp rcx, rsi
+    jge .LB1853
+.LB1852:
+    mov rax, 9218870635177443073
+    imul rbx
+    sar rdx, 10
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1853:
+    mov rax, -9221119687151026167
+    imul rbx
+    add rdx, rbx
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1854:
+.LB1855:
+    jmp .LB1863
+.LB1856:
+    mov rsi, 621
+    cmp rcx, rsi
+    jge .LB1858
+.LB1857:
+    mov rax, rbx
+    cqo
+    shr rdx, 52
+    add rax, rdx
+    sar rax, 12
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1858:
+    mov rsi, 622
+    cmp rcx, rsi
+    jge .LB1860
+.LB1859:
+    mov rax, 9221120786662719481
+    imul rbx
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1860:
+    mov rax, -9221119687151026167
+    imul rbx
+    add rdx, rbx
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1861:
+.LB1862:
+.LB1863:
+.LB1864:
+.LB1865:
+    jmp .LB1933
+.LB1866:
+    mov rsi, 634
+    cmp rcx, rsi
+    jge .LB1898
+.LB1867:
+    mov rsi, 628
+    cmp rcx, rsi
+    jge .LB1881
+.LB1868:
+    mov rsi, 625
+    cmp rcx, rsi
+    jge .LB1873
+.LB1869:
+    mov rsi, 624
+    cmp rcx, rsi
+    jge .LB1871
+.LB1870:
+    mov rax, rbx
+    cqo
+    shr rdx, 52
+    add rax, rdx
+    sar rax, 12
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1871:
+    mov rax, 9221120786662719481
+    imul rbx
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1872:
+    jmp .LB1880
+.LB1873:
+    mov rsi, 626
+    cmp rcx, rsi
+    jge .LB1875
+.LB1874:
+    mov rax, -9222245999492200447
+    imul rbx
+    add rdx, rbx
+    sar rdx, 12
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1875:
+    mov rsi, 627
+    cmp rcx, rsi
+    jge .LB1877
+.LB1876:
+    mov rax, rbx
+    cqo
+    shr rdx, 51
+    add rax, rdx
+    sar rax, 13
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1877:
+    mov rax, 4503049938657281
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1878:
+.LB1879:
+.LB1880:
+    jmp .LB1897
+.LB1881:
+    mov rsi, 631
+    cmp rcx, rsi
+    jge .LB1889
+.LB1882:
+    mov rsi, 629
+    cmp rcx, rsi
+    jge .LB1884
+.LB1883:
+    mov rax, -9222245999492200447
+    imul rbx
+    add rdx, rbx
+    sar rdx, 12
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1884:
+    mov rsi, 630
+    cmp rcx, rsi
+    jge .LB1886
+.LB1885:
+    mov rax, rbx
+    cqo
+    shr rdx, 51
+    add rax, rdx
+    sar rax, 13
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1886:
+    mov rax, 4503049938657281
+    imul rbx
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1887:
+.LB1888:
+    jmp .LB1896
+.LB1889:
+    mov rsi, 632
+    cmp rcx, rsi
+    jge .LB1891
+.LB1890:
+    mov rax, -9222809052539518847
+    imul rbx
+    add rdx, rbx
+    sar rdx, 13
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1891:
+    mov rsi, 633
+    cmp rcx, rsi
+    jge .LB1893
+.LB1892:
+    mov rax, rbx
+    cqo
+    shr rdx, 50
+    add rax, rdx
+    sar rax, 14
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1893:
+    mov rax, 72053196259835905
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1894:
+.LB1895:
+.LB1896:
+.LB1897:
+    jmp .LB1932
+.LB1898:
+    mov rsi, 640
+    cmp rcx, rsi
+    jge .LB1915
+.LB1899:
+    mov rsi, 637
+    cmp rcx, rsi
+    jge .LB1907
+.LB1900:
+    mov rsi, 635
+    cmp rcx, rsi
+    jge .LB1902
+.LB1901:
+    mov rax, -9222809052539518847
+    imul rbx
+    add rdx, rbx
+    sar rdx, 13
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1902:
+    mov rsi, 636
+    cmp rcx, rsi
+    jge .LB1904
+.LB1903:
+    mov rax, rbx
+    cqo
+    shr rdx, 50
+    add rax, rdx
+    sar rax, 14
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1904:
+    mov rax, 72053196259835905
+    imul rbx
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1905:
+.LB1906:
+    jmp .LB1914
+.LB1907:
+    mov rsi, 638
+    cmp rcx, rsi
+    jge .LB1909
+.LB1908:
+    mov rax, -9223090553287868407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 14
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1909:
+    mov rsi, 639
+    cmp rcx, rsi
+    jge .LB1911
+.LB1910:
+    mov rax, rbx
+    cqo
+    shr rdx, 49
+    add rax, rdx
+    sar rax, 15
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1911:
+    mov rax, 1152886321308467201
+    imul rbx
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1912:
+.LB1913:
+.LB1914:
+    jmp .LB1931
+.LB1915:
+    mov rsi, 643
+    cmp rcx, rsi
+    jge .LB1923
+.LB1916:
+    mov rsi, 641
+    cmp rcx, rsi
+    jge .LB1918
+.LB1917:
+    mov rax, -9223090553287868407
+    imul rbx
+    add rdx, rbx
+    sar rdx, 14
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1918:
+    mov rsi, 642
+    cmp rcx, rsi
+    jge .LB1920
+.LB1919:
+    mov rax, rbx
+    cqo
+    shr rdx, 49
+    add rax, rdx
+    sar rax, 15
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1920:
+    mov rax, 1152886321308467201
+    imul rbx
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1921:
+.LB1922:
+    jmp .LB1930
+.LB1923:
+    mov rsi, 644
+    cmp rcx, rsi
+    jge .LB1925
+.LB1924:
+    mov rax, -9223231297218904063
+    imul rbx
+    add rdx, rbx
+    sar rdx, 15
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1925:
+    mov rsi, 645
+    cmp rcx, rsi
+    jge .LB1927
+.LB1926:
+    mov rax, rbx
+    cqo
+    shr rdx, 48
+    add rax, rdx
+    sar rax, 16
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1927:
+    mov rax, 9223231301513871361
+    imul rbx
+    sar rdx, 15
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1928:
+.LB1929:
+.LB1930:
+.LB1931:
+.LB1932:
+.LB1933:
+.LB1934:
+    jmp .LB2212
+.LB1935:
+    mov rsi, 692
+    cmp rcx, rsi
+    jge .LB2072
+.LB1936:
+    mov rsi, 669
+    cmp rcx, rsi
+    jge .LB2004
+.LB1937:
+    mov rsi, 657
+    cmp rcx, rsi
+    jge .LB1969
+.LB1938:
+    mov rsi, 651
+    cmp rcx, rsi
+    jge .LB1952
+.LB1939:
+    mov rsi, 648
+    cmp rcx, rsi
+    jge .LB1944
+.LB1940:
+    mov rsi, 647
+    cmp rcx, rsi
+    jge .LB1942
+.LB1941:
+    mov rax, -9223231297218904063
+    imul rbx
+    add rdx, rbx
+    sar rdx, 15
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1942:
+    mov rax, rbx
+    cqo
+    shr rdx, 48
+    add rax, rdx
+    sar rax, 16
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1943:
+    jmp .LB1951
+.LB1944:
+    mov rsi, 649
+    cmp rcx, rsi
+    jge .LB1946
+.LB1945:
+    mov rax, 9223231301513871361
+    imul rbx
+    sar rdx, 15
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1946:
+    mov rsi, 650
+    cmp rcx, rsi
+    jge .LB1948
+.LB1947:
+    mov rax, -9223301667573723135
+    imul rbx
+    add rdx, rbx
+    sar rdx, 16
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1948:
+    mov rax, rbx
+    cqo
+    shr rdx, 47
+    add rax, rdx
+    sar rax, 17
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1949:
+.LB1950:
+.LB1951:
+    jmp .LB1968
+.LB1952:
+    mov rsi, 654
+    cmp rcx, rsi
+    jge .LB1960
+.LB1953:
+    mov rsi, 652
+    cmp rcx, rsi
+    jge .LB1955
+.LB1954:
+    mov rax, 9223301668647464961
+    imul rbx
+    sar rdx, 16
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1955:
+    mov rsi, 653
+    cmp rcx, rsi
+    jge .LB1957
+.LB1956:
+    mov rax, -9223301667573723135
+    imul rbx
+    add rdx, rbx
+    sar rdx, 16
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1957:
+    mov rax, rbx
+    cqo
+    shr rdx, 47
+    add rax, rdx
+    sar rax, 17
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1958:
+.LB1959:
+    jmp .LB1967
+.LB1960:
+    mov rsi, 655
+    cmp rcx, rsi
+    jge .LB1962
+.LB1961:
+    mov rax, 9223301668647464961
+    imul rbx
+    sar rdx, 16
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1962:
+    mov rsi, 656
+    cmp rcx, rsi
+    jge .LB1964
+.LB1963:
+    mov rax, -9223336852348468735
+    imul rbx
+    add rdx, rbx
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1964:
+    mov rax, rbx
+    cqo
+    shr rdx, 46
+    add rax, rdx
+    sar rax, 18
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1965:
+.LB1966:
+.LB1967:
+.LB1968:
+    jmp .LB2003
+.LB1969:
+    mov rsi, 663
+    cmp rcx, rsi
+    jge .LB1986
+.LB1970:
+    mov rsi, 660
+    cmp rcx, rsi
+    jge .LB1978
+.LB1971:
+    mov rsi, 658
+    cmp rcx, rsi
+    jge .LB1973
+.LB1972:
+    mov rax, 9223336852616904193
+    imul rbx
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1973:
+    mov rsi, 659
+    cmp rcx, rsi
+    jge .LB1975
+.LB1974:
+    mov rax, -9223336852348468735
+    imul rbx
+    add rdx, rbx
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1975:
+    mov rax, rbx
+    cqo
+    shr rdx, 46
+    add rax, rdx
+    sar rax, 18
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1976:
+.LB1977:
+    jmp .LB1985
+.LB1978:
+    mov rsi, 661
+    cmp rcx, rsi
+    jge .LB1980
+.LB1979:
+    mov rax, 9223336852616904193
+    imul rbx
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1980:
+    mov rsi, 662
+    cmp rcx, rsi
+    jge .LB1982
+.LB1981:
+    mov rax, -9223354444635176895
+    imul rbx
+    add rdx, rbx
+    sar rdx, 18
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1982:
+    mov rax, rbx
+    cqo
+    shr rdx, 45
+    add rax, rdx
+    sar rax, 19
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1983:
+.LB1984:
+.LB1985:
+    jmp .LB2002
+.LB1986:
+    mov rsi, 666
+    cmp rcx, rsi
+    jge .LB1994
+.LB1987:
+    mov rsi, 664
+    cmp rcx, rsi
+    jge .LB1989
+.LB1988:
+    mov rax, 9223354444702285761
+    imul rbx
+    sar rdx, 18
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1989:
+    mov rsi, 665
+    cmp rcx, rsi
+    jge .LB1991
+.LB1990:
+    mov rax, -9223354444635176895
+    imul rbx
+    add rdx, rbx
+    sar rdx, 18
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1991:
+    mov rax, rbx
+    cqo
+    shr rdx, 45
+    add rax, rdx
+    sar rax, 19
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1992:
+.LB1993:
+    jmp .LB2001
+.LB1994:
+    mov rsi, 667
+    cmp rcx, rsi
+    jge .LB1996
+.LB1995:
+    mov rax, 9223354444702285761
+    imul rbx
+    sar rdx, 18
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1996:
+    mov rsi, 668
+    cmp rcx, rsi
+    jge .LB1998
+.LB1997:
+    mov rax, -9223363240753364983
+    imul rbx
+    add rdx, rbx
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1998:
+    mov rax, rbx
+    cqo
+    shr rdx, 44
+    add rax, rdx
+    sar rax, 20
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB1999:
+.LB2000:
+.LB2001:
+.LB2002:
+.LB2003:
+    jmp .LB2071
+.LB2004:
+    mov rsi, 680
+    cmp rcx, rsi
+    jge .LB2036
+.LB2005:
+    mov rsi, 674
+    cmp rcx, rsi
+    jge .LB2019
+.LB2006:
+    mov rsi, 671
+    cmp rcx, rsi
+    jge .LB2011
+.LB2007:
+    mov rsi, 670
+    cmp rcx, rsi
+    jge .LB2009
+.LB2008:
+    mov rax, 9223363240770142201
+    imul rbx
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2009:
+    mov rax, -9223363240753364983
+    imul rbx
+    add rdx, rbx
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2010:
+    jmp .LB2018
+.LB2011:
+    mov rsi, 672
+    cmp rcx, rsi
+    jge .LB2013
+.LB2012:
+    mov rax, rbx
+    cqo
+    shr rdx, 44
+    add rax, rdx
+    sar rax, 20
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2013:
+    mov rsi, 673
+    cmp rcx, rsi
+    jge .LB2015
+.LB2014:
+    mov rax, 9223363240770142201
+    imul rbx
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2015:
+    mov rax, 4611688217451692033
+    imul rbx
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2016:
+.LB2017:
+.LB2018:
+    jmp .LB2035
+.LB2019:
+    mov rsi, 677
+    cmp rcx, rsi
+    jge .LB2027
+.LB2020:
+    mov rsi, 675
+    cmp rcx, rsi
+    jge .LB2022
+.LB2021:
+    mov rax, rbx
+    cqo
+    shr rdx, 43
+    add rax, rdx
+    sar rax, 21
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2022:
+    mov rsi, 676
+    cmp rcx, rsi
+    jge .LB2024
+.LB2023:
+    mov rax, 8796088827906
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2024:
+    mov rax, 4611688217451692033
+    imul rbx
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2025:
+.LB2026:
+    jmp .LB2034
+.LB2027:
+    mov rsi, 678
+    cmp rcx, rsi
+    jge .LB2029
+.LB2028:
+    mov rax, rbx
+    cqo
+    shr rdx, 43
+    add rax, rdx
+    sar rax, 21
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2029:
+    mov rsi, 679
+    cmp rcx, rsi
+    jge .LB2031
+.LB2030:
+    mov rax, 8796088827906
+    imul rbx
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2031:
+    mov rax, -9223369837830995967
+    imul rbx
+    add rdx, rbx
+    sar rdx, 21
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2032:
+.LB2033:
+.LB2034:
+.LB2035:
+    jmp .LB2070
+.LB2036:
+    mov rsi, 686
+    cmp rcx, rsi
+    jge .LB2053
+.LB2037:
+    mov rsi, 683
+    cmp rcx, rsi
+    jge .LB2045
+.LB2038:
+    mov rsi, 681
+    cmp rcx, rsi
+    jge .LB2040
+.LB2039:
+    mov rax, rbx
+    cqo
+    shr rdx, 42
+    add rax, rdx
+    sar rax, 22
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2040:
+    mov rsi, 682
+    cmp rcx, rsi
+    jge .LB2042
+.LB2041:
+    mov rax, 17592181850113
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2042:
+    mov rax, -9223369837830995967
+    imul rbx
+    add rdx, rbx
+    sar rdx, 21
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2043:
+.LB2044:
+    jmp .LB2052
+.LB2045:
+    mov rsi, 684
+    cmp rcx, rsi
+    jge .LB2047
+.LB2046:
+    mov rax, rbx
+    cqo
+    shr rdx, 42
+    add rax, rdx
+    sar rax, 22
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2047:
+    mov rsi, 685
+    cmp rcx, rsi
+    jge .LB2049
+.LB2048:
+    mov rax, 17592181850113
+    imul rbx
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2049:
+    mov rax, -9223370937343016959
+    imul rbx
+    add rdx, rbx
+    sar rdx, 22
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2050:
+.LB2051:
+.LB2052:
+    jmp .LB2069
+.LB2053:
+    mov rsi, 689
+    cmp rcx, rsi
+    jge .LB2061
+.LB2054:
+    mov rsi, 687
+    cmp rcx, rsi
+    jge .LB2056
+.LB2055:
+    mov rax, rbx
+    cqo
+    shr rdx, 41
+    add rax, rdx
+    sar rax, 23
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2056:
+    mov rsi, 688
+    cmp rcx, rsi
+    jge .LB2058
+.LB2057:
+    mov rax, 70368735789057
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2058:
+    mov rax, -9223370937343016959
+    imul rbx
+    add rdx, rbx
+    sar rdx, 22
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2059:
+.LB2060:
+    jmp .LB2068
+.LB2061:
+    mov rsi, 690
+    cmp rcx, rsi
+    jge .LB2063
+.LB2062:
+    mov rax, rbx
+    cqo
+    shr rdx, 41
+    add rax, rdx
+    sar rax, 23
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2063:
+    mov rsi, 691
+    cmp rcx, rsi
+    jge .LB2065
+.LB2064:
+    mov rax, 70368735789057
+    imul rbx
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2065:
+    mov rax, -9223371487098929151
+    imul rbx
+    add rdx, rbx
+    sar rdx, 23
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2066:
+.LB2067:
+.LB2068:
+.LB2069:
+.LB2070:
+.LB2071:
+    jmp .LB2211
+.LB2072:
+    mov rsi, 715
+    cmp rcx, rsi
+    jge .LB2140
+.LB2073:
+    mov rsi, 703
+    cmp rcx, rsi
+    jge .LB2105
+.LB2074:
+    mov rsi, 697
+    cmp rcx, rsi
+    jge .LB2088
+.LB2075:
+    mov rsi, 694
+    cmp rcx, rsi
+    jge .LB2080
+.LB2076:
+    mov rsi, 693
+    cmp rcx, rsi
+    jge .LB2078
+.LB2077:
+    mov rax, rbx
+    cqo
+    shr rdx, 40
+    add rax, rdx
+    sar rax, 24
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2078:
+    mov rax, 281474959933441
+    imul rbx
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2079:
+    jmp .LB2087
+.LB2080:
+    mov rsi, 695
+    cmp rcx, rsi
+    jge .LB2082
+.LB2081:
+    mov rax, -9223371487098929151
+    imul rbx
+    add rdx, rbx
+    sar rdx, 23
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2082:
+    mov rsi, 696
+    cmp rcx, rsi
+    jge .LB2084
+.LB2083:
+    mov rax, rbx
+    cqo
+    shr rdx, 40
+    add rax, rdx
+    sar rax, 24
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2084:
+    mov rax, 281474959933441
+    imul rbx
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2085:
+.LB2086:
+.LB2087:
+    jmp .LB2104
+.LB2088:
+    mov rsi, 700
+    cmp rcx, rsi
+    jge .LB2096
+.LB2089:
+    mov rsi, 698
+    cmp rcx, rsi
+    jge .LB2091
+.LB2090:
+    mov rax, -9223371761976860671
+    imul rbx
+    add rdx, rbx
+    sar rdx, 24
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2091:
+    mov rsi, 699
+    cmp rcx, rsi
+    jge .LB2093
+.LB2092:
+    mov rax, rbx
+    cqo
+    shr rdx, 39
+    add rax, rdx
+    sar rax, 25
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2093:
+    mov rax, 1125899873288193
+    imul rbx
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2094:
+.LB2095:
+    jmp .LB2103
+.LB2096:
+    mov rsi, 701
+    cmp rcx, rsi
+    jge .LB2098
+.LB2097:
+    mov rax, -9223371761976860671
+    imul rbx
+    add rdx, rbx
+    sar rdx, 24
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2098:
+    mov rsi, 702
+    cmp rcx, rsi
+    jge .LB2100
+.LB2099:
+    mov rax, rbx
+    cqo
+    shr rdx, 39
+    add rax, rdx
+    sar rax, 25
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2100:
+    mov rax, 1125899873288193
+    imul rbx
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2101:
+.LB2102:
+.LB2103:
+.LB2104:
+    jmp .LB2139
+.LB2105:
+    mov rsi, 709
+    cmp rcx, rsi
+    jge .LB2122
+.LB2106:
+    mov rsi, 706
+    cmp rcx, rsi
+    jge .LB2114
+.LB2107:
+    mov rsi, 704
+    cmp rcx, rsi
+    jge .LB2109
+.LB2108:
+    mov rax, -9223371899415820287
+    imul rbx
+    add rdx, rbx
+    sar rdx, 25
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2109:
+    mov rsi, 705
+    cmp rcx, rsi
+    jge .LB2111
+.LB2110:
+    mov rax, rbx
+    cqo
+    shr rdx, 38
+    add rax, rdx
+    sar rax, 26
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2111:
+    mov rax, 4503599560261633
+    imul rbx
+    sar rdx, 14
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2112:
+.LB2113:
+    jmp .LB2121
+.LB2114:
+    mov rsi, 707
+    cmp rcx, rsi
+    jge .LB2116
+.LB2115:
+    mov rax, -9223371899415820287
+    imul rbx
+    add rdx, rbx
+    sar rdx, 25
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2116:
+    mov rsi, 708
+    cmp rcx, rsi
+    jge .LB2118
+.LB2117:
+    mov rax, rbx
+    cqo
+    shr rdx, 38
+    add rax, rdx
+    sar rax, 26
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2118:
+    mov rax, 4503599560261633
+    imul rbx
+    sar rdx, 14
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2119:
+.LB2120:
+.LB2121:
+    jmp .LB2138
+.LB2122:
+    mov rsi, 712
+    cmp rcx, rsi
+    jge .LB2130
+.LB2123:
+    mov rsi, 710
+    cmp rcx, rsi
+    jge .LB2125
+.LB2124:
+    mov rax, -9223371968135298559
+    imul rbx
+    add rdx, rbx
+    sar rdx, 26
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2125:
+    mov rsi, 711
+    cmp rcx, rsi
+    jge .LB2127
+.LB2126:
+    mov rax, rbx
+    cqo
+    shr rdx, 37
+    add rax, rdx
+    sar rax, 27
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2127:
+    mov rax, 18014398375264257
+    imul rbx
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2128:
+.LB2129:
+    jmp .LB2137
+.LB2130:
+    mov rsi, 713
+    cmp rcx, rsi
+    jge .LB2132
+.LB2131:
+    mov rax, -9223371968135298559
+    imul rbx
+    add rdx, rbx
+    sar rdx, 26
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2132:
+    mov rsi, 714
+    cmp rcx, rsi
+    jge .LB2134
+.LB2133:
+    mov rax, rbx
+    cqo
+    shr rdx, 37
+    add rax, rdx
+    sar rax, 27
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2134:
+    mov rax, 18014398375264257
+    imul rbx
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2135:
+.LB2136:
+.LB2137:
+.LB2138:
+.LB2139:
+    jmp .LB2210
+.LB2140:
+    mov rsi, 727
+    cmp rcx, rsi
+    jge .LB2175
+.LB2141:
+    mov rsi, 721
+    cmp rcx, rsi
+    jge .LB2158
+.LB2142:
+    mov rsi, 718
+    cmp rcx, rsi
+    jge .LB2150
+.LB2143:
+    mov rsi, 716
+    cmp rcx, rsi
+    jge .LB2145
+.LB2144:
+    mov rax, -9223372002495037311
+    imul rbx
+    add rdx, rbx
+    sar rdx, 27
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2145:
+    mov rsi, 717
+    cmp rcx, rsi
+    jge .LB2147
+.LB2146:
+    mov rax, rbx
+    cqo
+    shr rdx, 36
+    add rax, rdx
+    sar rax, 28
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2147:
+    mov rax, 72057593769492481
+    imul rbx
+    sar rdx, 20
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2148:
+.LB2149:
+    jmp .LB2157
+.LB2150:
+    mov rsi, 719
+    cmp rcx, rsi
+    jge .LB2152
+.LB2151:
+    mov rax, -9223372002495037311
+    imul rbx
+    add rdx, rbx
+    sar rdx, 27
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2152:
+    mov rsi, 720
+    cmp rcx, rsi
+    jge .LB2154
+.LB2153:
+    mov rax, rbx
+    cqo
+    shr rdx, 36
+    add rax, rdx
+    sar rax, 28
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2154:
+    mov rax, 72057593769492481
+    imul rbx
+    sar rdx, 20
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2155:
+.LB2156:
+.LB2157:
+    jmp .LB2174
+.LB2158:
+    mov rsi, 724
+    cmp rcx, rsi
+    jge .LB2166
+.LB2159:
+    mov rsi, 722
+    cmp rcx, rsi
+    jge .LB2161
+.LB2160:
+    mov rax, -9223372019674906591
+    imul rbx
+    add rdx, rbx
+    sar rdx, 28
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2161:
+    mov rsi, 723
+    cmp rcx, rsi
+    jge .LB2163
+.LB2162:
+    mov rax, rbx
+    cqo
+    shr rdx, 35
+    add rax, rdx
+    sar rax, 29
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2163:
+    mov rax, 288230375614840833
+    imul rbx
+    sar rdx, 23
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2164:
+.LB2165:
+    jmp .LB2173
+.LB2166:
+    mov rsi, 725
+    cmp rcx, rsi
+    jge .LB2168
+.LB2167:
+    mov rax, -9223372019674906591
+    imul rbx
+    add rdx, rbx
+    sar rdx, 28
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2168:
+    mov rsi, 726
+    cmp rcx, rsi
+    jge .LB2170
+.LB2169:
+    mov rax, rbx
+    cqo
+    shr rdx, 35
+    add rax, rdx
+    sar rax, 29
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2170:
+    mov rax, 288230375614840833
+    imul rbx
+    sar rdx, 23
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2171:
+.LB2172:
+.LB2173:
+.LB2174:
+    jmp .LB2209
+.LB2175:
+    mov rsi, 733
+    cmp rcx, rsi
+    jge .LB2192
+.LB2176:
+    mov rsi, 730
+    cmp rcx, rsi
+    jge .LB2184
+.LB2177:
+    mov rsi, 728
+    cmp rcx, rsi
+    jge .LB2179
+.LB2178:
+    mov rax, -9223372028264841207
+    imul rbx
+    add rdx, rbx
+    sar rdx, 29
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2179:
+    mov rsi, 729
+    cmp rcx, rsi
+    jge .LB2181
+.LB2180:
+    mov rax, rbx
+    cqo
+    shr rdx, 34
+    add rax, rdx
+    sar rax, 30
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2181:
+    mov rax, 1152921503533105153
+    imul rbx
+    sar rdx, 26
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2182:
+.LB2183:
+    jmp .LB2191
+.LB2184:
+    mov rsi, 731
+    cmp rcx, rsi
+    jge .LB2186
+.LB2185:
+    mov rax, -9223372028264841207
+    imul rbx
+    add rdx, rbx
+    sar rdx, 29
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2186:
+    mov rsi, 732
+    cmp rcx, rsi
+    jge .LB2188
+.LB2187:
+    mov rax, rbx
+    cqo
+    shr rdx, 34
+    add rax, rdx
+    sar rax, 30
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2188:
+    mov rax, 1152921503533105153
+    imul rbx
+    sar rdx, 26
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2189:
+.LB2190:
+.LB2191:
+    jmp .LB2208
+.LB2192:
+    mov rsi, 736
+    cmp rcx, rsi
+    jge .LB2200
+.LB2193:
+    mov rsi, 734
+    cmp rcx, rsi
+    jge .LB2195
+.LB2194:
+    mov rax, 7367186400732675841
+    imul rbx
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2195:
+    mov rsi, 735
+    cmp rcx, rsi
+    jge .LB2197
+.LB2196:
+    mov rax, -8775366530925146571
+    imul rbx
+    add rdx, rbx
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2197:
+    mov rax, -8775366530925146571
+    imul rbx
+    add rdx, rbx
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2198:
+.LB2199:
+    jmp .LB2207
+.LB2200:
+    mov rsi, 737
+    cmp rcx, rsi
+    jge .LB2202
+.LB2201:
+    mov rax, -9223372032559808509
+    imul rbx
+    add rdx, rbx
+    sar rdx, 30
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    mov rsi, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2202:
+    mov rsi, 738
+    cmp rcx, rsi
+    jge .LB2204
+.LB2203:
+    mov rax, -9223372032559808509
+    imul rbx
+    add rdx, rbx
+    sar rdx, 30
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+    mov rcx, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2204:
+    mov rax, rbx
+    cqo
+    shr rdx, 33
+    add rax, rdx
+    sar rax, 31
+    neg rax
+    mov rcx, rax
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
+.LB2205:
+.LB2206:
+.LB2207:
+.LB2208:
+.LB2209:
+.LB2210:
+.LB2211:
+.LB2212:
+.LB2213:
+.LB2214:
+    mov rcx, 0
+    mov rax, rcx
+  # return (embedded epilogue)
+    mov rbx, qword ptr [rbp-8]
+    mov rsp, rbp
+    pop rbp
+    ret
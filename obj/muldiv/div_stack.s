@@ -0,0 +1,18893 @@
+.intel_syntax noprefix
+.global div_stack
+div_stack:
+  # prologue
+    push rbp
+    mov rbp, rsp
+    sub rsp, 24
+
+  # push address
+    mov rax, rbp
+    sub rax, 8
+    push rax
+    call arg
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # push address
+    mov rax, rbp
+    sub rax, 16
+    push rax
+    call which
+    mov rdi, rax
+  # assign
+    pop rax
+    mov qword ptr [rax], rdi
+    mov rax, rdi
+  # discard
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 369
+    jge .Lelse0
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 184
+    jge .Lelse1
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 92
+    jge .Lelse2
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 46
+    jge .Lelse3
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 23
+    jge .Lelse4
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 11
+    jge .Lelse5
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 5
+    jge .Lelse6
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 2
+    jge .Lelse7
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 1
+    jge .Lelse8
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7870610804782742023
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse8:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7896933917842216077
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if8:
+.Lelse7:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 3
+    jge .Lelse9
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1980858424022502187
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse9:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 4
+    jge .Lelse10
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7950111924022971741
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse10:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3988485205126389539
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if10:
+.Lend_if9:
+.Lend_if7:
+.Lelse6:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 8
+    jge .Lelse11
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 6
+    jge .Lelse12
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8004010987914652905
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse12:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 7
+    jge .Lelse13
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2007808878771107659
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse13:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 503665367200260795
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if13:
+.Lend_if12:
+.Lelse11:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 9
+    jge .Lelse14
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8086243977516515777
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse14:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 10
+    jge .Lelse15
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8114031757507981467
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse15:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8142011177361457265
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if15:
+.Lend_if14:
+.Lend_if11:
+.Lend_if6:
+.Lelse5:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 17
+    jge .Lelse16
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 14
+    jge .Lelse17
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 12
+    jge .Lelse18
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1021273028302258913
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse18:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 13
+    jge .Lelse19
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1024819115206086201
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse19:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1028389913516908801
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if19:
+.Lend_if18:
+.Lelse17:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 15
+    jge .Lelse20
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1031985682445289601
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse20:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 16
+    jge .Lelse21
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4142426739359337907
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse21:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8314025498009938757
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if21:
+.Lend_if20:
+.Lend_if17:
+.Lelse16:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 20
+    jge .Lelse22
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 18
+    jge .Lelse23
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8343403679981705325
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse23:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 19
+    jge .Lelse24
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2093247554463495219
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse24:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -1641169401575582883
+    imul rdi
+    add rdx, rdi
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if24:
+.Lend_if23:
+.Lelse22:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 21
+    jge .Lelse25
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1054099661354831521
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse25:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 22
+    jge .Lelse26
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1057877796341766401
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse26:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4246732448623781667
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if26:
+.Lend_if25:
+.Lend_if22:
+.Lend_if16:
+.Lend_if5:
+.Lelse4:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 34
+    jge .Lelse27
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 28
+    jge .Lelse28
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 25
+    jge .Lelse29
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 24
+    jge .Lelse30
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8524127225396471505
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse30:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8555011744329067417
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if30:
+.Lelse29:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 26
+    jge .Lelse31
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1073265109743101185
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse31:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 27
+    jge .Lelse32
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -1211829902652452295
+    imul rdi
+    add rdx, rdi
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse32:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1081127857799827201
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if32:
+.Lend_if31:
+.Lend_if29:
+.Lelse28:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 31
+    jge .Lelse33
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 29
+    jge .Lelse34
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8680820740569200761
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse34:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 30
+    jge .Lelse35
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4356426644713694847
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse35:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8745123116425268915
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if35:
+.Lend_if34:
+.Lelse33:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 32
+    jge .Lelse36
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2194408216946861159
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse36:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 33
+    jge .Lelse37
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8810385229234412713
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse37:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8843382926722182049
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if37:
+.Lend_if36:
+.Lend_if33:
+.Lend_if28:
+.Lelse27:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 40
+    jge .Lelse38
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 37
+    jge .Lelse39
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 35
+    jge .Lelse40
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8876628727198581229
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse40:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 36
+    jge .Lelse41
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8910125439376689083
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse41:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1117984489315730401
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if41:
+.Lend_if40:
+.Lelse39:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 38
+    jge .Lelse42
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8977883047280694323
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse42:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 39
+    jge .Lelse43
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 281629680514649643
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse43:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9046679085957174739
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if43:
+.Lend_if42:
+.Lend_if39:
+.Lelse38:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 43
+    jge .Lelse44
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 41
+    jge .Lelse45
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1135184250689818561
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse45:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 42
+    jge .Lelse46
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9116537611717461803
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse46:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 71499008037633921
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if46:
+.Lend_if45:
+.Lelse44:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 44
+    jge .Lelse47
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9187483429707480961
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse47:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 45
+    jge .Lelse48
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 56
+    add rax, rdx
+    sar rax, 8
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse48:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9187201950435737471
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if48:
+.Lend_if47:
+.Lend_if44:
+.Lend_if38:
+.Lend_if27:
+.Lend_if4:
+.Lelse3:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 69
+    jge .Lelse49
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 57
+    jge .Lelse50
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 51
+    jge .Lelse51
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 48
+    jge .Lelse52
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 47
+    jge .Lelse53
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4647998506761461825
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse53:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1166592510590327375
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if53:
+.Lelse52:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 49
+    jge .Lelse54
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9076969306111049207
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse54:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 50
+    jge .Lelse55
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2351776136887273513
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse55:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2361183241434822607
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if55:
+.Lend_if54:
+.Lend_if52:
+.Lelse51:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 54
+    jge .Lelse56
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 52
+    jge .Lelse57
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1185332952527521389
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse57:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 53
+    jge .Lelse58
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8925843906633654007
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse58:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8887297752111079523
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if58:
+.Lend_if57:
+.Lelse56:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 55
+    jge .Lelse59
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8848438214218402807
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse59:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 56
+    jge .Lelse60
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8809261455608234853
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse60:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8769763576025852407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if60:
+.Lend_if59:
+.Lend_if56:
+.Lend_if51:
+.Lelse50:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 63
+    jge .Lelse61
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 60
+    jge .Lelse62
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 58
+    jge .Lelse63
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8729940611014808377
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse63:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 59
+    jge .Lelse64
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4878477771559550841
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse64:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1224680104478642431
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if64:
+.Lend_if63:
+.Lelse62:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 61
+    jge .Lelse65
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8608480567731124087
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse65:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 62
+    jge .Lelse66
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8567316285279331503
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse66:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8525806084487607889
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if66:
+.Lend_if65:
+.Lend_if62:
+.Lelse61:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 66
+    jge .Lelse67
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 64
+    jge .Lelse68
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8483945586642789561
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse68:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 65
+    jge .Lelse69
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8441730338816235485
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse69:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8399155812284774565
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if69:
+.Lend_if68:
+.Lelse67:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 67
+    jge .Lelse70
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8356217400911164407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse70:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 68
+    jge .Lelse71
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2533458413556676617
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse71:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5088756985850910791
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if71:
+.Lend_if70:
+.Lend_if67:
+.Lend_if61:
+.Lend_if50:
+.Lelse49:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 80
+    jge .Lelse72
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 74
+    jge .Lelse73
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 71
+    jge .Lelse74
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 70
+    jge .Lelse75
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8225171599965730807
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse75:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2566503523298720225
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if75:
+.Lelse74:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 72
+    jge .Lelse76
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8135900224649190887
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse76:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 73
+    jge .Lelse77
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 161813544506224137
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse77:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8045055785450421189
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if77:
+.Lend_if76:
+.Lend_if74:
+.Lelse73:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 77
+    jge .Lelse78
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 75
+    jge .Lelse79
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5223856728838103113
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse79:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 76
+    jge .Lelse80
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5247073869855161349
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse80:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if80:
+.Lend_if79:
+.Lelse78:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 78
+    jge .Lelse81
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7858478417051154275
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse81:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 79
+    jge .Lelse82
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7810783526705846179
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse82:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5342043532657969699
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if82:
+.Lend_if81:
+.Lend_if78:
+.Lend_if73:
+.Lelse72:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 86
+    jge .Lelse83
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 83
+    jge .Lelse84
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 81
+    jge .Lelse85
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5366325548715505925
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse85:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 82
+    jge .Lelse86
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7665085437020863913
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse86:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7615628287311282777
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if86:
+.Lend_if85:
+.Lelse84:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 84
+    jge .Lelse87
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5440514381186227205
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse87:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 85
+    jge .Lelse88
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 341606371735362067
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse88:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7464496439128981351
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if88:
+.Lend_if87:
+.Lend_if84:
+.Lelse83:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 89
+    jge .Lelse89
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 87
+    jge .Lelse90
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1379195818595106663
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse90:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 88
+    jge .Lelse91
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7361376743029633273
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse91:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5568828399610430677
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if91:
+.Lend_if90:
+.Lelse89:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 90
+    jge .Lelse92
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5595220951267352149
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse92:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 91
+    jge .Lelse93
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5621864860559101445
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse93:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5648763735490006237
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if93:
+.Lend_if92:
+.Lend_if89:
+.Lend_if83:
+.Lend_if72:
+.Lend_if49:
+.Lend_if3:
+.Lelse2:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 138
+    jge .Lelse94
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 115
+    jge .Lelse95
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 103
+    jge .Lelse96
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 97
+    jge .Lelse97
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 94
+    jge .Lelse98
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 93
+    jge .Lelse99
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5675921253449092805
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse99:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7040061747937461727
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if99:
+.Lelse98:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 95
+    jge .Lelse100
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6984689503637597213
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse100:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 96
+    jge .Lelse101
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5758983515694689285
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse101:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6872316419617283935
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if101:
+.Lend_if100:
+.Lend_if98:
+.Lelse97:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 100
+    jge .Lelse102
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 98
+    jge .Lelse103
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5815722269543898047
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse103:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 99
+    jge .Lelse104
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6757718126012409997
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse104:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6699563768063667999
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if104:
+.Lend_if103:
+.Lelse102:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 101
+    jge .Lelse105
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6640827866535438581
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse105:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 102
+    jge .Lelse106
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5932621209635232681
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse106:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6521576187675094005
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if106:
+.Lend_if105:
+.Lend_if102:
+.Lend_if97:
+.Lelse96:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 109
+    jge .Lelse107
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 106
+    jge .Lelse108
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 104
+    jge .Lelse109
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1498212716646461045
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse109:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 105
+    jge .Lelse110
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6023426636313322977
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse110:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6338112066351486965
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if110:
+.Lend_if109:
+.Lelse108:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 107
+    jge .Lelse111
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6275696437447579415
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse111:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 108
+    jge .Lelse112
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1529263757405973191
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse112:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if112:
+.Lend_if111:
+.Lend_if108:
+.Lelse107:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 112
+    jge .Lelse113
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 110
+    jge .Lelse114
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6181107961871263369
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse114:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 111
+    jge .Lelse115
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6019463855631537895
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse115:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6246516511732334939
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if115:
+.Lend_if114:
+.Lelse113:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 113
+    jge .Lelse116
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6279742663390485657
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse116:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 114
+    jge .Lelse117
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6313324174959418735
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse117:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3173633389025299203
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if117:
+.Lend_if116:
+.Lend_if113:
+.Lend_if107:
+.Lend_if96:
+.Lelse95:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 126
+    jge .Lelse118
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 120
+    jge .Lelse119
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 117
+    jge .Lelse120
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 116
+    jge .Lelse121
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3190788164101111631
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse121:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5614226457215950491
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if121:
+.Lelse120:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 118
+    jge .Lelse122
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3225660165894566403
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse122:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 119
+    jge .Lelse123
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3243383573399481603
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse123:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 407662852457669649
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if123:
+.Lend_if122:
+.Lend_if120:
+.Lelse119:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 123
+    jge .Lelse124
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 121
+    jge .Lelse125
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3279421168659475843
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse125:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 122
+    jge .Lelse126
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6595483914622409517
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse126:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5181669683626278543
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if126:
+.Lend_if125:
+.Lelse124:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 124
+    jge .Lelse127
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5106725760518463441
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse127:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 125
+    jge .Lelse128
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3353953467947191203
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse128:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3373118916335460867
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if128:
+.Lend_if127:
+.Lend_if124:
+.Lend_if119:
+.Lelse118:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 132
+    jge .Lelse129
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 129
+    jge .Lelse130
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 127
+    jge .Lelse131
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4876725444773789507
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse131:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 128
+    jge .Lelse132
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3412114510743963305
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse132:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 214497024112901763
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if132:
+.Lend_if131:
+.Lelse130:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 130
+    jge .Lelse133
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 107875696337482758
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse133:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 131
+    jge .Lelse134
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6944656592455360609
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse134:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1746437308753567017
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if134:
+.Lend_if133:
+.Lend_if130:
+.Lelse129:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 135
+    jge .Lelse135
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 133
+    jge .Lelse136
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4392081922311798003
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse136:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 134
+    jge .Lelse137
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7069410902499468883
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse137:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3555998857582564167
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if137:
+.Lend_if136:
+.Lelse135:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 136
+    jge .Lelse138
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4136542610468202483
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse138:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 137
+    jge .Lelse139
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7198729394618361607
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse139:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7242893378634425175
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if139:
+.Lend_if138:
+.Lend_if135:
+.Lend_if129:
+.Lend_if118:
+.Lend_if95:
+.Lelse94:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 161
+    jge .Lelse140
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 149
+    jge .Lelse141
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 143
+    jge .Lelse142
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 140
+    jge .Lelse143
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 139
+    jge .Lelse144
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7287602597021057429
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse144:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -3781009654859721759
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if144:
+.Lelse143:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 141
+    jge .Lelse145
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse145:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 142
+    jge .Lelse146
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7425104532813907569
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse146:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7472098865300071541
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if146:
+.Lend_if145:
+.Lend_if143:
+.Lelse142:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 146
+    jge .Lelse147
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 144
+    jge .Lelse148
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3759845925851628355
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse148:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 145
+    jge .Lelse149
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7567895004598790407
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse149:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7616720133660718087
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if149:
+.Lend_if148:
+.Lelse147:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 147
+    jge .Lelse150
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7666179355307865607
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse150:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 148
+    jge .Lelse151
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3858142551364089227
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse151:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 485440633518672411
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if151:
+.Lend_if150:
+.Lend_if147:
+.Lend_if142:
+.Lelse141:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 155
+    jge .Lelse152
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 152
+    jge .Lelse153
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 150
+    jge .Lelse154
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7818487554419942407
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse154:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 151
+    jge .Lelse155
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7870610804782742023
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse155:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1980858424022502187
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if155:
+.Lend_if154:
+.Lelse153:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 153
+    jge .Lelse156
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3988485205126389539
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse156:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 154
+    jge .Lelse157
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2007808878771107659
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse157:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8086243977516515777
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if157:
+.Lend_if156:
+.Lend_if153:
+.Lelse152:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 158
+    jge .Lelse158
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 156
+    jge .Lelse159
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8142011177361457265
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse159:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 157
+    jge .Lelse160
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1024819115206086201
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse160:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1031985682445289601
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if160:
+.Lend_if159:
+.Lelse158:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 159
+    jge .Lelse161
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8314025498009938757
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse161:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 160
+    jge .Lelse162
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2093247554463495219
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse162:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1054099661354831521
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if162:
+.Lend_if161:
+.Lend_if158:
+.Lend_if152:
+.Lend_if141:
+.Lelse140:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 172
+    jge .Lelse163
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 166
+    jge .Lelse164
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 163
+    jge .Lelse165
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 162
+    jge .Lelse166
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4246732448623781667
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse166:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8555011744329067417
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if166:
+.Lelse165:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 164
+    jge .Lelse167
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -1211829902652452295
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse167:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 165
+    jge .Lelse168
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8680820740569200761
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse168:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8745123116425268915
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if168:
+.Lend_if167:
+.Lend_if165:
+.Lelse164:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 169
+    jge .Lelse169
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 167
+    jge .Lelse170
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8810385229234412713
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse170:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 168
+    jge .Lelse171
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8876628727198581229
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse171:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1117984489315730401
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if171:
+.Lend_if170:
+.Lelse169:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 170
+    jge .Lelse172
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 281629680514649643
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse172:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 171
+    jge .Lelse173
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1135184250689818561
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse173:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 142998016075267842
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if173:
+.Lend_if172:
+.Lend_if169:
+.Lend_if164:
+.Lelse163:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 178
+    jge .Lelse174
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 175
+    jge .Lelse175
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 173
+    jge .Lelse176
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 57
+    add rax, rdx
+    sar rax, 7
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse176:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 174
+    jge .Lelse177
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4647998506761461825
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse177:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9076969306111049207
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if177:
+.Lend_if176:
+.Lelse175:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 176
+    jge .Lelse178
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2361183241434822607
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse178:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 177
+    jge .Lelse179
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8925843906633654007
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse179:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8848438214218402807
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if179:
+.Lend_if178:
+.Lend_if175:
+.Lelse174:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 181
+    jge .Lelse180
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 179
+    jge .Lelse181
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8769763576025852407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse181:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 180
+    jge .Lelse182
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4878477771559550841
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse182:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8608480567731124087
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if182:
+.Lend_if181:
+.Lelse180:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 182
+    jge .Lelse183
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8525806084487607889
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse183:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 183
+    jge .Lelse184
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8441730338816235485
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse184:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8356217400911164407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if184:
+.Lend_if183:
+.Lend_if180:
+.Lend_if174:
+.Lend_if163:
+.Lend_if140:
+.Lend_if94:
+.Lend_if2:
+.Lelse1:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 276
+    jge .Lelse185
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 230
+    jge .Lelse186
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 207
+    jge .Lelse187
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 195
+    jge .Lelse188
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 189
+    jge .Lelse189
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 186
+    jge .Lelse190
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 185
+    jge .Lelse191
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5088756985850910791
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse191:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2566503523298720225
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if191:
+.Lelse190:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 187
+    jge .Lelse192
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 161813544506224137
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse192:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 188
+    jge .Lelse193
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5223856728838103113
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse193:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if193:
+.Lend_if192:
+.Lend_if190:
+.Lelse189:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 192
+    jge .Lelse194
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 190
+    jge .Lelse195
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7810783526705846179
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse195:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 191
+    jge .Lelse196
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5366325548715505925
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse196:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7615628287311282777
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if196:
+.Lend_if195:
+.Lelse194:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 193
+    jge .Lelse197
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 341606371735362067
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse197:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 194
+    jge .Lelse198
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1379195818595106663
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse198:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5568828399610430677
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if198:
+.Lend_if197:
+.Lend_if194:
+.Lend_if189:
+.Lelse188:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 201
+    jge .Lelse199
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 198
+    jge .Lelse200
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 196
+    jge .Lelse201
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5621864860559101445
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse201:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 197
+    jge .Lelse202
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5675921253449092805
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse202:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6984689503637597213
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if202:
+.Lend_if201:
+.Lelse200:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 199
+    jge .Lelse203
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6872316419617283935
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse203:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 200
+    jge .Lelse204
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6757718126012409997
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse204:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6640827866535438581
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if204:
+.Lend_if203:
+.Lend_if200:
+.Lelse199:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 204
+    jge .Lelse205
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 202
+    jge .Lelse206
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6521576187675094005
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse206:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 203
+    jge .Lelse207
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6023426636313322977
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse207:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6275696437447579415
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if207:
+.Lend_if206:
+.Lelse205:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 205
+    jge .Lelse208
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse208:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 206
+    jge .Lelse209
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6019463855631537895
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse209:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6279742663390485657
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if209:
+.Lend_if208:
+.Lend_if205:
+.Lend_if199:
+.Lend_if188:
+.Lelse187:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 218
+    jge .Lelse210
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 212
+    jge .Lelse211
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 209
+    jge .Lelse212
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 208
+    jge .Lelse213
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3173633389025299203
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse213:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5614226457215950491
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if213:
+.Lelse212:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 210
+    jge .Lelse214
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3243383573399481603
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse214:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 211
+    jge .Lelse215
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3279421168659475843
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse215:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5181669683626278543
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if215:
+.Lend_if214:
+.Lend_if212:
+.Lelse211:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 215
+    jge .Lelse216
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 213
+    jge .Lelse217
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3353953467947191203
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse217:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 214
+    jge .Lelse218
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4876725444773789507
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse218:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 214497024112901763
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if218:
+.Lend_if217:
+.Lelse216:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 216
+    jge .Lelse219
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6944656592455360609
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse219:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 217
+    jge .Lelse220
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4392081922311798003
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse220:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3555998857582564167
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if220:
+.Lend_if219:
+.Lend_if216:
+.Lend_if211:
+.Lelse210:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 224
+    jge .Lelse221
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 221
+    jge .Lelse222
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 219
+    jge .Lelse223
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7198729394618361607
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse223:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 220
+    jge .Lelse224
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7287602597021057429
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse224:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if224:
+.Lend_if223:
+.Lelse222:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 222
+    jge .Lelse225
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7472098865300071541
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse225:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 223
+    jge .Lelse226
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7567895004598790407
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse226:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7666179355307865607
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if226:
+.Lend_if225:
+.Lend_if222:
+.Lelse221:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 227
+    jge .Lelse227
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 225
+    jge .Lelse228
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 485440633518672411
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse228:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 226
+    jge .Lelse229
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7870610804782742023
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse229:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3988485205126389539
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if229:
+.Lend_if228:
+.Lelse227:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 228
+    jge .Lelse230
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8086243977516515777
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse230:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 229
+    jge .Lelse231
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1024819115206086201
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse231:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8314025498009938757
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if231:
+.Lend_if230:
+.Lend_if227:
+.Lend_if221:
+.Lend_if210:
+.Lend_if187:
+.Lelse186:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 253
+    jge .Lelse232
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 241
+    jge .Lelse233
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 235
+    jge .Lelse234
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 232
+    jge .Lelse235
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 231
+    jge .Lelse236
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1054099661354831521
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse236:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8555011744329067417
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if236:
+.Lelse235:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 233
+    jge .Lelse237
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8680820740569200761
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse237:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 234
+    jge .Lelse238
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8810385229234412713
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse238:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1117984489315730401
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if238:
+.Lend_if237:
+.Lend_if235:
+.Lelse234:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 238
+    jge .Lelse239
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 236
+    jge .Lelse240
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1135184250689818561
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse240:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 237
+    jge .Lelse241
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 58
+    add rax, rdx
+    sar rax, 6
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse241:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9076969306111049207
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if241:
+.Lend_if240:
+.Lelse239:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 239
+    jge .Lelse242
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8925843906633654007
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse242:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 240
+    jge .Lelse243
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8769763576025852407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse243:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8608480567731124087
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if243:
+.Lend_if242:
+.Lend_if239:
+.Lend_if234:
+.Lelse233:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 247
+    jge .Lelse244
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 244
+    jge .Lelse245
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 242
+    jge .Lelse246
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8441730338816235485
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse246:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 243
+    jge .Lelse247
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5088756985850910791
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse247:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 323627089012448274
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if247:
+.Lend_if246:
+.Lelse245:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 245
+    jge .Lelse248
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse248:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 246
+    jge .Lelse249
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5366325548715505925
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse249:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 341606371735362067
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if249:
+.Lend_if248:
+.Lend_if245:
+.Lelse244:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 250
+    jge .Lelse250
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 248
+    jge .Lelse251
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5568828399610430677
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse251:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 249
+    jge .Lelse252
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5675921253449092805
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse252:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6872316419617283935
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if252:
+.Lend_if251:
+.Lelse250:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 251
+    jge .Lelse253
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6640827866535438581
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse253:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 252
+    jge .Lelse254
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6023426636313322977
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse254:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if254:
+.Lend_if253:
+.Lend_if250:
+.Lend_if244:
+.Lend_if233:
+.Lelse232:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 264
+    jge .Lelse255
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 258
+    jge .Lelse256
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 255
+    jge .Lelse257
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 254
+    jge .Lelse258
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6279742663390485657
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse258:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5614226457215950491
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if258:
+.Lelse257:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 256
+    jge .Lelse259
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3279421168659475843
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse259:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 257
+    jge .Lelse260
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3353953467947191203
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse260:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 428994048225803526
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if260:
+.Lend_if259:
+.Lend_if257:
+.Lelse256:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 261
+    jge .Lelse261
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 259
+    jge .Lelse262
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4392081922311798003
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse262:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 260
+    jge .Lelse263
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7198729394618361607
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse263:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if263:
+.Lend_if262:
+.Lelse261:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 262
+    jge .Lelse264
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7567895004598790407
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse264:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 263
+    jge .Lelse265
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 485440633518672411
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse265:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3988485205126389539
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if265:
+.Lend_if264:
+.Lend_if261:
+.Lend_if256:
+.Lelse255:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 270
+    jge .Lelse266
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 267
+    jge .Lelse267
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 265
+    jge .Lelse268
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1024819115206086201
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse268:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 266
+    jge .Lelse269
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1054099661354831521
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse269:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8680820740569200761
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if269:
+.Lend_if268:
+.Lelse267:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 268
+    jge .Lelse270
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1117984489315730401
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse270:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 269
+    jge .Lelse271
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 59
+    add rax, rdx
+    sar rax, 5
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse271:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8925843906633654007
+    imul rdi
+    add rdx, rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if271:
+.Lend_if270:
+.Lend_if267:
+.Lelse266:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 273
+    jge .Lelse272
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 271
+    jge .Lelse273
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8608480567731124087
+    imul rdi
+    add rdx, rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse273:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 272
+    jge .Lelse274
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5088756985850910791
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse274:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if274:
+.Lend_if273:
+.Lelse272:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 274
+    jge .Lelse275
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 683212743470724134
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse275:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 275
+    jge .Lelse276
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5675921253449092805
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse276:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6640827866535438581
+    imul rdi
+    add rdx, rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if276:
+.Lend_if275:
+.Lend_if272:
+.Lend_if266:
+.Lend_if255:
+.Lend_if232:
+.Lend_if186:
+.Lelse185:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 322
+    jge .Lelse277
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 299
+    jge .Lelse278
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 287
+    jge .Lelse279
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 281
+    jge .Lelse280
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 278
+    jge .Lelse281
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 277
+    jge .Lelse282
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse282:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5614226457215950491
+    imul rdi
+    add rdx, rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if282:
+.Lelse281:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 279
+    jge .Lelse283
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3353953467947191203
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse283:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 280
+    jge .Lelse284
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4392081922311798003
+    imul rdi
+    add rdx, rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse284:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if284:
+.Lend_if283:
+.Lend_if281:
+.Lelse280:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 284
+    jge .Lelse285
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 282
+    jge .Lelse286
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 970881267037344822
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse286:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 283
+    jge .Lelse287
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1024819115206086201
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse287:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8680820740569200761
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if287:
+.Lend_if286:
+.Lelse285:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 285
+    jge .Lelse288
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 60
+    add rax, rdx
+    sar rax, 4
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse288:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 286
+    jge .Lelse289
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8608480567731124087
+    imul rdi
+    add rdx, rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse289:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if289:
+.Lend_if288:
+.Lend_if285:
+.Lend_if280:
+.Lelse279:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 293
+    jge .Lelse290
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 290
+    jge .Lelse291
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 288
+    jge .Lelse292
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5675921253449092805
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse292:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 289
+    jge .Lelse293
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse293:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3353953467947191203
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if293:
+.Lend_if292:
+.Lelse291:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 291
+    jge .Lelse294
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse294:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 292
+    jge .Lelse295
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2049638230412172402
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse295:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 61
+    add rax, rdx
+    sar rax, 3
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if295:
+.Lend_if294:
+.Lend_if291:
+.Lelse290:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 296
+    jge .Lelse296
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 294
+    jge .Lelse297
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse297:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 295
+    jge .Lelse298
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse298:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if298:
+.Lend_if297:
+.Lelse296:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 297
+    jge .Lelse299
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 62
+    add rax, rdx
+    sar rax, 2
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse299:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 298
+    jge .Lelse300
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6148914691236517206
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse300:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 63
+    add rax, rdx
+    sar rax, 1
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if300:
+.Lend_if299:
+.Lend_if296:
+.Lend_if290:
+.Lend_if279:
+.Lelse278:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 310
+    jge .Lelse301
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 304
+    jge .Lelse302
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 301
+    jge .Lelse303
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 300
+    jge .Lelse304
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse304:
+    mov rax, 0
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if304:
+.Lelse303:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 302
+    jge .Lelse305
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse305:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 303
+    jge .Lelse306
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 63
+    add rax, rdx
+    sar rax, 1
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse306:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6148914691236517206
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if306:
+.Lend_if305:
+.Lend_if303:
+.Lelse302:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 307
+    jge .Lelse307
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 305
+    jge .Lelse308
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 62
+    add rax, rdx
+    sar rax, 2
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse308:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 306
+    jge .Lelse309
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse309:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if309:
+.Lend_if308:
+.Lelse307:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 308
+    jge .Lelse310
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse310:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 309
+    jge .Lelse311
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 61
+    add rax, rdx
+    sar rax, 3
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse311:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2049638230412172402
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if311:
+.Lend_if310:
+.Lend_if307:
+.Lend_if302:
+.Lelse301:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 316
+    jge .Lelse312
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 313
+    jge .Lelse313
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 311
+    jge .Lelse314
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse314:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 312
+    jge .Lelse315
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3353953467947191203
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse315:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if315:
+.Lend_if314:
+.Lelse313:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 314
+    jge .Lelse316
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5675921253449092805
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse316:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 315
+    jge .Lelse317
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse317:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8608480567731124087
+    imul rdi
+    add rdx, rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if317:
+.Lend_if316:
+.Lend_if313:
+.Lelse312:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 319
+    jge .Lelse318
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 317
+    jge .Lelse319
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 60
+    add rax, rdx
+    sar rax, 4
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse319:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 318
+    jge .Lelse320
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8680820740569200761
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse320:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1024819115206086201
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if320:
+.Lend_if319:
+.Lelse318:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 320
+    jge .Lelse321
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 970881267037344822
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse321:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 321
+    jge .Lelse322
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse322:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4392081922311798003
+    imul rdi
+    add rdx, rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if322:
+.Lend_if321:
+.Lend_if318:
+.Lend_if312:
+.Lend_if301:
+.Lend_if278:
+.Lelse277:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 345
+    jge .Lelse323
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 333
+    jge .Lelse324
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 327
+    jge .Lelse325
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 324
+    jge .Lelse326
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 323
+    jge .Lelse327
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3353953467947191203
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse327:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5614226457215950491
+    imul rdi
+    add rdx, rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if327:
+.Lelse326:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 325
+    jge .Lelse328
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse328:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 326
+    jge .Lelse329
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6640827866535438581
+    imul rdi
+    add rdx, rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse329:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5675921253449092805
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if329:
+.Lend_if328:
+.Lend_if326:
+.Lelse325:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 330
+    jge .Lelse330
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 328
+    jge .Lelse331
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 683212743470724134
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse331:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 329
+    jge .Lelse332
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse332:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5088756985850910791
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if332:
+.Lend_if331:
+.Lelse330:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 331
+    jge .Lelse333
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8608480567731124087
+    imul rdi
+    add rdx, rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse333:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 332
+    jge .Lelse334
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8925843906633654007
+    imul rdi
+    add rdx, rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse334:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 59
+    add rax, rdx
+    sar rax, 5
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if334:
+.Lend_if333:
+.Lend_if330:
+.Lend_if325:
+.Lelse324:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 339
+    jge .Lelse335
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 336
+    jge .Lelse336
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 334
+    jge .Lelse337
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1117984489315730401
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse337:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 335
+    jge .Lelse338
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8680820740569200761
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse338:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1054099661354831521
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if338:
+.Lend_if337:
+.Lelse336:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 337
+    jge .Lelse339
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1024819115206086201
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse339:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 338
+    jge .Lelse340
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3988485205126389539
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse340:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 485440633518672411
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if340:
+.Lend_if339:
+.Lend_if336:
+.Lelse335:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 342
+    jge .Lelse341
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 340
+    jge .Lelse342
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7567895004598790407
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse342:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 341
+    jge .Lelse343
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse343:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7198729394618361607
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if343:
+.Lend_if342:
+.Lelse341:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 343
+    jge .Lelse344
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4392081922311798003
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse344:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 344
+    jge .Lelse345
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 428994048225803526
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse345:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3353953467947191203
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if345:
+.Lend_if344:
+.Lend_if341:
+.Lend_if335:
+.Lend_if324:
+.Lelse323:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 357
+    jge .Lelse346
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 351
+    jge .Lelse347
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 348
+    jge .Lelse348
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 346
+    jge .Lelse349
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3279421168659475843
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse349:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 347
+    jge .Lelse350
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5614226457215950491
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse350:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6279742663390485657
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if350:
+.Lend_if349:
+.Lelse348:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 349
+    jge .Lelse351
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse351:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 350
+    jge .Lelse352
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6023426636313322977
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse352:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6640827866535438581
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if352:
+.Lend_if351:
+.Lend_if348:
+.Lelse347:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 354
+    jge .Lelse353
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 352
+    jge .Lelse354
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6872316419617283935
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse354:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 353
+    jge .Lelse355
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5675921253449092805
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse355:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5568828399610430677
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if355:
+.Lend_if354:
+.Lelse353:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 355
+    jge .Lelse356
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 341606371735362067
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse356:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 356
+    jge .Lelse357
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5366325548715505925
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse357:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if357:
+.Lend_if356:
+.Lend_if353:
+.Lend_if347:
+.Lelse346:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 363
+    jge .Lelse358
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 360
+    jge .Lelse359
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 358
+    jge .Lelse360
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 323627089012448274
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse360:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 359
+    jge .Lelse361
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5088756985850910791
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse361:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8441730338816235485
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if361:
+.Lend_if360:
+.Lelse359:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 361
+    jge .Lelse362
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8608480567731124087
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse362:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 362
+    jge .Lelse363
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8769763576025852407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse363:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8925843906633654007
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if363:
+.Lend_if362:
+.Lend_if359:
+.Lelse358:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 366
+    jge .Lelse364
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 364
+    jge .Lelse365
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9076969306111049207
+    imul rdi
+    add rdx, rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse365:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 365
+    jge .Lelse366
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 58
+    add rax, rdx
+    sar rax, 6
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse366:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1135184250689818561
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if366:
+.Lend_if365:
+.Lelse364:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 367
+    jge .Lelse367
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1117984489315730401
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse367:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 368
+    jge .Lelse368
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8810385229234412713
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse368:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8680820740569200761
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if368:
+.Lend_if367:
+.Lend_if364:
+.Lend_if358:
+.Lend_if346:
+.Lend_if323:
+.Lend_if277:
+.Lend_if185:
+.Lend_if1:
+.Lelse0:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 554
+    jge .Lelse369
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 461
+    jge .Lelse370
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 415
+    jge .Lelse371
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 392
+    jge .Lelse372
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 380
+    jge .Lelse373
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 374
+    jge .Lelse374
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 371
+    jge .Lelse375
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 370
+    jge .Lelse376
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8555011744329067417
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse376:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1054099661354831521
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if376:
+.Lelse375:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 372
+    jge .Lelse377
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8314025498009938757
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse377:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 373
+    jge .Lelse378
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1024819115206086201
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse378:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8086243977516515777
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if378:
+.Lend_if377:
+.Lend_if375:
+.Lelse374:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 377
+    jge .Lelse379
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 375
+    jge .Lelse380
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3988485205126389539
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse380:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 376
+    jge .Lelse381
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7870610804782742023
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse381:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 485440633518672411
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if381:
+.Lend_if380:
+.Lelse379:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 378
+    jge .Lelse382
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7666179355307865607
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse382:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 379
+    jge .Lelse383
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7567895004598790407
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse383:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7472098865300071541
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if383:
+.Lend_if382:
+.Lend_if379:
+.Lend_if374:
+.Lelse373:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 386
+    jge .Lelse384
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 383
+    jge .Lelse385
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 381
+    jge .Lelse386
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse386:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 382
+    jge .Lelse387
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7287602597021057429
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse387:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7198729394618361607
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if387:
+.Lend_if386:
+.Lelse385:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 384
+    jge .Lelse388
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3555998857582564167
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse388:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 385
+    jge .Lelse389
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4392081922311798003
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse389:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6944656592455360609
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if389:
+.Lend_if388:
+.Lend_if385:
+.Lelse384:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 389
+    jge .Lelse390
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 387
+    jge .Lelse391
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 214497024112901763
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse391:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 388
+    jge .Lelse392
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4876725444773789507
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse392:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3353953467947191203
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if392:
+.Lend_if391:
+.Lelse390:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 390
+    jge .Lelse393
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5181669683626278543
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse393:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 391
+    jge .Lelse394
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3279421168659475843
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse394:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3243383573399481603
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if394:
+.Lend_if393:
+.Lend_if390:
+.Lend_if384:
+.Lend_if373:
+.Lelse372:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 403
+    jge .Lelse395
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 397
+    jge .Lelse396
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 394
+    jge .Lelse397
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 393
+    jge .Lelse398
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5614226457215950491
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse398:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3173633389025299203
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if398:
+.Lelse397:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 395
+    jge .Lelse399
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6279742663390485657
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse399:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 396
+    jge .Lelse400
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6019463855631537895
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse400:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if400:
+.Lend_if399:
+.Lend_if397:
+.Lelse396:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 400
+    jge .Lelse401
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 398
+    jge .Lelse402
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6275696437447579415
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse402:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 399
+    jge .Lelse403
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6023426636313322977
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse403:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6521576187675094005
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if403:
+.Lend_if402:
+.Lelse401:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 401
+    jge .Lelse404
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6640827866535438581
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse404:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 402
+    jge .Lelse405
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6757718126012409997
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse405:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6872316419617283935
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if405:
+.Lend_if404:
+.Lend_if401:
+.Lend_if396:
+.Lelse395:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 409
+    jge .Lelse406
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 406
+    jge .Lelse407
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 404
+    jge .Lelse408
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6984689503637597213
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse408:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 405
+    jge .Lelse409
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5675921253449092805
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse409:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5621864860559101445
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if409:
+.Lend_if408:
+.Lelse407:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 407
+    jge .Lelse410
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5568828399610430677
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse410:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 408
+    jge .Lelse411
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1379195818595106663
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse411:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 341606371735362067
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if411:
+.Lend_if410:
+.Lend_if407:
+.Lelse406:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 412
+    jge .Lelse412
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 410
+    jge .Lelse413
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7615628287311282777
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse413:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 411
+    jge .Lelse414
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5366325548715505925
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse414:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7810783526705846179
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if414:
+.Lend_if413:
+.Lelse412:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 413
+    jge .Lelse415
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse415:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 414
+    jge .Lelse416
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5223856728838103113
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse416:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 161813544506224137
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if416:
+.Lend_if415:
+.Lend_if412:
+.Lend_if406:
+.Lend_if395:
+.Lend_if372:
+.Lelse371:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 438
+    jge .Lelse417
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 426
+    jge .Lelse418
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 420
+    jge .Lelse419
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 417
+    jge .Lelse420
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 416
+    jge .Lelse421
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2566503523298720225
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse421:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5088756985850910791
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if421:
+.Lelse420:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 418
+    jge .Lelse422
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8356217400911164407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse422:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 419
+    jge .Lelse423
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8441730338816235485
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse423:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8525806084487607889
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if423:
+.Lend_if422:
+.Lend_if420:
+.Lelse419:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 423
+    jge .Lelse424
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 421
+    jge .Lelse425
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8608480567731124087
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse425:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 422
+    jge .Lelse426
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4878477771559550841
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse426:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8769763576025852407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if426:
+.Lend_if425:
+.Lelse424:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 424
+    jge .Lelse427
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8848438214218402807
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse427:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 425
+    jge .Lelse428
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8925843906633654007
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse428:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2361183241434822607
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if428:
+.Lend_if427:
+.Lend_if424:
+.Lend_if419:
+.Lelse418:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 432
+    jge .Lelse429
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 429
+    jge .Lelse430
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 427
+    jge .Lelse431
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9076969306111049207
+    imul rdi
+    add rdx, rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse431:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 428
+    jge .Lelse432
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4647998506761461825
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse432:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 57
+    add rax, rdx
+    sar rax, 7
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if432:
+.Lend_if431:
+.Lelse430:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 430
+    jge .Lelse433
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 142998016075267842
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse433:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 431
+    jge .Lelse434
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1135184250689818561
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse434:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 281629680514649643
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if434:
+.Lend_if433:
+.Lend_if430:
+.Lelse429:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 435
+    jge .Lelse435
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 433
+    jge .Lelse436
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1117984489315730401
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse436:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 434
+    jge .Lelse437
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8876628727198581229
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse437:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8810385229234412713
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if437:
+.Lend_if436:
+.Lelse435:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 436
+    jge .Lelse438
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8745123116425268915
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse438:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 437
+    jge .Lelse439
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8680820740569200761
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse439:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -1211829902652452295
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if439:
+.Lend_if438:
+.Lend_if435:
+.Lend_if429:
+.Lend_if418:
+.Lelse417:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 449
+    jge .Lelse440
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 443
+    jge .Lelse441
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 440
+    jge .Lelse442
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 439
+    jge .Lelse443
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8555011744329067417
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse443:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4246732448623781667
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if443:
+.Lelse442:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 441
+    jge .Lelse444
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1054099661354831521
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse444:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 442
+    jge .Lelse445
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2093247554463495219
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse445:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8314025498009938757
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if445:
+.Lend_if444:
+.Lend_if442:
+.Lelse441:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 446
+    jge .Lelse446
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 444
+    jge .Lelse447
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1031985682445289601
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse447:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 445
+    jge .Lelse448
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1024819115206086201
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse448:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8142011177361457265
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if448:
+.Lend_if447:
+.Lelse446:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 447
+    jge .Lelse449
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8086243977516515777
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse449:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 448
+    jge .Lelse450
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2007808878771107659
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse450:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3988485205126389539
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if450:
+.Lend_if449:
+.Lend_if446:
+.Lend_if441:
+.Lelse440:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 455
+    jge .Lelse451
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 452
+    jge .Lelse452
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 450
+    jge .Lelse453
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1980858424022502187
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse453:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 451
+    jge .Lelse454
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7870610804782742023
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse454:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7818487554419942407
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if454:
+.Lend_if453:
+.Lelse452:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 453
+    jge .Lelse455
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 485440633518672411
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse455:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 454
+    jge .Lelse456
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3858142551364089227
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse456:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7666179355307865607
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if456:
+.Lend_if455:
+.Lend_if452:
+.Lelse451:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 458
+    jge .Lelse457
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 456
+    jge .Lelse458
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7616720133660718087
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse458:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 457
+    jge .Lelse459
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7567895004598790407
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse459:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3759845925851628355
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if459:
+.Lend_if458:
+.Lelse457:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 459
+    jge .Lelse460
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7472098865300071541
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse460:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 460
+    jge .Lelse461
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7425104532813907569
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse461:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7378697629483820647
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if461:
+.Lend_if460:
+.Lend_if457:
+.Lend_if451:
+.Lend_if440:
+.Lend_if417:
+.Lend_if371:
+.Lelse370:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 507
+    jge .Lelse462
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 484
+    jge .Lelse463
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 472
+    jge .Lelse464
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 466
+    jge .Lelse465
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 463
+    jge .Lelse466
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 462
+    jge .Lelse467
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -3781009654859721759
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse467:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7287602597021057429
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if467:
+.Lelse466:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 464
+    jge .Lelse468
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7242893378634425175
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse468:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 465
+    jge .Lelse469
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7198729394618361607
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse469:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4136542610468202483
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if469:
+.Lend_if468:
+.Lend_if466:
+.Lelse465:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 469
+    jge .Lelse470
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 467
+    jge .Lelse471
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3555998857582564167
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse471:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 468
+    jge .Lelse472
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7069410902499468883
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse472:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4392081922311798003
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if472:
+.Lend_if471:
+.Lelse470:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 470
+    jge .Lelse473
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1746437308753567017
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse473:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 471
+    jge .Lelse474
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6944656592455360609
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse474:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 107875696337482758
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if474:
+.Lend_if473:
+.Lend_if470:
+.Lend_if465:
+.Lelse464:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 478
+    jge .Lelse475
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 475
+    jge .Lelse476
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 473
+    jge .Lelse477
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 214497024112901763
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse477:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 474
+    jge .Lelse478
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3412114510743963305
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse478:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -4876725444773789507
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if478:
+.Lend_if477:
+.Lelse476:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 476
+    jge .Lelse479
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3373118916335460867
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse479:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 477
+    jge .Lelse480
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3353953467947191203
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse480:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5106725760518463441
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if480:
+.Lend_if479:
+.Lend_if476:
+.Lelse475:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 481
+    jge .Lelse481
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 479
+    jge .Lelse482
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5181669683626278543
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse482:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 480
+    jge .Lelse483
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6595483914622409517
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse483:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3279421168659475843
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if483:
+.Lend_if482:
+.Lelse481:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 482
+    jge .Lelse484
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 407662852457669649
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse484:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 483
+    jge .Lelse485
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3243383573399481603
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse485:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3225660165894566403
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if485:
+.Lend_if484:
+.Lend_if481:
+.Lend_if475:
+.Lend_if464:
+.Lelse463:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 495
+    jge .Lelse486
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 489
+    jge .Lelse487
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 486
+    jge .Lelse488
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 485
+    jge .Lelse489
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -5614226457215950491
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse489:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3190788164101111631
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if489:
+.Lelse488:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 487
+    jge .Lelse490
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3173633389025299203
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse490:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 488
+    jge .Lelse491
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6313324174959418735
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse491:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6279742663390485657
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if491:
+.Lend_if490:
+.Lend_if488:
+.Lelse487:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 492
+    jge .Lelse492
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 490
+    jge .Lelse493
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6246516511732334939
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse493:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 491
+    jge .Lelse494
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6019463855631537895
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse494:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6181107961871263369
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if494:
+.Lend_if493:
+.Lelse492:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 493
+    jge .Lelse495
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3074457345618258603
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse495:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 494
+    jge .Lelse496
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1529263757405973191
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse496:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6275696437447579415
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if496:
+.Lend_if495:
+.Lend_if492:
+.Lend_if487:
+.Lelse486:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 501
+    jge .Lelse497
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 498
+    jge .Lelse498
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 496
+    jge .Lelse499
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6338112066351486965
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse499:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 497
+    jge .Lelse500
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 6023426636313322977
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse500:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1498212716646461045
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if500:
+.Lend_if499:
+.Lelse498:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 499
+    jge .Lelse501
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6521576187675094005
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse501:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 500
+    jge .Lelse502
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5932621209635232681
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse502:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6640827866535438581
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if502:
+.Lend_if501:
+.Lend_if498:
+.Lelse497:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 504
+    jge .Lelse503
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 502
+    jge .Lelse504
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6699563768063667999
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse504:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 503
+    jge .Lelse505
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6757718126012409997
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse505:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5815722269543898047
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if505:
+.Lend_if504:
+.Lelse503:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 505
+    jge .Lelse506
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6872316419617283935
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse506:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 506
+    jge .Lelse507
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5758983515694689285
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse507:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -6984689503637597213
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if507:
+.Lend_if506:
+.Lend_if503:
+.Lend_if497:
+.Lend_if486:
+.Lend_if463:
+.Lelse462:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 530
+    jge .Lelse508
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 518
+    jge .Lelse509
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 512
+    jge .Lelse510
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 509
+    jge .Lelse511
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 508
+    jge .Lelse512
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7040061747937461727
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse512:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5675921253449092805
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if512:
+.Lelse511:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 510
+    jge .Lelse513
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5648763735490006237
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse513:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 511
+    jge .Lelse514
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5621864860559101445
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse514:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5595220951267352149
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if514:
+.Lend_if513:
+.Lend_if511:
+.Lelse510:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 515
+    jge .Lelse515
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 513
+    jge .Lelse516
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5568828399610430677
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse516:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 514
+    jge .Lelse517
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7361376743029633273
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse517:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1379195818595106663
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if517:
+.Lend_if516:
+.Lelse515:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 516
+    jge .Lelse518
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7464496439128981351
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse518:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 517
+    jge .Lelse519
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 341606371735362067
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse519:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5440514381186227205
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if519:
+.Lend_if518:
+.Lend_if515:
+.Lend_if510:
+.Lelse509:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 524
+    jge .Lelse520
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 521
+    jge .Lelse521
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 519
+    jge .Lelse522
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7615628287311282777
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse522:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 520
+    jge .Lelse523
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7665085437020863913
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse523:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5366325548715505925
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if523:
+.Lend_if522:
+.Lelse521:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 522
+    jge .Lelse524
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5342043532657969699
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse524:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 523
+    jge .Lelse525
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7810783526705846179
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse525:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -7858478417051154275
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if525:
+.Lend_if524:
+.Lend_if521:
+.Lelse520:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 527
+    jge .Lelse526
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 525
+    jge .Lelse527
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5270498306774157605
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse527:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 526
+    jge .Lelse528
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5247073869855161349
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse528:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5223856728838103113
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if528:
+.Lend_if527:
+.Lelse526:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 528
+    jge .Lelse529
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8045055785450421189
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse529:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 529
+    jge .Lelse530
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 161813544506224137
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse530:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8135900224649190887
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if530:
+.Lend_if529:
+.Lend_if526:
+.Lend_if520:
+.Lend_if509:
+.Lelse508:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 542
+    jge .Lelse531
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 536
+    jge .Lelse532
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 533
+    jge .Lelse533
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 531
+    jge .Lelse534
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2566503523298720225
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse534:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 532
+    jge .Lelse535
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8225171599965730807
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse535:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 5088756985850910791
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if535:
+.Lend_if534:
+.Lelse533:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 534
+    jge .Lelse536
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2533458413556676617
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse536:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 535
+    jge .Lelse537
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8356217400911164407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse537:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8399155812284774565
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if537:
+.Lend_if536:
+.Lend_if533:
+.Lelse532:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 539
+    jge .Lelse538
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 537
+    jge .Lelse539
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8441730338816235485
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse539:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 538
+    jge .Lelse540
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8483945586642789561
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse540:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8525806084487607889
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if540:
+.Lend_if539:
+.Lelse538:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 540
+    jge .Lelse541
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8567316285279331503
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse541:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 541
+    jge .Lelse542
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8608480567731124087
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse542:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1224680104478642431
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if542:
+.Lend_if541:
+.Lend_if538:
+.Lend_if532:
+.Lelse531:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 548
+    jge .Lelse543
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 545
+    jge .Lelse544
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 543
+    jge .Lelse545
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4878477771559550841
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse545:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 544
+    jge .Lelse546
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8729940611014808377
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse546:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8769763576025852407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if546:
+.Lend_if545:
+.Lelse544:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 546
+    jge .Lelse547
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8809261455608234853
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse547:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 547
+    jge .Lelse548
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8848438214218402807
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse548:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8887297752111079523
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if548:
+.Lend_if547:
+.Lend_if544:
+.Lelse543:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 551
+    jge .Lelse549
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 549
+    jge .Lelse550
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8925843906633654007
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse550:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 550
+    jge .Lelse551
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1185332952527521389
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse551:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2361183241434822607
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if551:
+.Lend_if550:
+.Lelse549:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 552
+    jge .Lelse552
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2351776136887273513
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse552:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 553
+    jge .Lelse553
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9076969306111049207
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse553:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1166592510590327375
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if553:
+.Lend_if552:
+.Lend_if549:
+.Lend_if543:
+.Lend_if531:
+.Lend_if508:
+.Lend_if462:
+.Lend_if370:
+.Lelse369:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 646
+    jge .Lelse554
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 600
+    jge .Lelse555
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 577
+    jge .Lelse556
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 565
+    jge .Lelse557
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 559
+    jge .Lelse558
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 556
+    jge .Lelse559
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 555
+    jge .Lelse560
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4647998506761461825
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse560:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9187201950435737471
+    imul rdi
+    add rdx, rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if560:
+.Lelse559:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 557
+    jge .Lelse561
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 56
+    add rax, rdx
+    sar rax, 8
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse561:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 558
+    jge .Lelse562
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9187483429707480961
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse562:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 71499008037633921
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if562:
+.Lend_if561:
+.Lend_if559:
+.Lelse558:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 562
+    jge .Lelse563
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 560
+    jge .Lelse564
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9116537611717461803
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse564:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 561
+    jge .Lelse565
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1135184250689818561
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse565:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9046679085957174739
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if565:
+.Lend_if564:
+.Lelse563:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 563
+    jge .Lelse566
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 281629680514649643
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse566:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 564
+    jge .Lelse567
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8977883047280694323
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse567:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1117984489315730401
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if567:
+.Lend_if566:
+.Lend_if563:
+.Lend_if558:
+.Lelse557:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 571
+    jge .Lelse568
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 568
+    jge .Lelse569
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 566
+    jge .Lelse570
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8910125439376689083
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse570:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 567
+    jge .Lelse571
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8876628727198581229
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse571:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8843382926722182049
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if571:
+.Lend_if570:
+.Lelse569:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 569
+    jge .Lelse572
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8810385229234412713
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse572:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 570
+    jge .Lelse573
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2194408216946861159
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse573:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8745123116425268915
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if573:
+.Lend_if572:
+.Lend_if569:
+.Lelse568:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 574
+    jge .Lelse574
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 572
+    jge .Lelse575
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4356426644713694847
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse575:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 573
+    jge .Lelse576
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8680820740569200761
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse576:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1081127857799827201
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if576:
+.Lend_if575:
+.Lelse574:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 575
+    jge .Lelse577
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -1211829902652452295
+    imul rdi
+    add rdx, rdi
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse577:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 576
+    jge .Lelse578
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1073265109743101185
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse578:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8555011744329067417
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if578:
+.Lend_if577:
+.Lend_if574:
+.Lend_if568:
+.Lend_if557:
+.Lelse556:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 588
+    jge .Lelse579
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 582
+    jge .Lelse580
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 579
+    jge .Lelse581
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 578
+    jge .Lelse582
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8524127225396471505
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse582:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4246732448623781667
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if582:
+.Lelse581:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 580
+    jge .Lelse583
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1057877796341766401
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse583:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 581
+    jge .Lelse584
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1054099661354831521
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse584:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -1641169401575582883
+    imul rdi
+    add rdx, rdi
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if584:
+.Lend_if583:
+.Lend_if581:
+.Lelse580:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 585
+    jge .Lelse585
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 583
+    jge .Lelse586
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2093247554463495219
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse586:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 584
+    jge .Lelse587
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8343403679981705325
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse587:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8314025498009938757
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if587:
+.Lend_if586:
+.Lelse585:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 586
+    jge .Lelse588
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4142426739359337907
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse588:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 587
+    jge .Lelse589
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1031985682445289601
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse589:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1028389913516908801
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if589:
+.Lend_if588:
+.Lend_if585:
+.Lend_if580:
+.Lelse579:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 594
+    jge .Lelse590
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 591
+    jge .Lelse591
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 589
+    jge .Lelse592
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1024819115206086201
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse592:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 590
+    jge .Lelse593
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1021273028302258913
+    imul rdi
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse593:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8142011177361457265
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if593:
+.Lend_if592:
+.Lelse591:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 592
+    jge .Lelse594
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8114031757507981467
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse594:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 593
+    jge .Lelse595
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8086243977516515777
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse595:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 503665367200260795
+    imul rdi
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if595:
+.Lend_if594:
+.Lend_if591:
+.Lelse590:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 597
+    jge .Lelse596
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 595
+    jge .Lelse597
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 2007808878771107659
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse597:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 596
+    jge .Lelse598
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8004010987914652905
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse598:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 3988485205126389539
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if598:
+.Lend_if597:
+.Lelse596:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 598
+    jge .Lelse599
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7950111924022971741
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse599:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 599
+    jge .Lelse600
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1980858424022502187
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse600:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7896933917842216077
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if600:
+.Lend_if599:
+.Lend_if596:
+.Lend_if590:
+.Lend_if579:
+.Lend_if556:
+.Lelse555:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 623
+    jge .Lelse601
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 611
+    jge .Lelse602
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 605
+    jge .Lelse603
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 602
+    jge .Lelse604
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 601
+    jge .Lelse605
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7870610804782742023
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse605:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4620710844295151873
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if605:
+.Lelse604:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 603
+    jge .Lelse606
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 55
+    add rax, rdx
+    sar rax, 9
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse606:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 604
+    jge .Lelse607
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 35958565445827586
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse607:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4620710844295151873
+    imul rdi
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if607:
+.Lend_if606:
+.Lend_if604:
+.Lelse603:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 608
+    jge .Lelse608
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 606
+    jge .Lelse609
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 55
+    add rax, rdx
+    sar rax, 9
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse609:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 607
+    jge .Lelse610
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 35958565445827586
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse610:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9214356032908681207
+    imul rdi
+    add rdx, rdi
+    sar rdx, 9
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if610:
+.Lend_if609:
+.Lelse608:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 609
+    jge .Lelse611
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 54
+    add rax, rdx
+    sar rax, 10
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse611:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 610
+    jge .Lelse612
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1151796703138937857
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse612:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9214356032908681207
+    imul rdi
+    add rdx, rdi
+    sar rdx, 9
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if612:
+.Lend_if611:
+.Lend_if608:
+.Lend_if603:
+.Lelse602:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 617
+    jge .Lelse613
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 614
+    jge .Lelse614
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 612
+    jge .Lelse615
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 54
+    add rax, rdx
+    sar rax, 10
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse615:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 613
+    jge .Lelse616
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1151796703138937857
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse616:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9218866237129883391
+    imul rdi
+    add rdx, rdi
+    sar rdx, 10
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if616:
+.Lend_if615:
+.Lelse614:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 615
+    jge .Lelse617
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 53
+    add rax, rdx
+    sar rax, 11
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse617:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 616
+    jge .Lelse618
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9218870635177443073
+    imul rdi
+    sar rdx, 10
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse618:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9218866237129883391
+    imul rdi
+    add rdx, rdi
+    sar rdx, 10
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if618:
+.Lend_if617:
+.Lend_if614:
+.Lelse613:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 620
+    jge .Lelse619
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 618
+    jge .Lelse620
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 53
+    add rax, rdx
+    sar rax, 11
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse620:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 619
+    jge .Lelse621
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9218870635177443073
+    imul rdi
+    sar rdx, 10
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse621:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9221119687151026167
+    imul rdi
+    add rdx, rdi
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if621:
+.Lend_if620:
+.Lelse619:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 621
+    jge .Lelse622
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 52
+    add rax, rdx
+    sar rax, 12
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse622:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 622
+    jge .Lelse623
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9221120786662719481
+    imul rdi
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse623:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9221119687151026167
+    imul rdi
+    add rdx, rdi
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if623:
+.Lend_if622:
+.Lend_if619:
+.Lend_if613:
+.Lend_if602:
+.Lelse601:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 634
+    jge .Lelse624
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 628
+    jge .Lelse625
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 625
+    jge .Lelse626
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 624
+    jge .Lelse627
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 52
+    add rax, rdx
+    sar rax, 12
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse627:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9221120786662719481
+    imul rdi
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if627:
+.Lelse626:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 626
+    jge .Lelse628
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9222245999492200447
+    imul rdi
+    add rdx, rdi
+    sar rdx, 12
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse628:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 627
+    jge .Lelse629
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 51
+    add rax, rdx
+    sar rax, 13
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse629:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4503049938657281
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if629:
+.Lend_if628:
+.Lend_if626:
+.Lelse625:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 631
+    jge .Lelse630
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 629
+    jge .Lelse631
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9222245999492200447
+    imul rdi
+    add rdx, rdi
+    sar rdx, 12
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse631:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 630
+    jge .Lelse632
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 51
+    add rax, rdx
+    sar rax, 13
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse632:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4503049938657281
+    imul rdi
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if632:
+.Lend_if631:
+.Lelse630:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 632
+    jge .Lelse633
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9222809052539518847
+    imul rdi
+    add rdx, rdi
+    sar rdx, 13
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse633:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 633
+    jge .Lelse634
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 50
+    add rax, rdx
+    sar rax, 14
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse634:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 72053196259835905
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if634:
+.Lend_if633:
+.Lend_if630:
+.Lend_if625:
+.Lelse624:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 640
+    jge .Lelse635
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 637
+    jge .Lelse636
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 635
+    jge .Lelse637
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9222809052539518847
+    imul rdi
+    add rdx, rdi
+    sar rdx, 13
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse637:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 636
+    jge .Lelse638
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 50
+    add rax, rdx
+    sar rax, 14
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse638:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 72053196259835905
+    imul rdi
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if638:
+.Lend_if637:
+.Lelse636:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 638
+    jge .Lelse639
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223090553287868407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 14
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse639:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 639
+    jge .Lelse640
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 49
+    add rax, rdx
+    sar rax, 15
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse640:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1152886321308467201
+    imul rdi
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if640:
+.Lend_if639:
+.Lend_if636:
+.Lelse635:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 643
+    jge .Lelse641
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 641
+    jge .Lelse642
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223090553287868407
+    imul rdi
+    add rdx, rdi
+    sar rdx, 14
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse642:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 642
+    jge .Lelse643
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 49
+    add rax, rdx
+    sar rax, 15
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse643:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1152886321308467201
+    imul rdi
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if643:
+.Lend_if642:
+.Lelse641:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 644
+    jge .Lelse644
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223231297218904063
+    imul rdi
+    add rdx, rdi
+    sar rdx, 15
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse644:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 645
+    jge .Lelse645
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 48
+    add rax, rdx
+    sar rax, 16
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse645:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9223231301513871361
+    imul rdi
+    sar rdx, 15
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if645:
+.Lend_if644:
+.Lend_if641:
+.Lend_if635:
+.Lend_if624:
+.Lend_if601:
+.Lend_if555:
+.Lelse554:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 692
+    jge .Lelse646
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 669
+    jge .Lelse647
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 657
+    jge .Lelse648
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 651
+    jge .Lelse649
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 648
+    jge .Lelse650
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 647
+    jge .Lelse651
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223231297218904063
+    imul rdi
+    add rdx, rdi
+    sar rdx, 15
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse651:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 48
+    add rax, rdx
+    sar rax, 16
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if651:
+.Lelse650:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 649
+    jge .Lelse652
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9223231301513871361
+    imul rdi
+    sar rdx, 15
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse652:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 650
+    jge .Lelse653
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223301667573723135
+    imul rdi
+    add rdx, rdi
+    sar rdx, 16
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse653:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 47
+    add rax, rdx
+    sar rax, 17
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if653:
+.Lend_if652:
+.Lend_if650:
+.Lelse649:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 654
+    jge .Lelse654
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 652
+    jge .Lelse655
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9223301668647464961
+    imul rdi
+    sar rdx, 16
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse655:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 653
+    jge .Lelse656
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223301667573723135
+    imul rdi
+    add rdx, rdi
+    sar rdx, 16
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse656:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 47
+    add rax, rdx
+    sar rax, 17
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if656:
+.Lend_if655:
+.Lelse654:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 655
+    jge .Lelse657
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9223301668647464961
+    imul rdi
+    sar rdx, 16
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse657:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 656
+    jge .Lelse658
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223336852348468735
+    imul rdi
+    add rdx, rdi
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse658:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 46
+    add rax, rdx
+    sar rax, 18
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if658:
+.Lend_if657:
+.Lend_if654:
+.Lend_if649:
+.Lelse648:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 663
+    jge .Lelse659
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 660
+    jge .Lelse660
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 658
+    jge .Lelse661
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9223336852616904193
+    imul rdi
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse661:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 659
+    jge .Lelse662
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223336852348468735
+    imul rdi
+    add rdx, rdi
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse662:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 46
+    add rax, rdx
+    sar rax, 18
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if662:
+.Lend_if661:
+.Lelse660:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 661
+    jge .Lelse663
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9223336852616904193
+    imul rdi
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse663:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 662
+    jge .Lelse664
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223354444635176895
+    imul rdi
+    add rdx, rdi
+    sar rdx, 18
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse664:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 45
+    add rax, rdx
+    sar rax, 19
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if664:
+.Lend_if663:
+.Lend_if660:
+.Lelse659:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 666
+    jge .Lelse665
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 664
+    jge .Lelse666
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9223354444702285761
+    imul rdi
+    sar rdx, 18
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse666:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 665
+    jge .Lelse667
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223354444635176895
+    imul rdi
+    add rdx, rdi
+    sar rdx, 18
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse667:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 45
+    add rax, rdx
+    sar rax, 19
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if667:
+.Lend_if666:
+.Lelse665:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 667
+    jge .Lelse668
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9223354444702285761
+    imul rdi
+    sar rdx, 18
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse668:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 668
+    jge .Lelse669
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223363240753364983
+    imul rdi
+    add rdx, rdi
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse669:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 44
+    add rax, rdx
+    sar rax, 20
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if669:
+.Lend_if668:
+.Lend_if665:
+.Lend_if659:
+.Lend_if648:
+.Lelse647:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 680
+    jge .Lelse670
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 674
+    jge .Lelse671
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 671
+    jge .Lelse672
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 670
+    jge .Lelse673
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9223363240770142201
+    imul rdi
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse673:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223363240753364983
+    imul rdi
+    add rdx, rdi
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if673:
+.Lelse672:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 672
+    jge .Lelse674
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 44
+    add rax, rdx
+    sar rax, 20
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse674:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 673
+    jge .Lelse675
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 9223363240770142201
+    imul rdi
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse675:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4611688217451692033
+    imul rdi
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if675:
+.Lend_if674:
+.Lend_if672:
+.Lelse671:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 677
+    jge .Lelse676
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 675
+    jge .Lelse677
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 43
+    add rax, rdx
+    sar rax, 21
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse677:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 676
+    jge .Lelse678
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8796088827906
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse678:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4611688217451692033
+    imul rdi
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if678:
+.Lend_if677:
+.Lelse676:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 678
+    jge .Lelse679
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 43
+    add rax, rdx
+    sar rax, 21
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse679:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 679
+    jge .Lelse680
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 8796088827906
+    imul rdi
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse680:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223369837830995967
+    imul rdi
+    add rdx, rdi
+    sar rdx, 21
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if680:
+.Lend_if679:
+.Lend_if676:
+.Lend_if671:
+.Lelse670:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 686
+    jge .Lelse681
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 683
+    jge .Lelse682
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 681
+    jge .Lelse683
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 42
+    add rax, rdx
+    sar rax, 22
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse683:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 682
+    jge .Lelse684
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 17592181850113
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse684:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223369837830995967
+    imul rdi
+    add rdx, rdi
+    sar rdx, 21
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if684:
+.Lend_if683:
+.Lelse682:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 684
+    jge .Lelse685
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 42
+    add rax, rdx
+    sar rax, 22
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse685:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 685
+    jge .Lelse686
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 17592181850113
+    imul rdi
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse686:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223370937343016959
+    imul rdi
+    add rdx, rdi
+    sar rdx, 22
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if686:
+.Lend_if685:
+.Lend_if682:
+.Lelse681:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 689
+    jge .Lelse687
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 687
+    jge .Lelse688
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 41
+    add rax, rdx
+    sar rax, 23
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse688:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 688
+    jge .Lelse689
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 70368735789057
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse689:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223370937343016959
+    imul rdi
+    add rdx, rdi
+    sar rdx, 22
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if689:
+.Lend_if688:
+.Lelse687:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 690
+    jge .Lelse690
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 41
+    add rax, rdx
+    sar rax, 23
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse690:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 691
+    jge .Lelse691
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 70368735789057
+    imul rdi
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse691:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223371487098929151
+    imul rdi
+    add rdx, rdi
+    sar rdx, 23
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if691:
+.Lend_if690:
+.Lend_if687:
+.Lend_if681:
+.Lend_if670:
+.Lend_if647:
+.Lelse646:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 715
+    jge .Lelse692
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 703
+    jge .Lelse693
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 697
+    jge .Lelse694
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 694
+    jge .Lelse695
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 693
+    jge .Lelse696
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 40
+    add rax, rdx
+    sar rax, 24
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse696:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 281474959933441
+    imul rdi
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if696:
+.Lelse695:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 695
+    jge .Lelse697
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223371487098929151
+    imul rdi
+    add rdx, rdi
+    sar rdx, 23
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse697:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 696
+    jge .Lelse698
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 40
+    add rax, rdx
+    sar rax, 24
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse698:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 281474959933441
+    imul rdi
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if698:
+.Lend_if697:
+.Lend_if695:
+.Lelse694:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 700
+    jge .Lelse699
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 698
+    jge .Lelse700
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223371761976860671
+    imul rdi
+    add rdx, rdi
+    sar rdx, 24
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse700:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 699
+    jge .Lelse701
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 39
+    add rax, rdx
+    sar rax, 25
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse701:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1125899873288193
+    imul rdi
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if701:
+.Lend_if700:
+.Lelse699:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 701
+    jge .Lelse702
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223371761976860671
+    imul rdi
+    add rdx, rdi
+    sar rdx, 24
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse702:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 702
+    jge .Lelse703
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 39
+    add rax, rdx
+    sar rax, 25
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse703:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1125899873288193
+    imul rdi
+    sar rdx, 11
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if703:
+.Lend_if702:
+.Lend_if699:
+.Lend_if694:
+.Lelse693:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 709
+    jge .Lelse704
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 706
+    jge .Lelse705
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 704
+    jge .Lelse706
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223371899415820287
+    imul rdi
+    add rdx, rdi
+    sar rdx, 25
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse706:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 705
+    jge .Lelse707
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 38
+    add rax, rdx
+    sar rax, 26
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse707:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4503599560261633
+    imul rdi
+    sar rdx, 14
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if707:
+.Lend_if706:
+.Lelse705:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 707
+    jge .Lelse708
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223371899415820287
+    imul rdi
+    add rdx, rdi
+    sar rdx, 25
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse708:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 708
+    jge .Lelse709
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 38
+    add rax, rdx
+    sar rax, 26
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse709:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 4503599560261633
+    imul rdi
+    sar rdx, 14
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if709:
+.Lend_if708:
+.Lend_if705:
+.Lelse704:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 712
+    jge .Lelse710
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 710
+    jge .Lelse711
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223371968135298559
+    imul rdi
+    add rdx, rdi
+    sar rdx, 26
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse711:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 711
+    jge .Lelse712
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 37
+    add rax, rdx
+    sar rax, 27
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse712:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 18014398375264257
+    imul rdi
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if712:
+.Lend_if711:
+.Lelse710:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 713
+    jge .Lelse713
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223371968135298559
+    imul rdi
+    add rdx, rdi
+    sar rdx, 26
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse713:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 714
+    jge .Lelse714
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 37
+    add rax, rdx
+    sar rax, 27
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse714:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 18014398375264257
+    imul rdi
+    sar rdx, 17
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if714:
+.Lend_if713:
+.Lend_if710:
+.Lend_if704:
+.Lend_if693:
+.Lelse692:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 727
+    jge .Lelse715
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 721
+    jge .Lelse716
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 718
+    jge .Lelse717
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 716
+    jge .Lelse718
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223372002495037311
+    imul rdi
+    add rdx, rdi
+    sar rdx, 27
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse718:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 717
+    jge .Lelse719
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 36
+    add rax, rdx
+    sar rax, 28
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse719:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 72057593769492481
+    imul rdi
+    sar rdx, 20
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if719:
+.Lend_if718:
+.Lelse717:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 719
+    jge .Lelse720
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223372002495037311
+    imul rdi
+    add rdx, rdi
+    sar rdx, 27
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse720:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 720
+    jge .Lelse721
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 36
+    add rax, rdx
+    sar rax, 28
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse721:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 72057593769492481
+    imul rdi
+    sar rdx, 20
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if721:
+.Lend_if720:
+.Lend_if717:
+.Lelse716:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 724
+    jge .Lelse722
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 722
+    jge .Lelse723
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223372019674906591
+    imul rdi
+    add rdx, rdi
+    sar rdx, 28
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse723:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 723
+    jge .Lelse724
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 35
+    add rax, rdx
+    sar rax, 29
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse724:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 288230375614840833
+    imul rdi
+    sar rdx, 23
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if724:
+.Lend_if723:
+.Lelse722:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 725
+    jge .Lelse725
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223372019674906591
+    imul rdi
+    add rdx, rdi
+    sar rdx, 28
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse725:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 726
+    jge .Lelse726
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 35
+    add rax, rdx
+    sar rax, 29
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse726:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 288230375614840833
+    imul rdi
+    sar rdx, 23
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if726:
+.Lend_if725:
+.Lend_if722:
+.Lend_if716:
+.Lelse715:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 733
+    jge .Lelse727
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 730
+    jge .Lelse728
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 728
+    jge .Lelse729
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223372028264841207
+    imul rdi
+    add rdx, rdi
+    sar rdx, 29
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse729:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 729
+    jge .Lelse730
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 34
+    add rax, rdx
+    sar rax, 30
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse730:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1152921503533105153
+    imul rdi
+    sar rdx, 26
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if730:
+.Lend_if729:
+.Lelse728:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 731
+    jge .Lelse731
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223372028264841207
+    imul rdi
+    add rdx, rdi
+    sar rdx, 29
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse731:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 732
+    jge .Lelse732
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 34
+    add rax, rdx
+    sar rax, 30
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse732:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 1152921503533105153
+    imul rdi
+    sar rdx, 26
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if732:
+.Lend_if731:
+.Lend_if728:
+.Lelse727:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 736
+    jge .Lelse733
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 734
+    jge .Lelse734
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, 7367186400732675841
+    imul rdi
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse734:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 735
+    jge .Lelse735
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8775366530925146571
+    imul rdi
+    add rdx, rdi
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse735:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -8775366530925146571
+    imul rdi
+    add rdx, rdi
+    sar rdx, 19
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if735:
+.Lend_if734:
+.Lelse733:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 737
+    jge .Lelse736
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223372032559808509
+    imul rdi
+    add rdx, rdi
+    sar rdx, 30
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse736:
+  # if else
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-16]
+  # dereference rax
+    cmp rax, 738
+    jge .Lelse737
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    mov rax, -9223372032559808509
+    imul rdi
+    add rdx, rdi
+    sar rdx, 30
+    mov rax, rdx
+    shr rax, 63
+    add rax, rdx
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lelse737:
+  # local variable (push address + dereference rax)
+  # push address
+    mov rax, qword ptr [rbp-8]
+  # dereference rax
+    mov rdi, rax
+  # /
+    cqo
+    shr rdx, 33
+    add rax, rdx
+    sar rax, 31
+    neg rax
+  # return (embedded epilogue)
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lend_if737:
+.Lend_if736:
+.Lend_if733:
+.Lend_if727:
+.Lend_if715:
+.Lend_if692:
+.Lend_if646:
+.Lend_if554:
+.Lend_if369:
+.Lend_if0:
+
+  # epilogue
+    mov rsp, rbp
+    pop rbp
+    ret
@@ -0,0 +1,85 @@
+#include <limits.h>
+#include <stdio.h>
+
+long mul_stack(void);
+long mul_ir(void);
+long div_stack(void);
+long div_ir(void);
+
+static const long NUMS[] = {-300L, -299L, -298L, -297L, -296L, -295L, -294L, -293L, -292L, -291L, -290L, -289L, -288L, -287L, -286L, -285L, -284L, -283L, -282L, -281L, -280L, -279L, -278L, -277L, -276L, -275L, -274L, -273L, -272L, -271L, -270L, -269L, -268L, -267L, -266L, -265L, -264L, -263L, -262L, -261L, -260L, -259L, -258L, -257L, -256L, -255L, -254L, -253L, -252L, -251L, -250L, -249L, -248L, -247L, -246L, -245L, -244L, -243L, -242L, -241L, -240L, -239L, -238L, -237L, -236L, -235L, -234L, -233L, -232L, -231L, -230L, -229L, -228L, -227L, -226L, -225L, -224L, -223L, -222L, -221L, -220L, -219L, -218L, -217L, -216L, -215L, -214L, -213L, -212L, -211L, -210L, -209L, -208L, -207L, -206L, -205L, -204L, -203L, -202L, -201L, -200L, -199L, -198L, -197L, -196L, -195L, -194L, -193L, -192L, -191L, -190L, -189L, -188L, -187L, -186L, -185L, -184L, -183L, -182L, -181L, -180L, -179L, -178L, -177L, -176L, -175L, -174L, -173L, -172L, -171L, -170L, -169L, -168L, -167L, -166L, -165L, -164L, -163L, -162L, -161L, -160L, -159L, -158L, -157L, -156L, -155L, -154L, -153L, -152L, -151L, -150L, -149L, -148L, -147L, -146L, -145L, -144L, -143L, -142L, -141L, -140L, -139L, -138L, -137L, -136L, -135L, -134L, -133L, -132L, -131L, -130L, -129L, -128L, -127L, -126L, -125L, -124L, -123L, -122L, -121L, -120L, -119L, -118L, -117L, -116L, -115L, -114L, -113L, -112L, -111L, -110L, -109L, -108L, -107L, -106L, -105L, -104L, -103L, -102L, -101L, -100L, -99L, -98L, -97L, -96L, -95L, -94L, -93L, -92L, -91L, -90L, -89L, -88L, -87L, -86L, -85L, -84L, -83L, -82L, -81L, -80L, -79L, -78L, -77L, -76L, -75L, -74L, -73L, -72L, -71L, -70L, -69L, -68L, -67L, -66L, -65L, -64L, -63L, -62L, -61L, -60L, -59L, -58L, -57L, -56L, -55L, -54L, -53L, -52L, -51L, -50L, -49L, -48L, -47L, -46L, -45L, -44L, -43L, -42L, -41L, -40L, -39L, -38L, -37L, -36L, -35L, -34L, -33L, -32L, -31L, -30L, -29L, -28L, -27L, -26L, -25L, -24L, -23L, -22L, -21L, -20L, -19L, -18L, -17L, -16L, -15L, -14L, -13L, -12L, -11L, -10L, -9L, -8L, -7L, -6L, -5L, -4L, -3L, -2L, -1L, 0L, 1L, 2L, 3L, 4L, 5L, 6L, 7L, 8L, 9L, 10L, 11L, 12L, 13L, 14L, 15L, 16L, 17L, 18L, 19L, 20L, 21L, 22L, 23L, 24L, 25L, 26L, 27L, 28L, 29L, 30L, 31L, 32L, 33L, 34L, 35L, 36L, 37L, 38L, 39L, 40L, 41L, 42L, 43L, 44L, 45L, 46L, 47L, 48L, 49L, 50L, 51L, 52L, 53L, 54L, 55L, 56L, 57L, 58L, 59L, 60L, 61L, 62L, 63L, 64L, 65L, 66L, 67L, 68L, 69L, 70L, 71L, 72L, 73L, 74L, 75L, 76L, 77L, 78L, 79L, 80L, 81L, 82L, 83L, 84L, 85L, 86L, 87L, 88L, 89L, 90L, 91L, 92L, 93L, 94L, 95L, 96L, 97L, 98L, 99L, 100L, 101L, 102L, 103L, 104L, 105L, 106L, 107L, 108L, 109L, 110L, 111L, 112L, 113L, 114L, 115L, 116L, 117L, 118L, 119L, 120L, 121L, 122L, 123L, 124L, 125L, 126L, 127L, 128L, 129L, 130L, 131L, 132L, 133L, 134L, 135L, 136L, 137L, 138L, 139L, 140L, 141L, 142L, 143L, 144L, 145L, 146L, 147L, 148L, 149L, 150L, 151L, 152L, 153L, 154L, 155L, 156L, 157L, 158L, 159L, 160L, 161L, 162L, 163L, 164L, 165L, 166L, 167L, 168L, 169L, 170L, 171L, 172L, 173L, 174L, 175L, 176L, 177L, 178L, 179L, 180L, 181L, 182L, 183L, 184L, 185L, 186L, 187L, 188L, 189L, 190L, 191L, 192L, 193L, 194L, 195L, 196L, 197L, 198L, 199L, 200L, 201L, 202L, 203L, 204L, 205L, 206L, 207L, 208L, 209L, 210L, 211L, 212L, 213L, 214L, 215L, 216L, 217L, 218L, 219L, 220L, 221L, 222L, 223L, 224L, 225L, 226L, 227L, 228L, 229L, 230L, 231L, 232L, 233L, 234L, 235L, 236L, 237L, 238L, 239L, 240L, 241L, 242L, 243L, 244L, 245L, 246L, 247L, 248L, 249L, 250L, 251L, 252L, 253L, 254L, 255L, 256L, 257L, 258L, 259L, 260L, 261L, 262L, 263L, 264L, 265L, 266L, 267L, 268L, 269L, 270L, 271L, 272L, 273L, 274L, 275L, 276L, 277L, 278L, 279L, 280L, 281L, 282L, 283L, 284L, 285L, 286L, 287L, 288L, 289L, 290L, 291L, 292L, 293L, 294L, 295L, 296L, 297L, 298L, 299L, 300L, 511L, 512L, 513L, -511L, -512L, -513L, 1023L, 1024L, 1025L, -1023L, -1024L, -1025L, 2047L, 2048L, 2049L, -2047L, -2048L, -2049L, 4095L, 4096L, 4097L, -4095L, -4096L, -4097L, 8191L, 8192L, 8193L, -8191L, -8192L, -8193L, 16383L, 16384L, 16385L, -16383L, -16384L, -16385L, 32767L, 32768L, 32769L, -32767L, -32768L, -32769L, 65535L, 65536L, 65537L, -65535L, -65536L, -65537L, 131071L, 131072L, 131073L, -131071L, -131072L, -131073L, 262143L, 262144L, 262145L, -262143L, -262144L, -262145L, 524287L, 524288L, 524289L, -524287L, -524288L, -524289L, 1048575L, 1048576L, 1048577L, -1048575L, -1048576L, -1048577L, 2097151L, 2097152L, 2097153L, -2097151L, -2097152L, -2097153L, 4194303L, 4194304L, 4194305L, -4194303L, -4194304L, -4194305L, 8388607L, 8388608L, 8388609L, -8388607L, -8388608L, -8388609L, 16777215L, 16777216L, 16777217L, -16777215L, -16777216L, -16777217L, 33554431L, 33554432L, 33554433L, -33554431L, -33554432L, -33554433L, 67108863L, 67108864L, 67108865L, -67108863L, -67108864L, -67108865L, 134217727L, 134217728L, 134217729L, -134217727L, -134217728L, -134217729L, 268435455L, 268435456L, 268435457L, -268435455L, -268435456L, -268435457L, 536870911L, 536870912L, 536870913L, -536870911L, -536870912L, -536870913L, 1073741823L, 1073741824L, 1073741825L, -1073741823L, -1073741824L, -1073741825L, 641L, 1000003L, -1000003L, 2147483647L, -2147483647L, -2147483647L - 1, };
+static const char *BACKENDS[2] = {"stack", "ir"};
+
+static long gX;
+static long gW;
+
+long arg(void) {
+    return gX;
+}
+
+long which(void) {
+    return gW;
+}
+
+static int n_failures = 0;
+
+static void check(const char *op, int backend, long x, long n, long expected, long actual) {
+    if (expected != actual && n_failures++ < 10) {
+        printf("%ld %s %ld => %ld expected, got %ld (%s)\n", x, op, n, expected, actual,
+               BACKENDS[backend]);
+    }
+}
+
+static void check_all(long x, long n) {
+    gX = x;
+    // wraps around like the generated code, where C would overflow
+    long product = (long)((unsigned long)x * (unsigned long)n);
+    check("*", 0, x, n, product, mul_stack());
+    check("*", 1, x, n, product, mul_ir());
+
+    if (n != 0 && !(n == -1 && x == LONG_MIN)) {
+        check("/", 0, x, n, x / n, div_stack());
+        check("/", 1, x, n, x / n, div_ir());
+    }
+}
+
+int main(void) {
+    int n_nums = sizeof NUMS / sizeof NUMS[0];
+    unsigned long rand = 88172645463325252ul;
+
+    for (gW = 0; gW < n_nums; gW++) {
+        long n = NUMS[gW];
+
+        for (long x = -1000; x <= 1000; x++) {
+            check_all(x, n);
+        }
+        for (int k = 0; k < 63; k++) {
+            for (long d = -1; d <= 1; d++) {
+                check_all((1L << k) + d, n);
+                check_all(-(1L << k) + d, n);
+            }
+        }
+        check_all(LONG_MIN, n);
+        check_all(LONG_MAX, n);
+
+        // around the multiples of the divisor, where the quotient changes
+        long qs[] = {2, 3, 1000, 1L << 20, n ? LONG_MAX / (n < 0 ? -n : n) : 0};
+        for (int i = 0; i < 5; i++) {
+            long m = (long)((unsigned long)qs[i] * (unsigned long)n);
+            for (long d = -1; d <= 1; d++) {
+                check_all(m + d, n);
+                check_all(-m + d, n);
+            }
+        }
+
+        // xorshift
+        for (int i = 0; i < 1000; i++) {
+            rand ^= rand << 13;
+            rand ^= rand >> 7;
+            rand ^= rand << 17;
+            check_all((long)rand >> (i % 64), n);
+        }
+    }
+
+    printf("%d\n", n_failures);
+    return 0;
+}
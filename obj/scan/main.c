@@ -0,0 +1,82 @@
+// `mmap` and `sysconf`
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "scan.h"
+
+typedef char *(*Skip)(char *p);
+
+static Skip skip_of(Scanner scan, int class) {
+    return class == 0 ? scan.skip_ws : class == 1 ? scan.skip_ident : scan.skip_digits;
+}
+
+static const char *CLASS_NAMES[] = {"ws", "ident", "digits"};
+/// A byte in each class
+static const char MEMBERS[] = {' ', 'a', '7'};
+
+static int n_failures = 0;
+
+/// Writes a run of `len` bytes of the class at `p`, followed by `end` and the terminator (just the
+/// terminator if `end` is `\0`), and compares the implementation with the scalar one
+static void check(Scanner scan, int class, char *p, int len, char end, const char *where) {
+    memset(p, MEMBERS[class], len);
+    p[len] = end;
+    if (end != '\0') {
+        p[len + 1] = '\0';
+    }
+
+    char *expected = skip_of(scanner_get(SCAN_SCALAR), class)(p);
+    char *actual = skip_of(scan, class)(p);
+    if (actual != expected) {
+        n_failures++;
+        printf("%s %s: run of %d then 0x%02x (%s) => %ld expected, got %ld\n", scan.name,
+               CLASS_NAMES[class], len, (unsigned char)end, where, (long)(expected - p),
+               (long)(actual - p));
+    }
+}
+
+int main(void) {
+    static const int LENS[] = {0, 15, 16, 17, 31, 32, 33};
+    int n_lens = sizeof(LENS) / sizeof(LENS[0]);
+
+    // the second page is unmapped, so a read across the boundary crashes
+    long page = sysconf(_SC_PAGESIZE);
+    char *mem = mmap(NULL, page * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED || munmap(mem + page, page) != 0) {
+        printf("failed to map the pages\n");
+        return 1;
+    }
+
+    for (ScanImpl impl = SCAN_SCALAR; impl <= SCAN_AVX2; impl++) {
+        if (!scanner_supported(impl)) {
+            continue;
+        }
+        Scanner scan = scanner_get(impl);
+
+        for (int class = 0; class < 3; class++) {
+            for (int i = 0; i < n_lens; i++) {
+                int len = LENS[i];
+
+                // every alignment and every byte after the run, including the terminator
+                for (int off = 0; off < 64; off++) {
+                    for (int end = 0; end < 256; end++) {
+                        check(scan, class, mem + off, len, (char)end, "mid-page");
+                    }
+                }
+
+                // the terminator is the last byte of the page
+                check(scan, class, mem + page - len - 1, len, '\0', "page end");
+                check(scan, class, mem + page - len - 2, len, ';', "page end");
+            }
+        }
+
+        printf("%s\n", scan.name);
+    }
+
+    munmap(mem, page);
+    return n_failures != 0;
+}
@@ -0,0 +1,429 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "asm.h"
+#include "emit.h"
+#include "utils.h"
+
+/// Name padded to a fixed size, so that it's copied without a call to `memcpy`
+typedef struct {
+    char str[16];
+    uint8_t len;
+} Name;
+
+#define NAME(s) {s, sizeof(s) - 1}
+
+static const Name REG_NAMES[REG_END] = {
+    [REG_RAX] = NAME("rax"), [REG_RCX] = NAME("rcx"), [REG_RDX] = NAME("rdx"),
+    [REG_RBX] = NAME("rbx"), [REG_RSP] = NAME("rsp"), [REG_RBP] = NAME("rbp"),
+    [REG_RSI] = NAME("rsi"), [REG_RDI] = NAME("rdi"), [REG_R8] = NAME("r8"),
+    [REG_R9] = NAME("r9"),   [REG_R10] = NAME("r10"), [REG_R11] = NAME("r11"),
+    [REG_R12] = NAME("r12"), [REG_R13] = NAME("r13"), [REG_R14] = NAME("r14"),
+    [REG_R15] = NAME("r15"), [REG_AL] = NAME("al"),
+};
+
+/// With the leading indent, e.g. `    mov`
+static const Name MNEMONICS[AI_END] = {
+    [AI_MOV] = NAME("    mov"),     [AI_MOVZB] = NAME("    movzb"), [AI_PUSH] = NAME("    push"),
+    [AI_POP] = NAME("    pop"),     [AI_ADD] = NAME("    add"),     [AI_SUB] = NAME("    sub"),
+    [AI_IMUL] = NAME("    imul"),   [AI_NEG] = NAME("    neg"),     [AI_SHL] = NAME("    shl"),
+    [AI_SAR] = NAME("    sar"),     [AI_SHR] = NAME("    shr"),     [AI_LEA] = NAME("    lea"),
+    [AI_CQO] = NAME("    cqo"),     [AI_IDIV] = NAME("    idiv"),   [AI_CMP] = NAME("    cmp"),
+    [AI_SETE] = NAME("    sete"),   [AI_SETNE] = NAME("    setne"), [AI_SETL] = NAME("    setl"),
+    [AI_SETLE] = NAME("    setle"), [AI_SETG] = NAME("    setg"),   [AI_SETGE] = NAME("    setge"),
+    [AI_JE] = NAME("    je"),       [AI_JNE] = NAME("    jne"),     [AI_JL] = NAME("    jl"),
+    [AI_JLE] = NAME("    jle"),     [AI_JG] = NAME("    jg"),       [AI_JGE] = NAME("    jge"),
+    [AI_JMP] = NAME("    jmp"),     [AI_CALL] = NAME("    call"),   [AI_RET] = NAME("    ret"),
+    [AI_P2ALIGN] = NAME("    .p2align"),
+};
+
+const char *PEEP_RULE_NAMES[PEEP_END] = {
+    [PEEP_PUSH_POP_SAME] = "push_pop",
+    [PEEP_PUSH_POP_MOV] = "push_pop_mov",
+    [PEEP_PUSH_MOV_POP] = "push_mov_pop",
+    [PEEP_SELF_MOV] = "self_mov",
+    [PEEP_MOV_BACK] = "mov_back",
+    [PEEP_FRAME_LOAD] = "frame_load",
+    [PEEP_JMP_NEXT] = "jmp_next",
+};
+
+const char *reg_name(Reg reg) {
+    return REG_NAMES[reg].str;
+}
+
+bool opnd_eq(Opnd x, Opnd y) {
+    if (x.kind != y.kind) {
+        return false;
+    }
+
+    switch (x.kind) {
+    case OPND_REG:
+        return x.reg == y.reg;
+    case OPND_IMM:
+        return x.imm == y.imm;
+    case OPND_MEM:
+        return x.reg == y.reg && x.offset == y.offset;
+    case OPND_ADDR:
+        return x.reg == y.reg && x.index == y.index && x.scale == y.scale;
+    case OPND_LABEL:
+        return x.seq == y.seq && strcmp(x.prefix, y.prefix) == 0;
+    case OPND_SYM:
+        return x.len == y.len && memcmp(x.str, y.str, x.len) == 0;
+    default:
+        return true;
+    }
+}
+
+AsmBuf asm_init(Emitter *out) {
+    return (AsmBuf){.len = 0, .out = out, .peephole = true, .n_fired = {0}};
+}
+
+// --------------------------------------------------------------------------------
+// Printer
+
+/// Upper bound of the bytes of an instruction, except for symbols and comments
+#define INS_TEXT_MAX 128
+
+/// Instruction text written straight into the buffer of the `Emitter`
+typedef struct {
+    Emitter *e;
+    char *buf;
+    size_t len;
+} Line;
+
+static Line line_begin(Emitter *e) {
+    return (Line){.e = e, .buf = emit_reserve(e, INS_TEXT_MAX), .len = 0};
+}
+
+static void line_end(Line *l) {
+    emit_commit(l->e, l->len);
+}
+
+/// Appends a string literal
+#define LINE_STR(l, lit) line_put((l), lit, sizeof(lit) - 1)
+
+static inline void line_put(Line *l, const char *s, size_t n) {
+    memcpy(l->buf + l->len, s, n);
+    l->len += n;
+}
+
+static inline void line_name(Line *l, const Name *name) {
+    // copies the padding too, which is overwritten next
+    memcpy(l->buf + l->len, name->str, sizeof(name->str));
+    l->len += name->len;
+}
+
+static void line_int(Line *l, long v) {
+    l->len += format_int(l->buf + l->len, v);
+}
+
+static void print_opnd(Line *l, const Opnd *x) {
+    switch (x->kind) {
+    case OPND_REG:
+        line_name(l, &REG_NAMES[x->reg]);
+        return;
+
+    case OPND_IMM:
+        line_int(l, x->imm);
+        return;
+
+    case OPND_MEM:
+        LINE_STR(l, "qword ptr [");
+        line_name(l, &REG_NAMES[x->reg]);
+        if (x->offset != 0) {
+            LINE_STR(l, "-");
+            line_int(l, x->offset);
+        }
+        LINE_STR(l, "]");
+        return;
+
+    case OPND_ADDR:
+        LINE_STR(l, "[");
+        line_name(l, &REG_NAMES[x->reg]);
+        LINE_STR(l, " + ");
+        line_name(l, &REG_NAMES[x->index]);
+        LINE_STR(l, "*");
+        line_int(l, x->scale);
+        LINE_STR(l, "]");
+        return;
+
+    case OPND_LABEL:
+        line_put(l, x->prefix, strlen(x->prefix));
+        line_int(l, x->seq);
+        return;
+
+    case OPND_SYM:
+        // symbols are as long as the identifiers in the source
+        line_end(l);
+        emit_bytes(l->e, x->str, x->len);
+        *l = line_begin(l->e);
+        return;
+
+    default:
+        return;
+    }
+}
+
+static void print_ins(Emitter *e, const AsmIns *ins) {
+    if (ins->op == AI_COMMENT) {
+        EMIT_STR(e, "  # ");
+        emit_bytes(e, ins->comment, strlen(ins->comment));
+        EMIT_STR(e, "\n");
+        return;
+    }
+
+    Line l = line_begin(e);
+
+    if (ins->op == AI_LABEL) {
+        print_opnd(&l, &ins->a);
+        LINE_STR(&l, ":\n");
+        line_end(&l);
+        return;
+    }
+
+    line_name(&l, &MNEMONICS[ins->op]);
+    if (ins->a.kind != OPND_NONE) {
+        LINE_STR(&l, " ");
+        print_opnd(&l, &ins->a);
+    }
+    if (ins->b.kind != OPND_NONE) {
+        LINE_STR(&l, ", ");
+        print_opnd(&l, &ins->b);
+    }
+    LINE_STR(&l, "\n");
+    line_end(&l);
+}
+
+/// Prints the oldest `n` instructions and drops them from the window
+static void print_oldest(AsmBuf *a, uint32_t n) {
+    for (uint32_t i = 0; i < n; i++) {
+        print_ins(a->out, &a->ins[i]);
+    }
+    memmove(a->ins, a->ins + n, (a->len - n) * sizeof(AsmIns));
+    a->len -= n;
+}
+
+void asm_flush(AsmBuf *a) {
+    print_oldest(a, a->len);
+}
+
+// --------------------------------------------------------------------------------
+// Peephole rules
+
+/// Maximum number of instructions a rule looks at
+#define MATCH_MAX 8
+
+/// The last instructions in the window, skipping comments
+typedef struct {
+    /// Indices into the window, the newest first
+    uint32_t at[MATCH_MAX];
+    int n;
+} Tail;
+
+static Tail tail_of(const AsmBuf *a) {
+    Tail t = {.n = 0};
+    for (uint32_t i = a->len; i > 0 && t.n < MATCH_MAX; i--) {
+        if (a->ins[i - 1].op != AI_COMMENT) {
+            t.at[t.n++] = i - 1;
+        }
+    }
+    return t;
+}
+
+static AsmIns *nth(AsmBuf *a, const Tail *t, int i) {
+    return &a->ins[t->at[i]];
+}
+
+/// Removes the `i`-th newest instruction. Remove newer ones first, since indices shift
+static void remove_nth(AsmBuf *a, const Tail *t, int i) {
+    uint32_t at = t->at[i];
+    memmove(a->ins + at, a->ins + at + 1, (a->len - at - 1) * sizeof(AsmIns));
+    a->len--;
+}
+
+static bool is_reg(Opnd x, Reg reg) {
+    return x.kind == OPND_REG && x.reg == reg;
+}
+
+/// True if the operand reads or writes `rsp`
+static bool uses_rsp(Opnd x) {
+    return (x.kind == OPND_REG || x.kind == OPND_MEM) && x.reg == REG_RSP;
+}
+
+static bool push_pop_same(AsmBuf *a, const Tail *t) {
+    if (t->n < 2 || nth(a, t, 1)->op != AI_PUSH || nth(a, t, 0)->op != AI_POP ||
+        !opnd_eq(nth(a, t, 1)->a, nth(a, t, 0)->a)) {
+        return false;
+    }
+
+    remove_nth(a, t, 0);
+    remove_nth(a, t, 1);
+    return true;
+}
+
+static bool push_pop_mov(AsmBuf *a, const Tail *t) {
+    if (t->n < 2 || nth(a, t, 1)->op != AI_PUSH || nth(a, t, 0)->op != AI_POP) {
+        return false;
+    }
+
+    Opnd src = nth(a, t, 1)->a;
+    Opnd dst = nth(a, t, 0)->a;
+    if (src.kind == OPND_MEM && dst.kind == OPND_MEM) {
+        return false;
+    }
+
+    *nth(a, t, 1) = (AsmIns){.op = AI_MOV, .a = dst, .b = src};
+    remove_nth(a, t, 0);
+    return true;
+}
+
+static bool push_mov_pop(AsmBuf *a, const Tail *t) {
+    if (t->n < 3 || nth(a, t, 0)->op != AI_POP) {
+        return false;
+    }
+
+    // find the `push`, over `mov`s that touch neither the stack nor the pushed value
+    for (int i = 1; i < t->n; i++) {
+        AsmIns *ins = nth(a, t, i);
+
+        if (ins->op == AI_PUSH) {
+            Opnd src = ins->a;
+            if (i == 1 || src.kind == OPND_MEM) {
+                return false;
+            }
+            for (int j = 1; j < i; j++) {
+                if (opnd_eq(nth(a, t, j)->a, src)) {
+                    return false;
+                }
+            }
+
+            *nth(a, t, 0) = (AsmIns){.op = AI_MOV, .a = nth(a, t, 0)->a, .b = src};
+            remove_nth(a, t, i);
+            return true;
+        }
+
+        if (ins->op != AI_MOV || uses_rsp(ins->a) || uses_rsp(ins->b)) {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+static bool self_mov(AsmBuf *a, const Tail *t) {
+    if (t->n < 1 || nth(a, t, 0)->op != AI_MOV || !opnd_eq(nth(a, t, 0)->a, nth(a, t, 0)->b)) {
+        return false;
+    }
+
+    remove_nth(a, t, 0);
+    return true;
+}
+
+static bool mov_back(AsmBuf *a, const Tail *t) {
+    if (t->n < 2 || nth(a, t, 1)->op != AI_MOV || nth(a, t, 0)->op != AI_MOV) {
+        return false;
+    }
+
+    AsmIns *x = nth(a, t, 1);
+    AsmIns *y = nth(a, t, 0);
+    if (!opnd_eq(x->a, y->b) || !opnd_eq(x->b, y->a)) {
+        return false;
+    }
+    // `mov rax, [rax]; mov [rax], rax` stores to the address loaded by the first one
+    if (y->a.kind == OPND_MEM && x->a.kind == OPND_REG && y->a.reg == x->a.reg) {
+        return false;
+    }
+
+    remove_nth(a, t, 0);
+    return true;
+}
+
+static bool frame_load(AsmBuf *a, const Tail *t) {
+    if (t->n < 3) {
+        return false;
+    }
+
+    AsmIns *base = nth(a, t, 2);
+    AsmIns *sub = nth(a, t, 1);
+    AsmIns *load = nth(a, t, 0);
+    if (base->op != AI_MOV || base->a.kind != OPND_REG || !is_reg(base->b, REG_RBP)) {
+        return false;
+    }
+
+    Reg r = base->a.reg;
+    if (sub->op != AI_SUB || !is_reg(sub->a, r) || sub->b.kind != OPND_IMM ||
+        sub->b.imm < 0 || sub->b.imm > INT32_MAX) {
+        return false;
+    }
+    if (load->op != AI_MOV || !is_reg(load->a, r) ||
+        !opnd_eq(load->b, opnd_mem(r, 0))) {
+        return false;
+    }
+
+    *base = (AsmIns){.op = AI_MOV, .a = opnd_reg(r), .b = opnd_mem(REG_RBP, sub->b.imm)};
+    remove_nth(a, t, 0);
+    remove_nth(a, t, 1);
+    return true;
+}
+
+static bool jmp_next(AsmBuf *a, const Tail *t) {
+    if (t->n < 2 || nth(a, t, 1)->op != AI_JMP || nth(a, t, 0)->op != AI_LABEL ||
+        !opnd_eq(nth(a, t, 1)->a, nth(a, t, 0)->a)) {
+        return false;
+    }
+
+    remove_nth(a, t, 1);
+    return true;
+}
+
+typedef struct {
+    /// Op of the newest instruction of every match, so that the other rules aren't tried
+    AsmOp last;
+    /// Rewrites the tail of the window, returning false if it doesn't match
+    bool (*apply)(AsmBuf *a, const Tail *t);
+} Rule;
+
+static const Rule RULES[PEEP_END] = {
+    [PEEP_PUSH_POP_SAME] = {AI_POP, push_pop_same},
+    [PEEP_PUSH_POP_MOV] = {AI_POP, push_pop_mov},
+    [PEEP_PUSH_MOV_POP] = {AI_POP, push_mov_pop},
+    [PEEP_SELF_MOV] = {AI_MOV, self_mov},
+    [PEEP_MOV_BACK] = {AI_MOV, mov_back},
+    [PEEP_FRAME_LOAD] = {AI_MOV, frame_load},
+    [PEEP_JMP_NEXT] = {AI_LABEL, jmp_next},
+};
+
+/// Runs the first rule that matches. Returns false if none does
+static bool rewrite(AsmBuf *a) {
+    Tail t = tail_of(a);
+    if (t.n == 0) {
+        return false;
+    }
+
+    AsmOp last = nth(a, &t, 0)->op;
+    for (int r = 0; r < PEEP_END; r++) {
+        if (RULES[r].last == last && RULES[r].apply(a, &t)) {
+            a->n_fired[r]++;
+            return true;
+        }
+    }
+    return false;
+}
+
+AsmIns *asm_slot(AsmBuf *a) {
+    if (a->len == ASM_WINDOW) {
+        print_oldest(a, ASM_WINDOW / 2);
+    }
+    return &a->ins[a->len];
+}
+
+void asm_commit(AsmBuf *a) {
+    AsmOp op = a->ins[a->len++].op;
+
+    // each rewrite can expose another match at the new tail. Most instructions start no match
+    if (a->peephole && (op == AI_POP || op == AI_MOV || op == AI_LABEL)) {
+        while (rewrite(a)) {
+        }
+    }
+}
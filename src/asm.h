@@ -0,0 +1,264 @@
+//! Buffered x86-64 instructions and the peephole optimizer
+//!
+//! The code generators append instructions to an `AsmBuf` instead of writing text. Each append runs
+//! the peephole rules over the last few instructions, and the instructions that slide out of the
+//! window are printed in Intel syntax.
+
+#ifndef CINC_ASM_H
+#define CINC_ASM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "emit.h"
+#include "utils.h"
+
+/// General-purpose registers (64-bit), plus `al`
+typedef enum {
+    REG_RAX,
+    REG_RCX,
+    REG_RDX,
+    REG_RBX,
+    REG_RSP,
+    REG_RBP,
+    REG_RSI,
+    REG_RDI,
+    REG_R8,
+    REG_R9,
+    REG_R10,
+    REG_R11,
+    REG_R12,
+    REG_R13,
+    REG_R14,
+    REG_R15,
+    REG_AL,
+
+    /// Number of `Reg`s, or no register
+    REG_END,
+} Reg;
+
+const char *reg_name(Reg reg);
+
+typedef enum {
+    OPND_NONE,
+    /// `reg`
+    OPND_REG,
+    /// `imm`
+    OPND_IMM,
+    /// `qword ptr [reg - offset]`
+    OPND_MEM,
+    /// `[reg + index * scale]`, the address computed by `lea`
+    OPND_ADDR,
+    /// `<prefix><seq>`
+    OPND_LABEL,
+    /// `str[0..len]`
+    OPND_SYM,
+} OpndKind;
+
+/// Operand of 16 bytes, which is passed and returned in registers
+typedef struct {
+    /// `OpndKind`
+    uint8_t kind;
+    /// (Register) the register, (Memory, Address) the base register
+    uint8_t reg;
+
+    union {
+        /// (Memory) Byte offset below the base register
+        int offset;
+        /// (Address) Index register and its scale (1, 2, 4 or 8)
+        struct {
+            uint8_t index;
+            uint8_t scale;
+        };
+        /// (Label) e.g. `3` of `.Lelse3`
+        int seq;
+        /// (Symbol)
+        uint32_t len;
+    };
+
+    union {
+        /// (Immediate)
+        long imm;
+        /// (Label) e.g. `.Lelse` of `.Lelse3`
+        const char *prefix;
+        /// (Symbol)
+        const char *str;
+    };
+} Opnd;
+
+typedef enum {
+    AI_MOV,
+    AI_MOVZB,
+    AI_PUSH,
+    AI_POP,
+    AI_ADD,
+    AI_SUB,
+    AI_IMUL,
+    AI_NEG,
+    AI_SHL,
+    AI_SAR,
+    AI_SHR,
+    AI_LEA,
+    AI_CQO,
+    AI_IDIV,
+    AI_CMP,
+
+    // `set<cc>` and `j<cc>`, in the same order of conditions
+    AI_SETE,
+    AI_SETNE,
+    AI_SETL,
+    AI_SETLE,
+    AI_SETG,
+    AI_SETGE,
+    AI_JE,
+    AI_JNE,
+    AI_JL,
+    AI_JLE,
+    AI_JG,
+    AI_JGE,
+
+    AI_JMP,
+    AI_CALL,
+    AI_RET,
+
+    /// `<a>:`
+    AI_LABEL,
+    /// `.p2align <a>`, padding with `nop`s to a multiple of `2^a` bytes
+    AI_P2ALIGN,
+    /// `  # <comment>`
+    AI_COMMENT,
+
+    /// Number of `AsmOp`s
+    AI_END,
+} AsmOp;
+
+typedef struct {
+    /// `AsmOp`
+    uint8_t op;
+    Opnd a;
+    Opnd b;
+    /// (Comment) String literal
+    const char *comment;
+} AsmIns;
+
+typedef enum {
+    /// `push X; pop X` -> nothing
+    PEEP_PUSH_POP_SAME,
+    /// `push X; pop Y` -> `mov Y, X`
+    PEEP_PUSH_POP_MOV,
+    /// `push X; mov ...; pop Y` -> `mov ...; mov Y, X` if the `mov`s don't write `X`
+    PEEP_PUSH_MOV_POP,
+    /// `mov X, X` -> nothing
+    PEEP_SELF_MOV,
+    /// `mov X, Y; mov Y, X` -> `mov X, Y`, unless `Y` is memory based on `X`
+    PEEP_MOV_BACK,
+    /// `mov rax, rbp; sub rax, N; mov rax, [rax]` -> `mov rax, [rbp-N]`
+    PEEP_FRAME_LOAD,
+    /// `jmp L; L:` -> `L:`
+    PEEP_JMP_NEXT,
+
+    /// Number of `PeepRule`s
+    PEEP_END,
+} PeepRule;
+
+extern const char *PEEP_RULE_NAMES[PEEP_END];
+
+/// Number of buffered instructions, which bounds how far back the rules can look
+#define ASM_WINDOW 32
+
+/// Sliding window of instructions, printed to `out` as they leave it
+typedef struct {
+    AsmIns ins[ASM_WINDOW];
+    uint32_t len;
+    Emitter *out;
+    /// Runs the peephole rules on append (`-fno-peephole` disables it)
+    bool peephole;
+    /// How many times each rule fired
+    uint64_t n_fired[PEEP_END];
+} AsmBuf;
+
+/// Buffer with the peephole optimizer enabled
+AsmBuf asm_init(Emitter *out);
+/// Prints every buffered instruction. Call it before writing to the `Emitter` directly
+void asm_flush(AsmBuf *a);
+
+/// Slot for the next instruction, which `asm_commit` appends once it's filled in. Writing the
+/// fields in place is faster than copying a whole `AsmIns` built on the stack
+AsmIns *asm_slot(AsmBuf *a);
+/// Appends the instruction in `asm_slot` and runs the peephole rules
+void asm_commit(AsmBuf *a);
+
+static inline Opnd opnd_reg(Reg reg) {
+    return (Opnd){.kind = OPND_REG, .reg = reg};
+}
+
+static inline Opnd opnd_imm(long imm) {
+    return (Opnd){.kind = OPND_IMM, .imm = imm};
+}
+
+static inline Opnd opnd_mem(Reg base, int offset) {
+    return (Opnd){.kind = OPND_MEM, .reg = base, .offset = offset};
+}
+
+static inline Opnd opnd_addr(Reg base, Reg index, int scale) {
+    return (Opnd){.kind = OPND_ADDR, .reg = base, .index = index, .scale = scale};
+}
+
+static inline Opnd opnd_label(const char *prefix, int seq) {
+    return (Opnd){.kind = OPND_LABEL, .seq = seq, .prefix = prefix};
+}
+
+static inline Opnd opnd_sym(Slice sym) {
+    return (Opnd){.kind = OPND_SYM, .len = sym.len, .str = sym.str};
+}
+
+bool opnd_eq(Opnd x, Opnd y);
+
+/// `j<cc>` taken when `jcc` is not
+static inline AsmOp asm_negate_jcc(AsmOp jcc) {
+    static const AsmOp NEGATED[6] = {AI_JNE, AI_JE, AI_JGE, AI_JG, AI_JLE, AI_JL};
+    return NEGATED[jcc - AI_JE];
+}
+
+static inline void asm_ins0(AsmBuf *a, AsmOp op) {
+    AsmIns *ins = asm_slot(a);
+    ins->op = op;
+    ins->a.kind = OPND_NONE;
+    ins->b.kind = OPND_NONE;
+    asm_commit(a);
+}
+
+static inline void asm_ins1(AsmBuf *a, AsmOp op, Opnd x) {
+    AsmIns *ins = asm_slot(a);
+    ins->op = op;
+    ins->a = x;
+    ins->b.kind = OPND_NONE;
+    asm_commit(a);
+}
+
+static inline void asm_ins2(AsmBuf *a, AsmOp op, Opnd x, Opnd y) {
+    AsmIns *ins = asm_slot(a);
+    ins->op = op;
+    ins->a = x;
+    ins->b = y;
+    asm_commit(a);
+}
+
+static inline void asm_label(AsmBuf *a, const char *prefix, int seq) {
+    asm_ins1(a, AI_LABEL, opnd_label(prefix, seq));
+}
+
+/// Aligns the label that follows as the target of a loop's backward branch, so that the loop body
+/// starts a 16-byte block of the instruction fetch
+static inline void asm_align_loop(AsmBuf *a) {
+    asm_ins1(a, AI_P2ALIGN, opnd_imm(4));
+}
+
+static inline void asm_comment(AsmBuf *a, const char *comment) {
+    AsmIns *ins = asm_slot(a);
+    ins->op = AI_COMMENT;
+    ins->comment = comment;
+    asm_commit(a);
+}
+
+#endif
@@ -0,0 +1,207 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ast.h"
+#include "parse.h"
+#include "utils.h"
+
+Ast ast_init() {
+    Ast ast = {
+        .nodes = NULL,
+        .len = 0,
+        .cap = 0,
+        .head = NODE_NIL,
+        .frame_size = 0,
+    };
+
+    // reserve the slot for `NODE_NIL`
+    ast_push(&ast, (AstNode){.kind = 0});
+    return ast;
+}
+
+void ast_release(Ast *ast) {
+    free(ast->nodes);
+    ast->nodes = NULL;
+    ast->len = 0;
+    ast->cap = 0;
+}
+
+void ast_clear(Ast *ast) {
+    // keep the `NODE_NIL` slot
+    ast->len = 1;
+    ast->head = NODE_NIL;
+}
+
+NodeId ast_push(Ast *ast, AstNode node) {
+    if (ast->len == ast->cap) {
+        ast->cap = ast->cap ? ast->cap * 2 : 256;
+        ast->nodes = realloc(ast->nodes, ast->cap * sizeof(AstNode));
+        if (!ast->nodes) {
+            panic("Out of memory (%u AST nodes)", ast->cap);
+        }
+    }
+
+    ast->nodes[ast->len] = node;
+    return ast->len++;
+}
+
+/// Parsed node waiting to be appended, and the field that will refer to it
+typedef struct {
+    Node *node;
+    /// Node whose field refers to it, or `NODE_NIL` for the first statement of the tree
+    NodeId owner;
+    /// Byte offset of the field in `AstNode`
+    uint32_t field;
+    /// True if the statements that follow it are appended too
+    bool list;
+} PendingNode;
+
+typedef struct {
+    PendingNode *items;
+    uint32_t len;
+    uint32_t cap;
+} PendingStack;
+
+static void push_pending(PendingStack *st, Node *node, NodeId owner, size_t field, bool list) {
+    if (!node) {
+        return;
+    }
+
+    if (st->len == st->cap) {
+        st->cap = st->cap ? st->cap * 2 : 64;
+        st->items = realloc(st->items, st->cap * sizeof(PendingNode));
+        if (!st->items) {
+            panic("Out of memory (%u pending AST nodes)", st->cap);
+        }
+    }
+    st->items[st->len++] = (PendingNode){node, owner, (uint32_t)field, list};
+}
+
+NodeId ast_push_tree(Ast *ast, Node *node) {
+    NodeId head = NODE_NIL;
+    PendingStack st = {0};
+    push_pending(&st, node, NODE_NIL, 0, true);
+
+    // without recursion, since an expression may nest deeper than the C stack allows. Each node
+    // is popped before its children, which are pushed in reverse, so the layout is in pre-order
+    // with the children laid out right after their parent
+    while (st.len > 0) {
+        PendingNode p = st.items[--st.len];
+        Node *n = p.node;
+        NodeId id = ast_push(ast, (AstNode){.kind = n->kind});
+
+        // written through the index: `ast_push` may move the array
+        if (p.owner == NODE_NIL) {
+            head = id;
+        } else {
+            *(NodeId *)((char *)ast_get(ast, p.owner) + p.field) = id;
+        }
+
+        // after the children
+        if (p.list) {
+            push_pending(&st, n->next, id, offsetof(AstNode, next), true);
+        }
+
+        switch (n->kind) {
+        case ND_NUM:
+            ast_get(ast, id)->val = n->val;
+            break;
+
+        case ND_LVAR:
+            ast_get(ast, id)->offset = n->offset;
+            break;
+
+        case ND_CALL:
+            ast_get(ast, id)->fname = n->fname;
+            break;
+
+        case ND_IF:
+        case ND_WHILE:
+            push_pending(&st, n->else_, id, offsetof(AstNode, branch.else_), false);
+            push_pending(&st, n->then, id, offsetof(AstNode, branch.then), false);
+            push_pending(&st, n->cond, id, offsetof(AstNode, branch.cond), false);
+            break;
+
+        case ND_FOR:
+            push_pending(&st, n->then, id, offsetof(AstNode, loop.then), false);
+            push_pending(&st, n->for_inc, id, offsetof(AstNode, loop.inc), false);
+            push_pending(&st, n->cond, id, offsetof(AstNode, loop.cond), false);
+            push_pending(&st, n->for_init, id, offsetof(AstNode, loop.init), false);
+            break;
+
+        case ND_BLOCK:
+            push_pending(&st, n->body, id, offsetof(AstNode, body), true);
+            break;
+
+        default:
+            // binary or `return`
+            push_pending(&st, n->rhs, id, offsetof(AstNode, bin.rhs), false);
+            push_pending(&st, n->lhs, id, offsetof(AstNode, bin.lhs), false);
+            break;
+        }
+    }
+
+    free(st.items);
+    return head;
+}
+
+Ast ast_from_scope(Scope scope) {
+    Ast ast = ast_init();
+    ast.head = ast_push_tree(&ast, scope.node);
+    ast.frame_size = scope_size(scope);
+    return ast;
+}
+
+AstStack ast_stack_init() {
+    return (AstStack){.frames = NULL, .len = 0, .cap = 0};
+}
+
+void ast_stack_release(AstStack *st) {
+    free(st->frames);
+    *st = ast_stack_init();
+}
+
+void ast_stack_push(AstStack *st, NodeId id) {
+    if (st->len == st->cap) {
+        st->cap = st->cap ? st->cap * 2 : 64;
+        st->frames = realloc(st->frames, st->cap * sizeof(AstFrame));
+        if (!st->frames) {
+            panic("Out of memory (walk of %u AST nodes deep)", st->cap);
+        }
+    }
+    st->frames[st->len++] = (AstFrame){.id = id, .state = 0, .val = 0};
+}
+
+bool ast_falls_through(const Ast *ast, NodeId id) {
+    const AstNode *node = ast_get(ast, id);
+
+    switch (node->kind) {
+    case ND_RETURN:
+        return false;
+
+    case ND_IF:
+        return node->branch.else_ == NODE_NIL || ast_falls_through(ast, node->branch.then) ||
+               ast_falls_through(ast, node->branch.else_);
+
+    case ND_WHILE:
+    case ND_FOR: {
+        NodeId cond = node->kind == ND_WHILE ? node->branch.cond : node->loop.cond;
+        const AstNode *c = ast_get(ast, cond);
+        return c->kind != ND_NUM || c->val == 0;
+    }
+
+    case ND_BLOCK:
+        for (NodeId n = node->body; n != NODE_NIL; n = ast_get(ast, n)->next) {
+            if (!ast_falls_through(ast, n)) {
+                return false;
+            }
+        }
+        return true;
+
+    default:
+        return true;
+    }
+}
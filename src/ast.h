@@ -0,0 +1,128 @@
+//! Compact, index-based layout of [`Node`]s
+//!
+//! The parser builds a pointer-linked tree of fat [`Node`]s. Before code generation, the tree is
+//! flattened into one growable array of small [`AstNode`]s that refer to each other with 32-bit
+//! indices, so that traversals walk contiguous memory.
+
+#ifndef CINC_AST_H
+#define CINC_AST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "parse.h"
+
+/// Index of an [`AstNode`] in `Ast.nodes`
+typedef uint32_t NodeId;
+
+/// Null node index. The first slot of `Ast.nodes` is reserved for it
+#define NODE_NIL ((NodeId)0)
+
+typedef struct {
+    /// `NodeKind`
+    uint8_t kind;
+
+    /// Next node in a statement list
+    NodeId next;
+
+    /// Payload for each kind
+    union {
+        /// (Binary, `return`)
+        struct {
+            NodeId lhs;
+            NodeId rhs;
+        } bin;
+
+        /// (Number) Value
+        int val;
+
+        /// (Local variable) Byte offset of the local variable starting from the stack base pointer
+        int offset;
+
+        /// (`if`, `while`)
+        struct {
+            NodeId cond;
+            NodeId then;
+            NodeId else_;
+        } branch;
+
+        /// (`for`)
+        struct {
+            NodeId init;
+            NodeId cond;
+            NodeId inc;
+            NodeId then;
+        } loop;
+
+        /// (Block) First statement
+        NodeId body;
+
+        /// (Function)
+        Slice fname;
+    };
+} AstNode;
+
+_Static_assert(sizeof(AstNode) == 24, "AstNode is expected to be 24 bytes");
+
+/// Growable array of nodes
+typedef struct {
+    AstNode *nodes;
+    uint32_t len;
+    uint32_t cap;
+    /// First top-level statement
+    NodeId head;
+    /// `scope_size` of the program
+    int frame_size;
+} Ast;
+
+Ast ast_init();
+void ast_release(Ast *ast);
+/// Removes every node but keeps the allocation
+void ast_clear(Ast *ast);
+/// Appends a node and returns its index. Pointers into `ast->nodes` are invalidated
+NodeId ast_push(Ast *ast, AstNode node);
+/// Appends a statement list in pre-order and returns the index of the first statement
+NodeId ast_push_tree(Ast *ast, Node *node);
+/// Flattens a parsed program
+Ast ast_from_scope(Scope scope);
+
+/// Node being visited by an iterative walk
+typedef struct {
+    NodeId id;
+    /// Number of steps done at the node, e.g. of children visited
+    uint32_t state;
+    /// Partial result of the walk at the node, e.g. the value of the left operand
+    long val;
+} AstFrame;
+
+/// Explicit stack of an iterative walk. Expressions are walked without recursion, since they may
+/// nest deeper than the C stack allows. A walk may start while another one is in progress, as long
+/// as it pops only the frames above the `len` it started from
+typedef struct {
+    AstFrame *frames;
+    uint32_t len;
+    uint32_t cap;
+} AstStack;
+
+AstStack ast_stack_init();
+void ast_stack_release(AstStack *st);
+/// Pushes a node in its first state. Pointers into `st->frames` are invalidated
+void ast_stack_push(AstStack *st, NodeId id);
+
+static inline AstFrame *ast_stack_top(const AstStack *st) {
+    return &st->frames[st->len - 1];
+}
+
+static inline NodeId ast_stack_pop(AstStack *st) {
+    return st->frames[--st->len].id;
+}
+
+/// False if the statement never completes normally: it always returns or loops forever (there's no
+/// `break`)
+bool ast_falls_through(const Ast *ast, NodeId id);
+
+static inline AstNode *ast_get(const Ast *ast, NodeId id) {
+    return &ast->nodes[id];
+}
+
+#endif
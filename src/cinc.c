@@ -0,0 +1,121 @@
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ast.h"
+#include "cinc.h"
+#include "codegen.h"
+#include "dce.h"
+#include "emit.h"
+#include "fold.h"
+#include "intern.h"
+#include "parse.h"
+#include "propagate.h"
+#include "scan.h"
+#include "token.h"
+#include "utils.h"
+
+/// Byte size of each arena chunk
+#define ARENA_CHUNK_SIZE (1 << 16)
+
+struct Cinc {
+    /// Nodes and local variables
+    Arena arena;
+    Interner names;
+    /// Tokens and the expression stacks
+    ParseState pst;
+    Scanner scan;
+    Emitter out;
+    Diag diag;
+
+    // state of the current compilation, which an error has to release
+    Scope scope;
+    bool has_scope;
+    Ast ast;
+};
+
+Cinc *cinc_new() {
+    Cinc *cc = calloc(1, sizeof(Cinc));
+    if (!cc) {
+        panic("Out of memory (compile context)");
+    }
+
+    cc->arena = arena_init(ARENA_CHUNK_SIZE);
+    cc->names = interner_init();
+    cc->pst = pst_init((TokenBuf){.names = &cc->names}, &cc->arena);
+    cc->pst.diag = &cc->diag;
+    cc->scan = scanner_select();
+    cc->out = emitter_to_memory();
+
+    return cc;
+}
+
+/// Drops the state of the last compilation
+static void cinc_clear(Cinc *cc) {
+    if (cc->has_scope) {
+        symtab_release(&cc->scope.syms);
+        cc->has_scope = false;
+    }
+    ast_release(&cc->ast);
+
+    emitter_clear(&cc->out);
+    interner_clear(&cc->names);
+    arena_reset(&cc->arena);
+}
+
+void cinc_release(Cinc *cc) {
+    cinc_clear(cc);
+    emitter_release(&cc->out);
+    pst_release(&cc->pst);
+    interner_release(&cc->names);
+    arena_release(&cc->arena);
+    free(cc);
+}
+
+CincStatus cinc_compile(Cinc *cc, char *src, char *out, size_t out_cap, size_t *out_len) {
+    cinc_clear(cc);
+    cc->diag.msg[0] = '\0';
+
+    // errors jump back here. Every state is in `cc`, so no local variable is clobbered
+    if (setjmp(cc->diag.handler)) {
+        cinc_clear(cc);
+        return CINC_ERR_COMPILE;
+    }
+
+    pst_reset(&cc->pst, src);
+    Lexer lex = lexer_from_source(src, &cc->names, cc->scan);
+    lex.diag = &cc->diag;
+    while (lexer_next(&lex, &cc->pst.tks) != TK_EOF) {
+    }
+
+    // `parse_program`, but with the scope owned by `cc`
+    cc->scope = scope_init();
+    cc->has_scope = true;
+    Node **link = &cc->scope.node;
+    do {
+        *link = parse_stmt(&cc->pst, &cc->scope);
+        link = &(*link)->next;
+    } while (!pst_is_at_eof(&cc->pst));
+
+    cc->ast = ast_from_scope(cc->scope);
+    fold_program(&cc->ast);
+    propagate_program(&cc->ast, true);
+    dce_program(&cc->ast);
+
+    Codegen cg = codegen_init(&cc->out);
+    cg.diag = &cc->diag;
+    write_program(&cg, &cc->ast);
+    codegen_release(&cg);
+
+    *out_len = cc->out.len;
+    if (cc->out.len > out_cap) {
+        return CINC_ERR_OUTPUT_TOO_SMALL;
+    }
+
+    memcpy(out, cc->out.buf, cc->out.len);
+    return CINC_OK;
+}
+
+const char *cinc_error(const Cinc *cc) {
+    return cc->diag.msg;
+}
@@ -0,0 +1,34 @@
+//! libcinc, the compiler as a library
+//!
+//! A `Cinc` context compiles one source after another, reusing its buffers. Errors in a source are
+//! returned instead of exiting the process. Contexts share no state, so each thread can have its
+//! own.
+
+#ifndef CINC_CINC_H
+#define CINC_CINC_H
+
+#include <stddef.h>
+
+typedef struct Cinc Cinc;
+
+typedef enum {
+    CINC_OK = 0,
+    /// The source is invalid; see `cinc_error`
+    CINC_ERR_COMPILE,
+    /// The output buffer is too small; the required size is returned
+    CINC_ERR_OUTPUT_TOO_SMALL,
+} CincStatus;
+
+Cinc *cinc_new();
+void cinc_release(Cinc *cc);
+
+/// Compiles a null-terminated source into x86-64 assembly, written to `out` of `out_cap` bytes.
+/// `*out_len` is set to the byte length of the assembly (not null-terminated) unless the source is
+/// invalid. The code is a `main` from the stack machine (`cinc --backend=stack`), after every
+/// optimization of the AST
+CincStatus cinc_compile(Cinc *cc, char *src, char *out, size_t out_cap, size_t *out_len);
+
+/// Message of the last `CINC_ERR_COMPILE`
+const char *cinc_error(const Cinc *cc);
+
+#endif
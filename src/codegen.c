@@ -1,292 +1,388 @@
-#include <ctype.h>
-#include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "asm.h"
+#include "ast.h"
 #include "codegen.h"
+#include "emit.h"
+#include "isel.h"
 #include "parse.h"
 #include "utils.h"
 
+static const Opnd RAX = {.kind = OPND_REG, .reg = REG_RAX};
+static const Opnd RDI = {.kind = OPND_REG, .reg = REG_RDI};
+static const Opnd RSP = {.kind = OPND_REG, .reg = REG_RSP};
+static const Opnd RBP = {.kind = OPND_REG, .reg = REG_RBP};
+static const Opnd AL = {.kind = OPND_REG, .reg = REG_AL};
+
 /// - `discard`: pops the last value if true
-static void write_any(Node *node, bool discard);
+static void write_any(Codegen *cg, const Ast *ast, NodeId id, bool discard);
+static void write_expr(Codegen *cg, const Ast *ast, NodeId id, bool discard);
 
 static const bool DISCARD = true;
 static const bool KEEP = false;
 
-void write_program(Scope scope) {
-    write_asm_header();
+Codegen codegen_init(Emitter *out) {
+    return (Codegen){
+        .out = out,
+        .as = asm_init(out),
+        .seq = 0,
+        .diag = NULL,
+        .entry = "main",
+        .stack = ast_stack_init(),
+    };
+}
+
+void codegen_release(Codegen *cg) {
+    ast_stack_release(&cg->stack);
+}
+
+void write_program(Codegen *cg, const Ast *ast) {
+    write_asm_header(cg);
 
-    write_prologue(scope);
+    write_prologue(cg, ast);
 
-    for (Node *node = scope.node; node; node = node->next) {
-        write_any(node, DISCARD);
+    for (NodeId id = ast->head; id != NODE_NIL; id = ast_get(ast, id)->next) {
+        write_any(cg, ast, id, DISCARD);
     }
 
-    printf("\n");
-    printf("  # epilogue\n");
-    write_epilogue();
+    write_program_epilogue(cg);
+}
+
+void write_asm_header(Codegen *cg) {
+    asm_flush(&cg->as);
+    EMIT_STR(cg->out, ".intel_syntax noprefix\n");
+    size_t len = strlen(cg->entry);
+    EMIT_STR(cg->out, ".global ");
+    emit_bytes(cg->out, cg->entry, len);
+    EMIT_STR(cg->out, "\n");
+    emit_bytes(cg->out, cg->entry, len);
+    EMIT_STR(cg->out, ":\n");
 }
 
-void write_asm_header() {
-    printf(".intel_syntax noprefix\n");
-    printf(".global main\n");
-    printf("main:\n");
+void write_prologue(Codegen *cg, const Ast *ast) {
+    write_prologue_sized(cg, ast->frame_size);
 }
 
-void write_prologue(Scope scope) {
+void write_prologue_sized(Codegen *cg, int size) {
     // push BSP to the linked list
-    printf("  # prologue\n");
-    printf("    push rbp\n");
-    printf("    mov rbp, rsp\n");
-    int size = scope_size(scope);
-    printf("    sub rsp, %d\n", size);
-    printf("\n");
+    asm_flush(&cg->as);
+    EMIT_COMMENT(cg->out, "prologue");
+    EMIT_INS(cg->out, "push rbp");
+    EMIT_INS(cg->out, "mov rbp, rsp");
+    EMIT_INS_INT(cg->out, "sub rsp, ", size);
+    EMIT_STR(cg->out, "\n");
 }
 
-void write_epilogue() {
+void write_prologue_deferred(Codegen *cg) {
+    asm_flush(&cg->as);
+    EMIT_COMMENT(cg->out, "prologue");
+    EMIT_INS(cg->out, "push rbp");
+    EMIT_INS(cg->out, "mov rbp, rsp");
+    EMIT_INS(cg->out, "sub rsp, OFFSET .Lframe_size");
+    EMIT_STR(cg->out, "\n");
+}
+
+void write_frame_size(Codegen *cg, int size) {
+    asm_flush(&cg->as);
+    EMIT_LINE_INT(cg->out, ".set .Lframe_size, ", size);
+}
+
+void write_stmt(Codegen *cg, const Ast *ast, NodeId id) {
+    write_any(cg, ast, id, DISCARD);
+}
+
+void write_epilogue(Codegen *cg) {
     // pop BSP of the linked list
-    printf("    mov rsp, rbp\n");
-    printf("    pop rbp\n");
-    printf("    ret\n");
+    asm_ins2(&cg->as, AI_MOV, RSP, RBP);
+    asm_ins1(&cg->as, AI_POP, RBP);
+    asm_ins0(&cg->as, AI_RET);
 }
 
-static void discard_if(bool b) {
+void write_program_epilogue(Codegen *cg) {
+    asm_flush(&cg->as);
+    EMIT_STR(cg->out, "\n");
+    EMIT_COMMENT(cg->out, "epilogue");
+    write_epilogue(cg);
+    asm_flush(&cg->as);
+}
+
+static void discard_if(Codegen *cg, bool b) {
     if (b) {
-        printf("  # discard\n");
-        printf("    pop rax\n");
+        asm_comment(&cg->as, "discard");
+        asm_ins1(&cg->as, AI_POP, RAX);
     }
 }
 
-static void write_addr(Node *node) {
+static void write_addr(Codegen *cg, const AstNode *node) {
     if (node->kind != ND_LVAR) {
-        panic("left value expected");
+        diag_error(cg->diag, "left value expected");
     }
 
-    printf("  # push address\n");
-    printf("    mov rax, rbp\n");
-    printf("    sub rax, %d\n", node->offset);
-    printf("    push rax\n");
+    asm_comment(&cg->as, "push address");
+    asm_ins2(&cg->as, AI_MOV, RAX, RBP);
+    asm_ins2(&cg->as, AI_SUB, RAX, opnd_imm(node->offset));
+    asm_ins1(&cg->as, AI_PUSH, RAX);
 }
 
-/// Sequential number for unique label names
-int gSeq = 0;
+/// The operand `x` of `x * c` or `x / c` with `c` a number, which is written without pushing `c`,
+/// or `NODE_NIL`. A multiplication by a number on the left is turned around, since a number has no
+/// side effects to order
+static NodeId by_num_operand(const Ast *ast, const AstNode *node) {
+    const AstNode *lhs = ast_get(ast, node->bin.lhs);
+    const AstNode *rhs = ast_get(ast, node->bin.rhs);
 
-static void write_any(Node *node, bool discard) {
-    switch (node->kind) {
-    case ND_ASSIGN:
-        write_addr(node->lhs);
-        write_any(node->rhs, KEEP);
+    if (node->kind == ND_MUL && (rhs->kind == ND_NUM || lhs->kind == ND_NUM)) {
+        return rhs->kind != ND_NUM ? node->bin.rhs : node->bin.lhs;
+    }
+
+    // division by zero traps at run time, with `idiv`
+    if (node->kind == ND_DIV && rhs->kind == ND_NUM && rhs->val != 0) {
+        return node->bin.lhs;
+    }
+
+    return NODE_NIL;
+}
 
-        printf("  # assign\n");
-        printf("    pop rdi\n");
-        printf("    pop rax\n");
-        printf("    mov [rax], rdi\n");
-        printf("    push rdi\n");
+/// Writes `x * c` or `x / c` to `rax`, with `x` pushed (see `by_num_operand`)
+static void write_by_num(Codegen *cg, const Ast *ast, const AstNode *node) {
+    const AstNode *lhs = ast_get(ast, node->bin.lhs);
+    const AstNode *rhs = ast_get(ast, node->bin.rhs);
+    AsmBuf *as = &cg->as;
 
-        discard_if(discard);
+    if (node->kind == ND_MUL) {
+        asm_ins1(as, AI_POP, RAX);
+        isel_mul_imm(as, REG_RAX, rhs->kind == ND_NUM ? rhs->val : lhs->val);
         return;
+    }
+
+    asm_ins1(as, AI_POP, RDI);
+    asm_comment(as, "/");
+    isel_div_imm(as, RDI, rhs->val);
+}
+
+/// Jumps to `<label><seq>` if the condition is `when`, falling through otherwise. A comparison sets
+/// the flags for the jump, instead of a boolean in `rax` to be compared with zero
+static void write_cond(Codegen *cg, const Ast *ast, NodeId cond, bool when, const char *label,
+                       int seq) {
+    const AstNode *node = ast_get(ast, cond);
+    AsmBuf *as = &cg->as;
+    Opnd target = opnd_label(label, seq);
+
+    if (node->kind == ND_NUM) {
+        // decided at compile time
+        if ((node->val != 0) == when) {
+            asm_ins1(as, AI_JMP, target);
+        }
+        return;
+    }
 
+    AsmOp jcc;
+    if (node->kind >= ND_EQ && node->kind <= ND_GE) {
+        const AstNode *rhs = ast_get(ast, node->bin.rhs);
+        write_expr(cg, ast, node->bin.lhs, KEEP);
+        if (rhs->kind == ND_NUM) {
+            asm_ins1(as, AI_POP, RAX);
+            asm_ins2(as, AI_CMP, RAX, opnd_imm(rhs->val));
+        } else {
+            write_expr(cg, ast, node->bin.rhs, KEEP);
+            asm_ins1(as, AI_POP, RDI);
+            asm_ins1(as, AI_POP, RAX);
+            asm_ins2(as, AI_CMP, RAX, RDI);
+        }
+        // `ND_EQ`..`ND_GE` are in the same order as `AI_JE`..`AI_JGE`
+        jcc = AI_JE + (node->kind - ND_EQ);
+    } else {
+        write_expr(cg, ast, cond, KEEP);
+        asm_ins1(as, AI_POP, RAX);
+        asm_ins2(as, AI_CMP, RAX, opnd_imm(0));
+        jcc = AI_JNE;
+    }
+
+    asm_ins1(as, when ? jcc : asm_negate_jcc(jcc), target);
+}
+
+static void write_any(Codegen *cg, const Ast *ast, NodeId id, bool discard) {
+    // NOTE: the pointer is invalidated only by `ast_push`, which codegen never calls
+    AstNode *node = ast_get(ast, id);
+    AsmBuf *as = &cg->as;
+
+    switch (node->kind) {
     case ND_RETURN:
-        write_any(node->lhs, KEEP);
-        printf("  pop rax\n");
+        write_expr(cg, ast, node->bin.lhs, KEEP);
+        asm_ins1(as, AI_POP, RAX);
 
         // jumping to function epilogue also works
-        printf("  # return (embedded epilogue)\n");
-        write_epilogue();
+        asm_comment(as, "return (embedded epilogue)");
+        write_epilogue(cg);
         return;
 
     case ND_IF: {
-        int seq = gSeq++;
+        int seq = cg->seq++;
 
-        if (node->else_) {
+        if (node->branch.else_ != NODE_NIL) {
             // if then else
-            printf("  # if else\n");
-            write_any(node->cond, KEEP);
-            printf("  pop rax\n");
-            printf("  cmp rax, 0\n");
+            asm_comment(as, "if else");
 
             // goto else, goto end
-            printf("  je .Lelse%d\n", seq);
+            write_cond(cg, ast, node->branch.cond, false, ".Lelse", seq);
 
-            // then
-            write_any(node->then, DISCARD);
-            printf("  jmp .Lend_if%d\n", seq);
+            // then, which needs no jump if it returns
+            write_any(cg, ast, node->branch.then, DISCARD);
+            if (ast_falls_through(ast, node->branch.then)) {
+                asm_ins1(as, AI_JMP, opnd_label(".Lend_if", seq));
+            }
 
             // else
-            printf(".Lelse%d:\n", seq);
-            write_any(node->else_, DISCARD);
-            printf("  jmp .Lend_if%d\n", seq);
+            asm_label(as, ".Lelse", seq);
+            write_any(cg, ast, node->branch.else_, DISCARD);
+            asm_ins1(as, AI_JMP, opnd_label(".Lend_if", seq));
 
             // end
-            printf(".Lend_if%d:\n", seq);
+            asm_label(as, ".Lend_if", seq);
         } else {
             // if then no else
-            printf("  # if\n");
-            write_any(node->cond, KEEP);
+            asm_comment(as, "if");
 
             // goto else
-            printf("  pop rax\n");
-            printf("  cmp rax, 0\n");
-            printf("  je .Lend_if%d\n", seq);
+            write_cond(cg, ast, node->branch.cond, false, ".Lend_if", seq);
 
             // then
-            write_any(node->then, DISCARD);
-            printf("  jmp .Lend_if%d\n", seq);
+            write_any(cg, ast, node->branch.then, DISCARD);
+            if (ast_falls_through(ast, node->branch.then)) {
+                asm_ins1(as, AI_JMP, opnd_label(".Lend_if", seq));
+            }
 
             // end
-            printf(".Lend_if%d:\n", seq);
+            asm_label(as, ".Lend_if", seq);
         }
 
         return;
     }
 
     case ND_WHILE: {
-        int seq = gSeq++;
+        int seq = cg->seq++;
 
-        printf(".Lloop_while%d:\n", seq);
-        write_any(node->cond, KEEP);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je .Lend_while%d\n", seq);
+        // rotated: the condition is tested once before the loop, then at the end of each iteration
+        write_cond(cg, ast, node->branch.cond, false, ".Lend_while", seq);
+        asm_align_loop(as);
+        asm_label(as, ".Lloop_while", seq);
 
-        write_any(node->then, DISCARD);
-        printf("  jmp .Lloop_while%d\n", seq);
+        write_any(cg, ast, node->branch.then, DISCARD);
+        write_cond(cg, ast, node->branch.cond, true, ".Lloop_while", seq);
 
-        printf(".Lend_while%d:\n", seq);
+        asm_label(as, ".Lend_while", seq);
         return;
     }
 
     case ND_FOR: {
-        int seq = gSeq++;
+        int seq = cg->seq++;
 
-        write_any(node->for_init, DISCARD);
-        printf(".Lloop_for%d:\n", seq);
+        write_any(cg, ast, node->loop.init, DISCARD);
 
-        write_any(node->cond, KEEP);
-        printf("  cmp rax, 0\n");
-        printf("  je .Lend_for%d\n", seq);
+        // rotated like `while`
+        write_cond(cg, ast, node->loop.cond, false, ".Lend_for", seq);
+        asm_align_loop(as);
+        asm_label(as, ".Lloop_for", seq);
 
-        write_any(node->for_inc, DISCARD);
-        write_any(node->then, DISCARD);
-        printf("  jmp .Lloop_for%d\n", seq);
+        write_any(cg, ast, node->loop.then, DISCARD);
+        write_any(cg, ast, node->loop.inc, DISCARD);
+        write_cond(cg, ast, node->loop.cond, true, ".Lloop_for", seq);
 
-        printf(".Lend_for%d:\n", seq);
+        asm_label(as, ".Lend_for", seq);
         return;
     }
 
     case ND_BLOCK: {
-        for (Node *n = node->body; n; n = n->next) {
-            write_any(n, DISCARD);
+        for (NodeId n = node->body; n != NODE_NIL; n = ast_get(ast, n)->next) {
+            write_any(cg, ast, n, DISCARD);
         }
 
         return;
     };
 
-    case ND_CALL:
-        printf("  call %.*s\n", node->fname.len, node->fname.str);
-        printf("  push rax\n");
-
-        discard_if(discard);
-        return;
-
-    case ND_LVAR:
-        printf("  # local variable (push address + dereference rax)\n");
-        write_addr(node);
-
-        printf("  # dereference rax\n");
-        printf("    pop rax\n");
-        printf("    mov rax, [rax]\n");
-        printf("    push rax\n");
-
-        discard_if(discard);
-        return;
-
-    case ND_NUM:
-        printf("  push %d\n", node->val);
-
-        discard_if(discard);
-        return;
-
     default:
-        break;
+        write_expr(cg, ast, id, discard);
+        return;
     }
+}
 
-    // binary expressions
-    write_any(node->lhs, false);
-    write_any(node->rhs, false);
+/// Writes a binary operator to `rax`, with both operands pushed
+static void write_binary(Codegen *cg, const AstNode *node) {
+    AsmBuf *as = &cg->as;
 
-    printf("  pop rdi\n");
-    printf("  pop rax\n");
+    asm_ins1(as, AI_POP, RDI);
+    asm_ins1(as, AI_POP, RAX);
 
     switch (node->kind) {
         // arithmetic operators
     case ND_ADD:
-        printf("  add rax, rdi\n");
+        asm_ins2(as, AI_ADD, RAX, RDI);
         break;
 
     case ND_SUB:
-        printf("  sub rax, rdi\n");
+        asm_ins2(as, AI_SUB, RAX, RDI);
         break;
 
     case ND_MUL:
-        printf("  imul rax, rdi\n");
+        asm_ins2(as, AI_IMUL, RAX, RDI);
         break;
 
     case ND_DIV:
-        printf("  # /\n");
-        printf("    cqo\n");
-        printf("    idiv rdi\n");
+        asm_comment(as, "/");
+        asm_ins0(as, AI_CQO);
+        asm_ins1(as, AI_IDIV, RDI);
         break;
 
         // comparison operators
     case ND_EQ:
         // ==
-        printf("  # ==\n");
-        printf("    cmp rax, rdi\n");
-        printf("    sete al\n");
-        printf("    movzb rax, al\n");
+        asm_comment(as, "==");
+        asm_ins2(as, AI_CMP, RAX, RDI);
+        asm_ins1(as, AI_SETE, AL);
+        asm_ins2(as, AI_MOVZB, RAX, AL);
         break;
 
     case ND_NE:
         // !=
-        printf("  # !=\n");
-        printf("    cmp rax, rdi\n");
-        printf("    setne al\n");
-        printf("    movzb rax, al\n");
+        asm_comment(as, "!=");
+        asm_ins2(as, AI_CMP, RAX, RDI);
+        asm_ins1(as, AI_SETNE, AL);
+        asm_ins2(as, AI_MOVZB, RAX, AL);
         break;
 
     case ND_LT:
         // <
-        printf("  # <\n");
-        printf("    cmp rax, rdi\n");
-        printf("    setl al\n");
-        printf("    movzb rax, al\n");
+        asm_comment(as, "<");
+        asm_ins2(as, AI_CMP, RAX, RDI);
+        asm_ins1(as, AI_SETL, AL);
+        asm_ins2(as, AI_MOVZB, RAX, AL);
         break;
 
     case ND_LE:
         // <=
-        printf("  # <=\n");
-        printf("    cmp rax, rdi\n");
-        printf("    setle al\n");
-        printf("    movzb rax, al\n");
+        asm_comment(as, "<=");
+        asm_ins2(as, AI_CMP, RAX, RDI);
+        asm_ins1(as, AI_SETLE, AL);
+        asm_ins2(as, AI_MOVZB, RAX, AL);
         break;
 
     case ND_GT:
         // >
-        printf("  # >\n");
-        printf("    cmp rdi, rax\n");
-        printf("    setl al\n");
-        printf("    movzb rax, al\n");
+        asm_comment(as, ">");
+        asm_ins2(as, AI_CMP, RDI, RAX);
+        asm_ins1(as, AI_SETL, AL);
+        asm_ins2(as, AI_MOVZB, RAX, AL);
         break;
 
     case ND_GE:
         // >=
-        printf("  # >=\n");
-        printf("    cmp rdi, rax\n");
-        printf("    setle al\n");
-        printf("    movzb rax, al\n");
+        asm_comment(as, ">=");
+        asm_ins2(as, AI_CMP, RDI, RAX);
+        asm_ins1(as, AI_SETLE, AL);
+        asm_ins2(as, AI_MOVZB, RAX, AL);
         break;
 
     default:
@@ -295,7 +391,83 @@ static void write_any(Node *node, bool discard) {
         exit(1);
         break;
     }
+}
+
+/// Writes an expression without recursion, since it may nest deeper than the C stack allows. Each
+/// node is visited once before its children and once after them
+static void write_expr(Codegen *cg, const Ast *ast, NodeId id, bool discard) {
+    AsmBuf *as = &cg->as;
+    AstStack *st = &cg->stack;
+    uint32_t base = st->len;
+    ast_stack_push(st, id);
+
+    while (st->len > base) {
+        AstFrame *top = ast_stack_top(st);
+        const AstNode *node = ast_get(ast, top->id);
+        bool leaf = node->kind == ND_NUM || node->kind == ND_LVAR || node->kind == ND_CALL;
+
+        if (top->state == 0 && !leaf) {
+            top->state = 1;
+
+            if (node->kind == ND_ASSIGN) {
+                write_addr(cg, ast_get(ast, node->bin.lhs));
+                ast_stack_push(st, node->bin.rhs);
+                continue;
+            }
+
+            NodeId operand = by_num_operand(ast, node);
+            if (operand != NODE_NIL) {
+                ast_stack_push(st, operand);
+            } else {
+                // the left operand is popped, and so written, first
+                ast_stack_push(st, node->bin.rhs);
+                ast_stack_push(st, node->bin.lhs);
+            }
+            continue;
+        }
 
-    printf("  push rax\n");
-    discard_if(discard);
+        st->len--;
+        // only the value of the whole expression may be discarded
+        bool discard_this = discard && st->len == base;
+
+        switch (node->kind) {
+        case ND_ASSIGN:
+            asm_comment(as, "assign");
+            asm_ins1(as, AI_POP, RDI);
+            asm_ins1(as, AI_POP, RAX);
+            asm_ins2(as, AI_MOV, opnd_mem(REG_RAX, 0), RDI);
+            asm_ins1(as, AI_PUSH, RDI);
+            break;
+
+        case ND_CALL:
+            asm_ins1(as, AI_CALL, opnd_sym(node->fname));
+            asm_ins1(as, AI_PUSH, RAX);
+            break;
+
+        case ND_LVAR:
+            asm_comment(as, "local variable (push address + dereference rax)");
+            write_addr(cg, node);
+
+            asm_comment(as, "dereference rax");
+            asm_ins1(as, AI_POP, RAX);
+            asm_ins2(as, AI_MOV, RAX, opnd_mem(REG_RAX, 0));
+            asm_ins1(as, AI_PUSH, RAX);
+            break;
+
+        case ND_NUM:
+            asm_ins1(as, AI_PUSH, opnd_imm(node->val));
+            break;
+
+        default:
+            if (by_num_operand(ast, node) != NODE_NIL) {
+                write_by_num(cg, ast, node);
+            } else {
+                write_binary(cg, node);
+            }
+            asm_ins1(as, AI_PUSH, RAX);
+            break;
+        }
+
+        discard_if(cg, discard_this);
+    }
 }
@@ -3,18 +3,58 @@
 #ifndef CINC_CODEGEN_H
 #define CINC_CODEGEN_H
 
-#include "parse.h"
+#include "asm.h"
+#include "ast.h"
+#include "emit.h"
+#include "ir.h"
+
+/// Code generator state
+typedef struct {
+    /// Output assembly
+    Emitter *out;
+    /// Instructions not printed to `out` yet, which the peephole rules can still rewrite
+    AsmBuf as;
+    /// Sequential number for unique label names
+    int seq;
+    /// Where errors are reported, or NULL to exit on error
+    Diag *diag;
+    /// Symbol name of the emitted function (`main` by default)
+    const char *entry;
+    /// Walks over the expressions
+    AstStack stack;
+} Codegen;
+
+Codegen codegen_init(Emitter *out);
+void codegen_release(Codegen *cg);
 
 /// Outputs x86-64 assembly
-void write_program(Scope scope);
+void write_program(Codegen *cg, const Ast *ast);
+
+/// Outputs x86-64 assembly from the IR (`--backend=ir`)
+void write_program_ir(Codegen *cg, const IrFunc *fn);
 
 /// Outputs assembly header
-void write_asm_header();
+void write_asm_header(Codegen *cg);
 
 /// Outputs function prologue
-void write_prologue(Scope scope);
+void write_prologue(Codegen *cg, const Ast *ast);
+
+/// Outputs function prologue with a frame of `size` bytes
+void write_prologue_sized(Codegen *cg, int size);
+
+/// Outputs function prologue, referring to the frame size defined later by `write_frame_size`
+void write_prologue_deferred(Codegen *cg);
+
+/// Defines the frame size referred to by `write_prologue_deferred`
+void write_frame_size(Codegen *cg, int size);
+
+/// Outputs a top-level statement
+void write_stmt(Codegen *cg, const Ast *ast, NodeId id);
 
 /// Outputs function epilogue
-void write_epilogue();
+void write_epilogue(Codegen *cg);
+
+/// Outputs the epilogue at the end of the program and prints the buffered instructions
+void write_program_epilogue(Codegen *cg);
 
 #endif
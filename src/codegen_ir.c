@@ -0,0 +1,288 @@
+//! x86-64 backend of the IR
+//!
+//! Local variables are promoted to virtual registers, which are then given x86-64 registers by
+//! `regalloc_run`. Only the virtual registers spilled under register pressure live in the stack
+//! frame. `rax` and `rdx` are scratch registers for operands that are both in memory, `idiv` (and
+//! the multiplication replacing it for constant divisors) and the return value.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "asm.h"
+#include "codegen.h"
+#include "emit.h"
+#include "ir.h"
+#include "isel.h"
+#include "regalloc.h"
+#include "utils.h"
+
+static const Opnd RAX = {.kind = OPND_REG, .reg = REG_RAX};
+static const Opnd AL = {.kind = OPND_REG, .reg = REG_AL};
+
+static bool is_mem(Opnd x) {
+    return x.kind == OPND_MEM;
+}
+
+static Opnd vreg_operand(const RegAlloc *ra, VReg v) {
+    Loc loc = ra->locs[v];
+    return loc.reg == REG_END ? opnd_mem(REG_RBP, loc.offset) : opnd_reg(loc.reg);
+}
+
+/// `mov dst, src`, through `rax` if both are in memory. Nothing if they're the same
+static void write_mov(Codegen *cg, Opnd dst, Opnd src) {
+    if (opnd_eq(dst, src)) {
+        return;
+    }
+
+    if (is_mem(dst) && is_mem(src)) {
+        asm_ins2(&cg->as, AI_MOV, RAX, src);
+        src = RAX;
+    }
+    asm_ins2(&cg->as, AI_MOV, dst, src);
+}
+
+/// Function state of the backend
+typedef struct {
+    Codegen *cg;
+    const IrFunc *fn;
+    const RegAlloc *ra;
+    /// Label number of the first block
+    int base;
+    /// Byte offset of the slot of each callee-saved register in use
+    int saved[REG_END];
+    /// Number of reads of each virtual register
+    uint32_t *n_uses;
+} Backend;
+
+static void write_saves(Backend *be, bool restore) {
+    for (Reg r = 0; r < REG_END; r++) {
+        if (be->ra->callee_saved & (1u << r)) {
+            Opnd slot = opnd_mem(REG_RBP, be->saved[r]);
+            if (restore) {
+                asm_ins2(&be->cg->as, AI_MOV, opnd_reg(r), slot);
+            } else {
+                asm_ins2(&be->cg->as, AI_MOV, slot, opnd_reg(r));
+            }
+        }
+    }
+}
+
+/// `dst = a op b` for `add`, `sub` and `imul`
+static void write_arith(Backend *be, AsmOp op, bool commutative, Opnd dst, Opnd a, Opnd b) {
+    Codegen *cg = be->cg;
+
+    if (!is_mem(dst) && opnd_eq(dst, b) && !opnd_eq(dst, a)) {
+        // `dst` already holds `b`
+        if (commutative) {
+            asm_ins2(&cg->as, op, dst, a);
+        } else {
+            // a - b = -b + a
+            asm_ins1(&cg->as, AI_NEG, dst);
+            asm_ins2(&cg->as, AI_ADD, dst, a);
+        }
+        return;
+    }
+
+    // `imul` can't write to memory
+    Opnd acc = is_mem(dst) ? RAX : dst;
+    write_mov(cg, acc, a);
+    asm_ins2(&cg->as, op, acc, b);
+    write_mov(cg, dst, acc);
+}
+
+/// `cmp a, b`, through `rax` if both are in memory
+static void write_cmp(Backend *be, Opnd a, Opnd b) {
+    if (is_mem(a) && is_mem(b)) {
+        write_mov(be->cg, RAX, a);
+        a = RAX;
+    }
+    asm_ins2(&be->cg->as, AI_CMP, a, b);
+}
+
+/// `jcc` to `then` of the `br`, and to `else_` otherwise, falling through to the block laid out
+/// next if it's either
+static void write_branch(Backend *be, AsmOp jcc, const IrIns *br, BlockId next) {
+    AsmBuf *as = &be->cg->as;
+
+    if (br->br.then == next) {
+        asm_ins1(as, asm_negate_jcc(jcc), opnd_label(".LB", be->base + br->br.else_));
+    } else {
+        asm_ins1(as, jcc, opnd_label(".LB", be->base + br->br.then));
+        if (br->br.else_ != next) {
+            asm_ins1(as, AI_JMP, opnd_label(".LB", be->base + br->br.else_));
+        }
+    }
+}
+
+/// True if the instruction is a comparison read only by the `br` right after it, which can then
+/// jump on the flags instead of the boolean
+static bool is_branch_cond(const Backend *be, const IrIns *ins, const IrIns *next) {
+    return ins->op >= IR_EQ && ins->op <= IR_GE && next->op == IR_BR && next->a == ins->dst &&
+           be->n_uses[ins->dst] == 1;
+}
+
+/// - `next`: block laid out right after this instruction's block, which is reached by falling
+///   through
+static void write_ins(Backend *be, const IrIns *ins, BlockId next) {
+    Codegen *cg = be->cg;
+    Opnd dst = ir_has_dst(ins->op) ? vreg_operand(be->ra, ins->dst) : RAX;
+
+    switch (ins->op) {
+    case IR_IMM:
+        // memory takes sign-extended 32-bit immediates only
+        if (is_mem(dst) && (ins->imm < INT32_MIN || ins->imm > INT32_MAX)) {
+            asm_ins2(&cg->as, AI_MOV, RAX, opnd_imm(ins->imm));
+            write_mov(cg, dst, RAX);
+        } else {
+            asm_ins2(&cg->as, AI_MOV, dst, opnd_imm(ins->imm));
+        }
+        return;
+
+    case IR_LOAD:
+        write_mov(cg, dst, opnd_mem(REG_RBP, ins->offset));
+        return;
+
+    case IR_STORE:
+        write_mov(cg, opnd_mem(REG_RBP, ins->offset), vreg_operand(be->ra, ins->a));
+        return;
+
+    case IR_COPY:
+        write_mov(cg, dst, vreg_operand(be->ra, ins->a));
+        return;
+
+    case IR_MULI: {
+        // `shl`, `lea` and `imul` can't write to memory
+        Opnd acc = is_mem(dst) ? RAX : dst;
+        write_mov(cg, acc, vreg_operand(be->ra, ins->a));
+        isel_mul_imm(&cg->as, acc.reg, ins->imm);
+        write_mov(cg, dst, acc);
+        return;
+    }
+
+    case IR_DIVI:
+        isel_div_imm(&cg->as, vreg_operand(be->ra, ins->a), ins->imm);
+        write_mov(cg, dst, RAX);
+        return;
+
+    case IR_CALL:
+        // values live across the call are in callee-saved registers or in memory
+        asm_ins1(&cg->as, AI_CALL, opnd_sym(ins->fname));
+        write_mov(cg, dst, RAX);
+        return;
+
+    case IR_JMP:
+        if (ins->br.then != next) {
+            asm_ins1(&cg->as, AI_JMP, opnd_label(".LB", be->base + ins->br.then));
+        }
+        return;
+
+    case IR_BR:
+        asm_ins2(&cg->as, AI_CMP, vreg_operand(be->ra, ins->a), opnd_imm(0));
+        write_branch(be, AI_JNE, ins, next);
+        return;
+
+    case IR_RET:
+        write_mov(cg, RAX, vreg_operand(be->ra, ins->a));
+        asm_comment(&cg->as, "return (embedded epilogue)");
+        write_saves(be, true);
+        write_epilogue(cg);
+        return;
+
+    default:
+        break;
+    }
+
+    Opnd a = vreg_operand(be->ra, ins->a);
+    Opnd b = vreg_operand(be->ra, ins->b);
+
+    switch (ins->op) {
+    case IR_ADD:
+        write_arith(be, AI_ADD, true, dst, a, b);
+        return;
+
+    case IR_SUB:
+        write_arith(be, AI_SUB, false, dst, a, b);
+        return;
+
+    case IR_MUL:
+        write_arith(be, AI_IMUL, true, dst, a, b);
+        return;
+
+    case IR_DIV:
+        write_mov(cg, RAX, a);
+        asm_ins0(&cg->as, AI_CQO);
+        asm_ins1(&cg->as, AI_IDIV, b);
+        write_mov(cg, dst, RAX);
+        return;
+
+    default:
+        // comparison operators
+        write_cmp(be, a, b);
+        // `IR_EQ`..`IR_GE` are in the same order as `AI_SETE`..`AI_SETGE`
+        asm_ins1(&cg->as, AI_SETE + (ins->op - IR_EQ), AL);
+        asm_ins2(&cg->as, AI_MOVZB, RAX, AL);
+        write_mov(cg, dst, RAX);
+        return;
+    }
+}
+
+void write_program_ir(Codegen *cg, const IrFunc *fn) {
+    RegAlloc ra = regalloc_run(fn);
+    Backend be = {.cg = cg, .fn = fn, .ra = &ra, .base = cg->seq};
+    cg->seq += fn->n_blocks;
+
+    be.n_uses = calloc(fn->n_vregs, sizeof(uint32_t));
+    if (!be.n_uses) {
+        panic("Out of memory (%u virtual registers)", fn->n_vregs);
+    }
+    for (BlockId b = 0; b < fn->n_blocks; b++) {
+        for (uint32_t i = 0; i < fn->blocks[b].len; i++) {
+            VReg uses[2];
+            int n = ir_uses(&fn->blocks[b].ins[i], uses);
+            for (int j = 0; j < n; j++) {
+                be.n_uses[uses[j]]++;
+            }
+        }
+    }
+
+    // the spill slots, then the slots of the callee-saved registers; `rsp` stays 16-byte aligned
+    // for calls
+    int size = ra.frame_size;
+    for (Reg r = 0; r < REG_END; r++) {
+        if (ra.callee_saved & (1u << r)) {
+            be.saved[r] = size;
+            size += 8;
+        }
+    }
+    size = (size + 15) / 16 * 16;
+
+    write_asm_header(cg);
+    write_prologue_sized(cg, size);
+    write_saves(&be, false);
+
+    for (BlockId b = 0; b < fn->n_blocks; b++) {
+        const IrBlock *block = &fn->blocks[b];
+
+        if (block->loop_header) {
+            asm_align_loop(&cg->as);
+        }
+        asm_label(&cg->as, ".LB", be.base + b);
+        for (uint32_t i = 0; i < block->len; i++) {
+            const IrIns *ins = &block->ins[i];
+
+            if (i + 1 < block->len && is_branch_cond(&be, ins, &block->ins[i + 1])) {
+                // `cmp` and `j<cc>`, ending the block
+                write_cmp(&be, vreg_operand(&ra, ins->a), vreg_operand(&ra, ins->b));
+                // `IR_EQ`..`IR_GE` are in the same order as `AI_JE`..`AI_JGE`
+                write_branch(&be, AI_JE + (ins->op - IR_EQ), &block->ins[i + 1], b + 1);
+                break;
+            }
+            write_ins(&be, ins, b + 1);
+        }
+    }
+
+    asm_flush(&cg->as);
+    free(be.n_uses);
+    regalloc_release(&ra);
+}
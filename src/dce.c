@@ -0,0 +1,500 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ast.h"
+#include "dce.h"
+#include "parse.h"
+#include "utils.h"
+
+Dce dce_init() {
+    return (Dce){.reachable = true};
+}
+
+void dce_release(Dce *d) {
+    free(d->live);
+    free(d->saved);
+    free(d->stmts);
+    ast_stack_release(&d->stack);
+    *d = dce_init();
+}
+
+static uint32_t slot_of(const AstNode *lvar) {
+    return lvar->offset / 8;
+}
+
+static bool is_live(const Dce *d, uint32_t slot) {
+    return d->live[slot / 64] >> (slot % 64) & 1;
+}
+
+static void gen(Dce *d, uint32_t slot) {
+    d->live[slot / 64] |= (uint64_t)1 << (slot % 64);
+}
+
+static void kill(Dce *d, uint32_t slot) {
+    d->live[slot / 64] &= ~((uint64_t)1 << (slot % 64));
+}
+
+/// Sizes `live` for the variables of the frame, with every one of them live or none
+static void reset_live(Dce *d, bool all) {
+    // variables appear one by one while streaming
+    uint32_t n_words = (uint32_t)d->ast->frame_size / 8 / 64 + 1;
+    if (n_words > d->n_words) {
+        d->live = realloc(d->live, n_words * sizeof(uint64_t));
+        if (!d->live) {
+            panic("Out of memory (%u words of live variables)", n_words);
+        }
+        d->n_words = n_words;
+    }
+
+    memset(d->live, all ? 0xff : 0, d->n_words * sizeof(uint64_t));
+}
+
+/// Pushes a copy of `live` to `saved` and returns where it starts
+static uint32_t save_live(Dce *d) {
+    if (d->saved_len + d->n_words > d->saved_cap) {
+        uint32_t cap = d->saved_cap ? d->saved_cap : 64;
+        while (cap < d->saved_len + d->n_words) {
+            cap *= 2;
+        }
+        d->saved = realloc(d->saved, cap * sizeof(uint64_t));
+        if (!d->saved) {
+            panic("Out of memory (%u words of live variables)", cap);
+        }
+        d->saved_cap = cap;
+    }
+
+    uint32_t at = d->saved_len;
+    memcpy(d->saved + at, d->live, d->n_words * sizeof(uint64_t));
+    d->saved_len += d->n_words;
+    return at;
+}
+
+static void restore_live(Dce *d, uint32_t at) {
+    memcpy(d->live, d->saved + at, d->n_words * sizeof(uint64_t));
+}
+
+static void push_stmt(Dce *d, NodeId id) {
+    if (d->stmts_len == d->stmts_cap) {
+        d->stmts_cap = d->stmts_cap ? d->stmts_cap * 2 : 64;
+        d->stmts = realloc(d->stmts, d->stmts_cap * sizeof(NodeId));
+        if (!d->stmts) {
+            panic("Out of memory (%u statements)", d->stmts_cap);
+        }
+    }
+    d->stmts[d->stmts_len++] = id;
+}
+
+/// Overwrites a node with another, keeping its place in the statement list. `NODE_NIL` empties it
+static void replace(Dce *d, NodeId id, NodeId with) {
+    AstNode *node = ast_get(d->ast, id);
+    NodeId next = node->next;
+
+    if (with == NODE_NIL) {
+        *node = (AstNode){.kind = ND_BLOCK, .body = NODE_NIL};
+    } else {
+        *node = *ast_get(d->ast, with);
+    }
+
+    node->next = next;
+    d->n_rewrites += 1;
+}
+
+static bool is_empty(const Ast *ast, NodeId id) {
+    const AstNode *node = ast_get(ast, id);
+    return node->kind == ND_BLOCK && node->body == NODE_NIL;
+}
+
+static bool is_binary(NodeKind kind) {
+    return kind >= ND_ADD && kind <= ND_GE;
+}
+
+/// True if the binary operator can be dropped once its operands are evaluated: anything but a
+/// division, which may trap, unless it's by a number other than 0 and -1
+static bool is_droppable_op(const Ast *ast, const AstNode *node) {
+    if (node->kind != ND_DIV) {
+        return is_binary(node->kind);
+    }
+    const AstNode *rhs = ast_get(ast, node->bin.rhs);
+    return rhs->kind == ND_NUM && rhs->val != 0 && rhs->val != -1;
+}
+
+/// True if the expression has no assignment, call or division that may trap
+static bool is_pure(Dce *d, NodeId id) {
+    AstStack *st = &d->stack;
+    uint32_t base = st->len;
+    ast_stack_push(st, id);
+
+    while (st->len > base) {
+        const AstNode *node = ast_get(d->ast, ast_stack_pop(st));
+
+        if (node->kind == ND_NUM || node->kind == ND_LVAR) {
+            continue;
+        }
+        if (!is_droppable_op(d->ast, node)) {
+            st->len = base;
+            return false;
+        }
+        ast_stack_push(st, node->bin.lhs);
+        ast_stack_push(st, node->bin.rhs);
+    }
+
+    return true;
+}
+
+/// True if the node stores to a variable that is never read afterwards
+static bool is_dead_store(const Dce *d, const AstNode *node) {
+    if (node->kind != ND_ASSIGN) {
+        return false;
+    }
+
+    // otherwise it's an error reported by the code generators
+    const AstNode *lhs = ast_get(d->ast, node->bin.lhs);
+    return lhs->kind == ND_LVAR && !is_live(d, slot_of(lhs));
+}
+
+// --------------------------------------------------------------------------------
+// Reachability
+
+static void prune_list(Dce *d, NodeId first);
+
+/// Drops the code that never runs in a statement. Returns `ast_falls_through`
+static bool prune_stmt(Dce *d, NodeId id) {
+    // NOTE: the pointer is invalidated only by `ast_push`, which this pass never calls
+    AstNode *node = ast_get(d->ast, id);
+    const AstNode *cond;
+
+    switch (node->kind) {
+    case ND_IF:
+        cond = ast_get(d->ast, node->branch.cond);
+        if (cond->kind == ND_NUM) {
+            // the other arm never runs
+            replace(d, id, cond->val ? node->branch.then : node->branch.else_);
+            return prune_stmt(d, id);
+        }
+
+        prune_stmt(d, node->branch.then);
+        if (node->branch.else_ != NODE_NIL) {
+            prune_stmt(d, node->branch.else_);
+        }
+        break;
+
+    case ND_WHILE:
+        cond = ast_get(d->ast, node->branch.cond);
+        if (cond->kind == ND_NUM && cond->val == 0) {
+            replace(d, id, NODE_NIL);
+            return true;
+        }
+        prune_stmt(d, node->branch.then);
+        break;
+
+    case ND_FOR:
+        cond = ast_get(d->ast, node->loop.cond);
+        if (cond->kind == ND_NUM && cond->val == 0) {
+            replace(d, id, node->loop.init);
+            return true;
+        }
+        prune_stmt(d, node->loop.then);
+        break;
+
+    case ND_BLOCK:
+        prune_list(d, node->body);
+        break;
+
+    default:
+        break;
+    }
+
+    return ast_falls_through(d->ast, id);
+}
+
+/// Cuts the statement list after the first statement that never completes
+static void prune_list(Dce *d, NodeId first) {
+    for (NodeId id = first; id != NODE_NIL; id = ast_get(d->ast, id)->next) {
+        if (prune_stmt(d, id)) {
+            continue;
+        }
+
+        AstNode *last = ast_get(d->ast, id);
+        for (NodeId n = last->next; n != NODE_NIL; n = ast_get(d->ast, n)->next) {
+            d->n_rewrites += 1;
+        }
+        last->next = NODE_NIL;
+        return;
+    }
+}
+
+// --------------------------------------------------------------------------------
+// Liveness
+
+/// `gen_reads` on an expression (or `return`)
+static void gen_reads_expr(Dce *d, NodeId id) {
+    AstStack *st = &d->stack;
+    uint32_t base = st->len;
+    ast_stack_push(st, id);
+
+    while (st->len > base) {
+        const AstNode *node = ast_get(d->ast, ast_stack_pop(st));
+
+        switch (node->kind) {
+        case ND_NUM:
+        case ND_CALL:
+            break;
+
+        case ND_LVAR:
+            gen(d, slot_of(node));
+            break;
+
+        case ND_ASSIGN:
+            ast_stack_push(st, node->bin.rhs);
+            break;
+
+        default:
+            ast_stack_push(st, node->bin.lhs);
+            if (node->bin.rhs != NODE_NIL) {
+                ast_stack_push(st, node->bin.rhs);
+            }
+            break;
+        }
+    }
+}
+
+/// Makes live every variable read anywhere in the node
+static void gen_reads(Dce *d, NodeId id) {
+    if (id == NODE_NIL) {
+        return;
+    }
+
+    const AstNode *node = ast_get(d->ast, id);
+
+    switch (node->kind) {
+    case ND_IF:
+    case ND_WHILE:
+        gen_reads(d, node->branch.cond);
+        gen_reads(d, node->branch.then);
+        gen_reads(d, node->branch.else_);
+        return;
+
+    case ND_FOR:
+        gen_reads(d, node->loop.init);
+        gen_reads(d, node->loop.cond);
+        gen_reads(d, node->loop.inc);
+        gen_reads(d, node->loop.then);
+        return;
+
+    case ND_BLOCK:
+        for (NodeId n = node->body; n != NODE_NIL; n = ast_get(d->ast, n)->next) {
+            gen_reads(d, n);
+        }
+        return;
+
+    default:
+        gen_reads_expr(d, id);
+        return;
+    }
+}
+
+/// Turns the stores to dead variables into their values and computes the live variables before
+/// the expression from the ones after it
+static void sweep_expr(Dce *d, NodeId id) {
+    AstStack *st = &d->stack;
+    uint32_t base = st->len;
+    ast_stack_push(st, id);
+
+    while (st->len > base) {
+        NodeId cur = ast_stack_pop(st);
+        const AstNode *node = ast_get(d->ast, cur);
+
+        switch (node->kind) {
+        case ND_NUM:
+        case ND_CALL:
+            break;
+
+        case ND_LVAR:
+            gen(d, slot_of(node));
+            break;
+
+        case ND_ASSIGN:
+            if (is_dead_store(d, node)) {
+                replace(d, cur, node->bin.rhs);
+                ast_stack_push(st, cur);
+                break;
+            }
+
+            kill(d, slot_of(ast_get(d->ast, node->bin.lhs)));
+            ast_stack_push(st, node->bin.rhs);
+            break;
+
+        default:
+            // the operands run from left to right, so the right one is popped, and swept, first
+            ast_stack_push(st, node->bin.lhs);
+            ast_stack_push(st, node->bin.rhs);
+            break;
+        }
+    }
+}
+
+/// `sweep_expr` on an expression whose value is discarded, which drops its parts without side
+/// effects. Returns false if nothing is left
+static bool sweep_discarded(Dce *d, NodeId id) {
+    for (;;) {
+        const AstNode *node = ast_get(d->ast, id);
+
+        if (is_dead_store(d, node)) {
+            replace(d, id, node->bin.rhs);
+        } else if (is_droppable_op(d->ast, node) && is_pure(d, node->bin.lhs)) {
+            replace(d, id, node->bin.rhs);
+        } else if (is_droppable_op(d->ast, node) && is_pure(d, node->bin.rhs)) {
+            replace(d, id, node->bin.lhs);
+        } else {
+            break;
+        }
+    }
+
+    if (is_pure(d, id)) {
+        return false;
+    }
+
+    sweep_expr(d, id);
+    return true;
+}
+
+static void sweep_list(Dce *d, NodeId *first);
+
+/// Removes the dead stores and the statements without effects, computing the live variables
+/// before the statement from the ones after it. A removed statement is emptied
+static void sweep_stmt(Dce *d, NodeId id) {
+    AstNode *node = ast_get(d->ast, id);
+
+    switch (node->kind) {
+    case ND_RETURN:
+        memset(d->live, 0, d->n_words * sizeof(uint64_t));
+        sweep_expr(d, node->bin.lhs);
+        return;
+
+    case ND_IF: {
+        uint32_t after = save_live(d);
+        sweep_stmt(d, node->branch.then);
+
+        if (node->branch.else_ != NODE_NIL) {
+            uint32_t then = save_live(d);
+            restore_live(d, after);
+            sweep_stmt(d, node->branch.else_);
+            for (uint32_t i = 0; i < d->n_words; i++) {
+                d->live[i] |= d->saved[then + i];
+            }
+        } else {
+            // the condition may be false
+            for (uint32_t i = 0; i < d->n_words; i++) {
+                d->live[i] |= d->saved[after + i];
+            }
+        }
+
+        d->saved_len = after;
+        sweep_expr(d, node->branch.cond);
+        return;
+    }
+
+    case ND_WHILE: {
+        // a variable read anywhere in the loop may be read in the next iteration, which keeps the
+        // walk linear instead of iterating to a fixed point
+        gen_reads(d, id);
+        uint32_t head = save_live(d);
+        sweep_stmt(d, node->branch.then);
+        restore_live(d, head);
+
+        d->saved_len = head;
+        sweep_expr(d, node->branch.cond);
+        return;
+    }
+
+    case ND_FOR: {
+        // same as `while`. The body and `inc` are each swept from the live variables at the
+        // condition, which include the ones after either of them
+        gen_reads(d, node->loop.cond);
+        gen_reads(d, node->loop.inc);
+        gen_reads(d, node->loop.then);
+        uint32_t head = save_live(d);
+        sweep_stmt(d, node->loop.then);
+        restore_live(d, head);
+        sweep_expr(d, node->loop.inc);
+        restore_live(d, head);
+
+        d->saved_len = head;
+        sweep_expr(d, node->loop.cond);
+        sweep_expr(d, node->loop.init);
+        return;
+    }
+
+    case ND_BLOCK:
+        sweep_list(d, &node->body);
+        return;
+
+    default:
+        // expression statement
+        if (!sweep_discarded(d, id)) {
+            replace(d, id, NODE_NIL);
+        }
+        return;
+    }
+}
+
+/// Sweeps the statements from the last one, then unlinks the emptied ones
+static void sweep_list(Dce *d, NodeId *first) {
+    uint32_t base = d->stmts_len;
+    for (NodeId n = *first; n != NODE_NIL; n = ast_get(d->ast, n)->next) {
+        push_stmt(d, n);
+    }
+
+    // NOTE: the nested lists push and pop their statements above ours
+    for (uint32_t i = d->stmts_len; i-- > base;) {
+        sweep_stmt(d, d->stmts[i]);
+    }
+
+    NodeId *link = first;
+    for (uint32_t i = base; i < d->stmts_len; i++) {
+        NodeId n = d->stmts[i];
+        if (!is_empty(d->ast, n)) {
+            *link = n;
+            link = &ast_get(d->ast, n)->next;
+        }
+    }
+    *link = NODE_NIL;
+
+    d->stmts_len = base;
+}
+
+// --------------------------------------------------------------------------------
+// Entry points
+
+uint64_t dce_stmt(Dce *d, Ast *ast, NodeId id) {
+    uint64_t n_before = d->n_rewrites;
+    d->ast = ast;
+
+    if (!d->reachable) {
+        // after a `return` at the top level
+        replace(d, id, NODE_NIL);
+        return d->n_rewrites - n_before;
+    }
+
+    d->reachable = prune_stmt(d, id);
+    reset_live(d, true);
+    sweep_stmt(d, id);
+
+    return d->n_rewrites - n_before;
+}
+
+uint64_t dce_program(Ast *ast) {
+    Dce d = dce_init();
+    d.ast = ast;
+
+    prune_list(&d, ast->head);
+    // nothing is read after the program
+    reset_live(&d, false);
+    sweep_list(&d, &ast->head);
+
+    uint64_t n = d.n_rewrites;
+    dce_release(&d);
+    return n;
+}
@@ -0,0 +1,55 @@
+//! Dead code elimination on the [`Ast`]
+//!
+//! Two walks over the statements. The first one follows the control flow forward and drops the code
+//! that never runs: the statements after a `return` or an endless loop, the arm of an `if` whose
+//! condition is a number and the loops whose condition is zero. The second one computes the live
+//! variables backward, in the reverse order the statements run, and drops the stores that are never
+//! read and then the expression statements without side effects (`3 + 4;`).
+//!
+//! Constant propagation leaves the stores of the values it replaced behind, for this pass to remove.
+
+#ifndef CINC_DCE_H
+#define CINC_DCE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ast.h"
+
+typedef struct {
+    Ast *ast;
+
+    /// Variables that may be read before they are assigned, by stack slot (`offset / 8`)
+    uint64_t *live;
+    uint32_t n_words;
+
+    /// Copies of `live` to restore after a branch, as a stack
+    uint64_t *saved;
+    uint32_t saved_len;
+    uint32_t saved_cap;
+
+    /// Statements of the blocks being swept, as a stack
+    NodeId *stmts;
+    uint32_t stmts_len;
+    uint32_t stmts_cap;
+
+    /// Walks over the expressions
+    AstStack stack;
+
+    /// False after a top-level statement that never completes (streaming)
+    bool reachable;
+    /// Statements, operands and stores removed
+    uint64_t n_rewrites;
+} Dce;
+
+Dce dce_init();
+void dce_release(Dce *d);
+
+/// Eliminates the dead code of a top-level statement, after the ones given before it (streaming).
+/// Every variable is live after the statement, since the ones that follow are unknown yet. Returns
+/// the number of rewrites
+uint64_t dce_stmt(Dce *d, Ast *ast, NodeId id);
+/// Eliminates the dead code of the program. Returns the number of rewrites
+uint64_t dce_program(Ast *ast);
+
+#endif
@@ -0,0 +1,158 @@
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "emit.h"
+#include "utils.h"
+
+/// Byte size of the buffer of a flushing emitter
+#define EMIT_BUF_SIZE (1 << 20)
+
+/// Upper bound of the bytes of a formatted integer plus a short suffix
+#define INT_LINE_MAX 128
+
+static Emitter emitter_new(int fd) {
+    Emitter e = {
+        .buf = malloc(EMIT_BUF_SIZE),
+        .len = 0,
+        .cap = EMIT_BUF_SIZE,
+        .fd = fd,
+        .n_bytes = 0,
+    };
+
+    if (!e.buf) {
+        panic("Out of memory (output buffer)");
+    }
+
+    return e;
+}
+
+Emitter emitter_to_fd(int fd) {
+    return emitter_new(fd);
+}
+
+Emitter emitter_to_memory() {
+    return emitter_new(-1);
+}
+
+void emitter_release(Emitter *e) {
+    free(e->buf);
+    e->buf = NULL;
+    e->len = 0;
+    e->cap = 0;
+}
+
+void emitter_clear(Emitter *e) {
+    e->len = 0;
+    e->n_bytes = 0;
+}
+
+static void write_all(int fd, const char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            panic("Failed to write the output: %s", strerror(errno));
+        }
+        buf += n;
+        len -= n;
+    }
+}
+
+void emit_flush(Emitter *e) {
+    if (e->fd < 0) {
+        return;
+    }
+
+    write_all(e->fd, e->buf, e->len);
+    e->len = 0;
+}
+
+void emitter_write_to(Emitter *e, int fd) {
+    write_all(fd, e->buf, e->len);
+}
+
+/// Makes room for `n` more bytes
+static void reserve(Emitter *e, size_t n) {
+    if (e->cap - e->len >= n) {
+        return;
+    }
+
+    if (e->fd >= 0) {
+        emit_flush(e);
+        if (e->cap >= n) {
+            return;
+        }
+    }
+
+    while (e->cap - e->len < n) {
+        e->cap *= 2;
+    }
+    e->buf = realloc(e->buf, e->cap);
+    if (!e->buf) {
+        panic("Out of memory (output buffer of %zu bytes)", e->cap);
+    }
+}
+
+/// Appends without reserving
+static void put(Emitter *e, const char *s, size_t len) {
+    memcpy(e->buf + e->len, s, len);
+    e->len += len;
+    e->n_bytes += len;
+}
+
+static void put_str(Emitter *e, const char *s) {
+    put(e, s, strlen(s));
+}
+
+size_t format_int(char *buf, long v) {
+    char digits[FORMAT_INT_MAX];
+    int n = 0;
+
+    // negate in unsigned, so that `LONG_MIN` works
+    unsigned long u = v < 0 ? 0ul - (unsigned long)v : (unsigned long)v;
+    do {
+        digits[n++] = '0' + u % 10;
+        u /= 10;
+    } while (u);
+
+    size_t len = 0;
+    if (v < 0) {
+        buf[len++] = '-';
+    }
+    while (n > 0) {
+        buf[len++] = digits[--n];
+    }
+    return len;
+}
+
+static void put_int(Emitter *e, long v) {
+    size_t n = format_int(e->buf + e->len, v);
+    e->len += n;
+    e->n_bytes += n;
+}
+
+void emit_bytes(Emitter *e, const char *s, size_t len) {
+    reserve(e, len);
+    put(e, s, len);
+}
+
+char *emit_reserve(Emitter *e, size_t n) {
+    reserve(e, n);
+    return e->buf + e->len;
+}
+
+void emit_commit(Emitter *e, size_t n) {
+    e->len += n;
+    e->n_bytes += n;
+}
+
+void emit_with_int(Emitter *e, const char *prefix, size_t len, long v, const char *suffix) {
+    reserve(e, len + INT_LINE_MAX);
+    put(e, prefix, len);
+    put_int(e, v);
+    put_str(e, suffix);
+}
@@ -0,0 +1,61 @@
+//! Buffered writer of assembly text
+//!
+//! Unlike `printf`, no format string is parsed: constant text is appended with `memcpy` and integers
+//! are formatted by hand. The buffer is flushed with `write(2)`.
+
+#ifndef CINC_EMIT_H
+#define CINC_EMIT_H
+
+#include <stddef.h>
+
+typedef struct {
+    char *buf;
+    size_t len;
+    size_t cap;
+    /// File descriptor to flush to, or -1 to keep everything in memory
+    int fd;
+    /// Total bytes emitted, including the flushed ones
+    size_t n_bytes;
+} Emitter;
+
+/// Emitter flushing to a file descriptor whenever the buffer is full
+Emitter emitter_to_fd(int fd);
+/// Emitter keeping the whole output in a growing buffer (see `emitter_write_to`)
+Emitter emitter_to_memory();
+void emitter_release(Emitter *e);
+/// Drops the output, keeping the buffer
+void emitter_clear(Emitter *e);
+/// Writes out the buffered output (no-op in memory)
+void emit_flush(Emitter *e);
+/// Writes the whole in-memory output to a file descriptor at once
+void emitter_write_to(Emitter *e, int fd);
+
+void emit_bytes(Emitter *e, const char *s, size_t len);
+/// Makes room for `n` bytes and returns where to write them, which `emit_commit` appends
+char *emit_reserve(Emitter *e, size_t n);
+void emit_commit(Emitter *e, size_t n);
+/// `<prefix><v><suffix>`
+void emit_with_int(Emitter *e, const char *prefix, size_t len, long v, const char *suffix);
+
+/// Upper bound of the bytes `format_int` writes
+#define FORMAT_INT_MAX 24
+/// Writes `v` in decimal to `buf` and returns the number of bytes, at most `FORMAT_INT_MAX`
+size_t format_int(char *buf, long v);
+
+// Instructions are mostly constant, so the macros below concatenate the literals at compile time
+// and only integers are formatted at run time
+
+/// Appends a string literal
+#define EMIT_STR(e, lit) emit_bytes((e), lit, sizeof(lit) - 1)
+/// `<prefix><v>`, a line ending with an integer
+#define EMIT_LINE_INT(e, prefix, v) emit_with_int((e), prefix, sizeof(prefix) - 1, (v), "\n")
+
+/// `  # text`
+#define EMIT_COMMENT(e, text) EMIT_STR(e, "  # " text "\n")
+
+/// `    ins`, e.g. `EMIT_INS(e, "pop rax")`
+#define EMIT_INS(e, ins) EMIT_STR(e, "    " ins "\n")
+/// `    ins<v>`, e.g. `EMIT_INS_INT(e, "push ", 42)` or `EMIT_INS_INT(e, "je .Lelse", seq)`
+#define EMIT_INS_INT(e, ins, v) EMIT_LINE_INT(e, "    " ins, v)
+
+#endif
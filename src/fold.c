@@ -0,0 +1,393 @@
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ast.h"
+#include "fold.h"
+#include "parse.h"
+
+typedef struct {
+    Ast *ast;
+    AstStack stack;
+    /// Number of rewrites so far
+    uint64_t n_rewrites;
+} Folder;
+
+static bool is_binary(NodeKind kind) {
+    return kind >= ND_ADD && kind <= ND_GE;
+}
+
+static bool fits_int(long v) {
+    return v >= INT_MIN && v <= INT_MAX;
+}
+
+bool fold_eval(NodeKind kind, long lhs, long rhs, long *val) {
+    switch (kind) {
+    case ND_ADD:
+        return !__builtin_add_overflow(lhs, rhs, val);
+    case ND_SUB:
+        return !__builtin_sub_overflow(lhs, rhs, val);
+    case ND_MUL:
+        return !__builtin_mul_overflow(lhs, rhs, val);
+    case ND_DIV:
+        if (rhs == 0 || (lhs == LONG_MIN && rhs == -1)) {
+            return false;
+        }
+        *val = lhs / rhs;
+        return true;
+    case ND_EQ:
+        *val = lhs == rhs;
+        return true;
+    case ND_NE:
+        *val = lhs != rhs;
+        return true;
+    case ND_LT:
+        *val = lhs < rhs;
+        return true;
+    case ND_LE:
+        *val = lhs <= rhs;
+        return true;
+    case ND_GT:
+        *val = lhs > rhs;
+        return true;
+    case ND_GE:
+        *val = lhs >= rhs;
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// True if the expression can be dropped or evaluated twice: it has no assignment or call, and no
+/// division, which may trap
+static bool is_pure(Folder *f, NodeId id) {
+    AstStack *st = &f->stack;
+    uint32_t base = st->len;
+    ast_stack_push(st, id);
+
+    while (st->len > base) {
+        const AstNode *node = ast_get(f->ast, ast_stack_pop(st));
+
+        if (node->kind == ND_NUM || node->kind == ND_LVAR) {
+            continue;
+        }
+        if (!is_binary(node->kind) || node->kind == ND_DIV) {
+            st->len = base;
+            return false;
+        }
+        ast_stack_push(st, node->bin.lhs);
+        ast_stack_push(st, node->bin.rhs);
+    }
+
+    return true;
+}
+
+/// Pushes `x` with the node to compare it with, `y`
+static void push_pair(AstStack *st, NodeId x, NodeId y) {
+    ast_stack_push(st, x);
+    ast_stack_top(st)->val = y;
+}
+
+/// True if the two expressions are the same tree
+static bool is_same(Folder *f, NodeId x, NodeId y) {
+    AstStack *st = &f->stack;
+    uint32_t base = st->len;
+    push_pair(st, x, y);
+
+    while (st->len > base) {
+        AstFrame pair = st->frames[--st->len];
+        const AstNode *a = ast_get(f->ast, pair.id);
+        const AstNode *b = ast_get(f->ast, (NodeId)pair.val);
+
+        bool same;
+        switch (a->kind) {
+        case ND_NUM:
+            same = b->kind == ND_NUM && a->val == b->val;
+            break;
+        case ND_LVAR:
+            same = b->kind == ND_LVAR && a->offset == b->offset;
+            break;
+        default:
+            same = is_binary(a->kind) && a->kind == b->kind;
+            if (same) {
+                push_pair(st, a->bin.lhs, b->bin.lhs);
+                push_pair(st, a->bin.rhs, b->bin.rhs);
+            }
+            break;
+        }
+
+        if (!same) {
+            st->len = base;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool is_num(const Ast *ast, NodeId id, int val) {
+    const AstNode *node = ast_get(ast, id);
+    return node->kind == ND_NUM && node->val == val;
+}
+
+/// True if the node is `<op>(x, <number>)`
+static bool has_num_rhs(const Ast *ast, NodeId id, NodeKind op) {
+    const AstNode *node = ast_get(ast, id);
+    return node->kind == op && ast_get(ast, node->bin.rhs)->kind == ND_NUM;
+}
+
+static void set_num(Folder *f, NodeId id, long val) {
+    AstNode *node = ast_get(f->ast, id);
+    node->kind = ND_NUM;
+    node->val = val;
+    f->n_rewrites += 1;
+}
+
+/// Overwrites the node with its child `child`, keeping its place in the statement list
+static void replace(Folder *f, NodeId id, NodeId child) {
+    AstNode *node = ast_get(f->ast, id);
+    NodeId next = node->next;
+    *node = *ast_get(f->ast, child);
+    node->next = next;
+    f->n_rewrites += 1;
+}
+
+/// Sets the children of a binary node
+static void set_bin(AstNode *node, NodeKind kind, NodeId lhs, NodeId rhs) {
+    node->kind = kind;
+    node->bin.lhs = lhs;
+    node->bin.rhs = rhs;
+}
+
+static void simplify(Folder *f, NodeId id);
+
+/// Moves the constant of a child up to the node, which is `+` or `*` (`op`) with the rest
+/// simplified:
+///
+/// - `(x op c1) op c2` -> `x op (c1 op c2)`
+/// - `(x op c) op y` -> `(x op y) op c`
+/// - `x op (y op c)` -> `(x op y) op c`
+///
+/// Both operators wrap around in 64 bits, so the rewrites keep the value. The operands are still
+/// evaluated from left to right. Returns false if none applies
+static bool reassociate(Folder *f, NodeId id, NodeKind op) {
+    Ast *ast = f->ast;
+    AstNode *node = ast_get(ast, id);
+    NodeId lhs = node->bin.lhs;
+    NodeId rhs = node->bin.rhs;
+
+    if (has_num_rhs(ast, lhs, op) && ast_get(ast, rhs)->kind == ND_NUM) {
+        AstNode *inner = ast_get(ast, lhs);
+        AstNode *c = ast_get(ast, inner->bin.rhs);
+        long val;
+        if (!fold_eval(op, c->val, ast_get(ast, rhs)->val, &val) || !fits_int(val)) {
+            return false;
+        }
+
+        c->val = val;
+        node->bin.rhs = inner->bin.rhs;
+        node->bin.lhs = inner->bin.lhs;
+        f->n_rewrites += 1;
+        simplify(f, id);
+        return true;
+    }
+
+    if (has_num_rhs(ast, lhs, op) && ast_get(ast, rhs)->kind != ND_NUM) {
+        AstNode *inner = ast_get(ast, lhs);
+        NodeId c = inner->bin.rhs;
+        set_bin(inner, op, inner->bin.lhs, rhs);
+        set_bin(node, op, lhs, c);
+        f->n_rewrites += 1;
+        simplify(f, lhs);
+        simplify(f, id);
+        return true;
+    }
+
+    if (has_num_rhs(ast, rhs, op)) {
+        AstNode *inner = ast_get(ast, rhs);
+        NodeId c = inner->bin.rhs;
+        set_bin(inner, op, lhs, inner->bin.lhs);
+        set_bin(node, op, rhs, c);
+        f->n_rewrites += 1;
+        simplify(f, rhs);
+        simplify(f, id);
+        return true;
+    }
+
+    return false;
+}
+
+/// Simplifies a binary node whose children are simplified already
+static void simplify(Folder *f, NodeId id) {
+    Ast *ast = f->ast;
+    AstNode *node = ast_get(ast, id);
+    if (!is_binary(node->kind)) {
+        return;
+    }
+
+    NodeId lhs = node->bin.lhs;
+    NodeId rhs = node->bin.rhs;
+    AstNode *l = ast_get(ast, lhs);
+    AstNode *r = ast_get(ast, rhs);
+
+    if (l->kind == ND_NUM && r->kind == ND_NUM) {
+        long val;
+        if (fold_eval(node->kind, l->val, r->val, &val) && fits_int(val)) {
+            set_num(f, id, val);
+        }
+        return;
+    }
+
+    // a constant operand goes to the right: `2 * x` -> `x * 2`
+    if ((node->kind == ND_ADD || node->kind == ND_MUL) && l->kind == ND_NUM) {
+        set_bin(node, node->kind, rhs, lhs);
+        simplify(f, id);
+        return;
+    }
+
+    switch (node->kind) {
+    case ND_ADD:
+        if (is_num(ast, rhs, 0)) {
+            replace(f, id, lhs);
+            return;
+        }
+        reassociate(f, id, ND_ADD);
+        return;
+
+    case ND_SUB:
+        if (r->kind == ND_NUM && r->val != INT_MIN) {
+            // `x - c` -> `x + -c`, so that the constant can be reassociated
+            r->val = -r->val;
+            node->kind = ND_ADD;
+            simplify(f, id);
+            return;
+        }
+        if (is_num(ast, lhs, 0) && r->kind == ND_SUB && is_num(ast, r->bin.lhs, 0)) {
+            // `0 - (0 - x)`, or `- -x`
+            replace(f, id, r->bin.rhs);
+            return;
+        }
+        if (is_same(f, lhs, rhs) && is_pure(f, lhs)) {
+            set_num(f, id, 0);
+            return;
+        }
+        if (has_num_rhs(ast, lhs, ND_ADD)) {
+            // `(x + c) - y` -> `(x - y) + c`
+            NodeId c = l->bin.rhs;
+            set_bin(l, ND_SUB, l->bin.lhs, rhs);
+            set_bin(node, ND_ADD, lhs, c);
+            f->n_rewrites += 1;
+            simplify(f, lhs);
+            simplify(f, id);
+            return;
+        }
+        if (has_num_rhs(ast, rhs, ND_ADD) && ast_get(ast, r->bin.rhs)->val != INT_MIN) {
+            // `x - (y + c)` -> `(x - y) + -c`
+            NodeId c = r->bin.rhs;
+            ast_get(ast, c)->val = -ast_get(ast, c)->val;
+            set_bin(r, ND_SUB, lhs, r->bin.lhs);
+            set_bin(node, ND_ADD, rhs, c);
+            f->n_rewrites += 1;
+            simplify(f, rhs);
+            simplify(f, id);
+        }
+        return;
+
+    case ND_MUL:
+        if (is_num(ast, rhs, 1)) {
+            replace(f, id, lhs);
+            return;
+        }
+        if (is_num(ast, rhs, 0) && is_pure(f, lhs)) {
+            set_num(f, id, 0);
+            return;
+        }
+        reassociate(f, id, ND_MUL);
+        return;
+
+    case ND_DIV:
+        if (is_num(ast, rhs, 1)) {
+            replace(f, id, lhs);
+        }
+        return;
+
+    default:
+        return;
+    }
+}
+
+/// Folds an expression (or `return`) from the leaves up
+static void fold_expr(Folder *f, NodeId id) {
+    AstStack *st = &f->stack;
+    uint32_t base = st->len;
+    ast_stack_push(st, id);
+
+    while (st->len > base) {
+        AstFrame *top = ast_stack_top(st);
+        const AstNode *node = ast_get(f->ast, top->id);
+        bool leaf = node->kind == ND_NUM || node->kind == ND_LVAR || node->kind == ND_CALL;
+
+        if (top->state == 0 && !leaf) {
+            top->state = 1;
+            // the left operand is popped, and so folded, first
+            if (node->bin.rhs != NODE_NIL) {
+                ast_stack_push(st, node->bin.rhs);
+            }
+            ast_stack_push(st, node->bin.lhs);
+            continue;
+        }
+
+        simplify(f, ast_stack_pop(st));
+    }
+}
+
+static void fold_any(Folder *f, NodeId id) {
+    if (id == NODE_NIL) {
+        return;
+    }
+
+    // NOTE: the pointer is invalidated only by `ast_push`, which folding never calls
+    AstNode *node = ast_get(f->ast, id);
+
+    switch (node->kind) {
+    case ND_IF:
+    case ND_WHILE:
+        fold_any(f, node->branch.cond);
+        fold_any(f, node->branch.then);
+        fold_any(f, node->branch.else_);
+        return;
+
+    case ND_FOR:
+        fold_any(f, node->loop.init);
+        fold_any(f, node->loop.cond);
+        fold_any(f, node->loop.inc);
+        fold_any(f, node->loop.then);
+        return;
+
+    case ND_BLOCK:
+        for (NodeId n = node->body; n != NODE_NIL; n = ast_get(f->ast, n)->next) {
+            fold_any(f, n);
+        }
+        return;
+
+    default:
+        fold_expr(f, id);
+        return;
+    }
+}
+
+uint64_t fold_stmt(Ast *ast, NodeId id) {
+    Folder f = {.ast = ast, .stack = ast_stack_init(), .n_rewrites = 0};
+    fold_any(&f, id);
+    ast_stack_release(&f.stack);
+    return f.n_rewrites;
+}
+
+uint64_t fold_program(Ast *ast) {
+    Folder f = {.ast = ast, .stack = ast_stack_init(), .n_rewrites = 0};
+    for (NodeId id = ast->head; id != NODE_NIL; id = ast_get(ast, id)->next) {
+        fold_any(&f, id);
+    }
+    ast_stack_release(&f.stack);
+    return f.n_rewrites;
+}
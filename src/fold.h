@@ -0,0 +1,27 @@
+//! Constant folding and algebraic simplification on the [`Ast`]
+//!
+//! Runs between the parser and the code generators. Expressions are rewritten bottom-up in place: a
+//! node is overwritten with a number or with one of its children, or its children are rearranged,
+//! so no node is allocated and the `NodeId`s held by the parents stay valid.
+//!
+//! The generated code computes in 64 bits while `AstNode.val` holds 32 bits, so a constant is
+//! folded only if it fits. Division by zero is left to the run time.
+
+#ifndef CINC_FOLD_H
+#define CINC_FOLD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ast.h"
+#include "parse.h"
+
+/// Simplifies every statement of the program. Returns the number of rewrites
+uint64_t fold_program(Ast *ast);
+/// Simplifies one statement (streaming). Returns the number of rewrites
+uint64_t fold_stmt(Ast *ast, NodeId id);
+
+/// Computes `lhs op rhs` as the generated code does, in 64 bits. False if it would trap
+bool fold_eval(NodeKind kind, long lhs, long rhs, long *val);
+
+#endif
@@ -0,0 +1,120 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "intern.h"
+#include "utils.h"
+
+/// Number of slots of a new table
+#define INITIAL_SLOTS 1024
+
+Interner interner_init() {
+    Interner names = {
+        .slots = calloc(INITIAL_SLOTS, sizeof(uint32_t)),
+        .n_slots = INITIAL_SLOTS,
+        .names = NULL,
+        .hashes = NULL,
+        .len = 0,
+        .cap = 0,
+        .chars = arena_init(1 << 16),
+    };
+
+    if (!names.slots) {
+        panic("Out of memory (string table)");
+    }
+
+    return names;
+}
+
+void interner_release(Interner *names) {
+    free(names->slots);
+    free(names->names);
+    free(names->hashes);
+    arena_release(&names->chars);
+}
+
+void interner_clear(Interner *names) {
+    memset(names->slots, 0, names->n_slots * sizeof(uint32_t));
+    names->len = 0;
+    arena_reset(&names->chars);
+}
+
+/// FNV-1a
+static uint32_t hash_str(char *str, int len) {
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h = (h ^ (unsigned char)str[i]) * 16777619u;
+    }
+    return h;
+}
+
+/// Doubles the number of slots and reinserts the IDs
+static void grow_slots(Interner *names) {
+    uint32_t n_slots = names->n_slots * 2;
+    uint32_t *slots = calloc(n_slots, sizeof(uint32_t));
+    if (!slots) {
+        panic("Out of memory (string table of %u slots)", n_slots);
+    }
+
+    for (SymId id = 0; id < names->len; id++) {
+        uint32_t i = names->hashes[id] & (n_slots - 1);
+        while (slots[i]) {
+            i = (i + 1) & (n_slots - 1);
+        }
+        slots[i] = id + 1;
+    }
+
+    free(names->slots);
+    names->slots = slots;
+    names->n_slots = n_slots;
+}
+
+static SymId push_name(Interner *names, char *str, int len, uint32_t hash) {
+    if (names->len == names->cap) {
+        names->cap = names->cap ? names->cap * 2 : 256;
+        names->names = realloc(names->names, names->cap * sizeof(Slice));
+        names->hashes = realloc(names->hashes, names->cap * sizeof(uint32_t));
+        if (!names->names || !names->hashes) {
+            panic("Out of memory (%u identifiers)", names->cap);
+        }
+    }
+
+    // copied, so that names outlive the source
+    char *copy = arena_alloc(&names->chars, len + 1);
+    memcpy(copy, str, len);
+
+    SymId id = names->len++;
+    names->names[id] = (Slice){.str = copy, .len = len};
+    names->hashes[id] = hash;
+    return id;
+}
+
+SymId intern(Interner *names, char *str, int len) {
+    uint32_t hash = hash_str(str, len);
+    uint32_t mask = names->n_slots - 1;
+
+    // linear probing
+    uint32_t i = hash & mask;
+    while (names->slots[i]) {
+        SymId id = names->slots[i] - 1;
+        if (names->hashes[id] == hash && slice_eq(names->names[id], (Slice){str, len})) {
+            return id;
+        }
+        i = (i + 1) & mask;
+    }
+
+    SymId id = push_name(names, str, len, hash);
+    names->slots[i] = id + 1;
+
+    // keep the load factor under 1/2
+    if (names->len * 2 > names->n_slots) {
+        grow_slots(names);
+    }
+
+    return id;
+}
+
+Slice interner_name(const Interner *names, SymId id) {
+    return names->names[id];
+}
@@ -0,0 +1,40 @@
+//! String table of identifiers
+
+#ifndef CINC_INTERN_H
+#define CINC_INTERN_H
+
+#include <stdint.h>
+
+#include "utils.h"
+
+/// Stable ID of an interned identifier. Two identifiers are equal iff their IDs are equal
+typedef uint32_t SymId;
+
+/// Interns identifiers so that each distinct spelling is stored once
+typedef struct {
+    /// Open-addressing hash table of `SymId + 1`; zero is an empty slot
+    uint32_t *slots;
+    /// Number of slots, always a power of two
+    uint32_t n_slots;
+
+    /// Spelling of each ID, copied into `chars`
+    Slice *names;
+    /// Hash of each ID, kept for rehashing
+    uint32_t *hashes;
+    /// Number of IDs
+    uint32_t len;
+    uint32_t cap;
+
+    Arena chars;
+} Interner;
+
+Interner interner_init();
+void interner_release(Interner *names);
+/// Forgets every identifier, keeping the buffers
+void interner_clear(Interner *names);
+/// Returns the ID of a spelling, adding it to the table if it's new
+SymId intern(Interner *names, char *str, int len);
+/// Returns the spelling of an ID
+Slice interner_name(const Interner *names, SymId id);
+
+#endif
@@ -0,0 +1,787 @@
+// `vsnprintf`
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ast.h"
+#include "emit.h"
+#include "ir.h"
+#include "parse.h"
+#include "utils.h"
+
+static const char *IR_OP_NAMES[IR_OP_END] = {
+    [IR_IMM] = "imm",   [IR_LOAD] = "load", [IR_STORE] = "store", [IR_CALL] = "call",
+    [IR_COPY] = "copy", [IR_ADD] = "add",   [IR_SUB] = "sub",     [IR_MUL] = "mul",
+    [IR_DIV] = "div",   [IR_EQ] = "eq",     [IR_NE] = "ne",       [IR_LT] = "lt",
+    [IR_LE] = "le",     [IR_GT] = "gt",     [IR_GE] = "ge",       [IR_MULI] = "muli",
+    [IR_DIVI] = "divi", [IR_JMP] = "jmp",   [IR_BR] = "br",       [IR_RET] = "ret",
+};
+
+static void *grow(void *ptr, uint32_t *cap, size_t elem_size, const char *what) {
+    *cap = *cap ? *cap * 2 : 8;
+    ptr = realloc(ptr, *cap * elem_size);
+    if (!ptr) {
+        panic("Out of memory (%u %s)", *cap, what);
+    }
+    return ptr;
+}
+
+static void block_push(IrBlock *block, IrIns ins) {
+    if (block->len == block->cap) {
+        block->ins = grow(block->ins, &block->cap, sizeof(IrIns), "IR instructions");
+    }
+    block->ins[block->len++] = ins;
+}
+
+void ir_release(IrFunc *fn) {
+    for (uint32_t i = 0; i < fn->n_blocks; i++) {
+        free(fn->blocks[i].ins);
+        free(fn->blocks[i].preds);
+    }
+    free(fn->blocks);
+    *fn = (IrFunc){0};
+}
+
+// --------------------------------------------------------------------------------
+// Lowering
+
+typedef struct {
+    const Ast *ast;
+    IrFunc *fn;
+    Diag *diag;
+    /// Block being filled
+    BlockId cur;
+    /// True if `cur` already ends with a terminator
+    bool terminated;
+    /// Order in which each block was started, which becomes its final `BlockId`
+    uint32_t *start;
+    uint32_t start_cap;
+    uint32_t n_started;
+    /// Walks over the expressions
+    AstStack stack;
+} Lowering;
+
+/// Creates a block to be started later, so that it can be jumped to in advance
+static BlockId new_block(Lowering *lw) {
+    IrFunc *fn = lw->fn;
+    if (fn->n_blocks == fn->cap) {
+        fn->blocks = grow(fn->blocks, &fn->cap, sizeof(IrBlock), "IR blocks");
+    }
+    if (fn->n_blocks == lw->start_cap) {
+        lw->start = grow(lw->start, &lw->start_cap, sizeof(uint32_t), "IR blocks");
+    }
+
+    fn->blocks[fn->n_blocks] = (IrBlock){0};
+    lw->start[fn->n_blocks] = UINT32_MAX;
+    return fn->n_blocks++;
+}
+
+static BlockId new_loop_body(Lowering *lw) {
+    BlockId b = new_block(lw);
+    lw->fn->blocks[b].loop_header = true;
+    return b;
+}
+
+/// Makes the block the one being filled. The previous block must have been terminated
+static void start_block(Lowering *lw, BlockId b) {
+    lw->start[b] = lw->n_started++;
+    lw->cur = b;
+    lw->terminated = false;
+}
+
+static void push(Lowering *lw, IrIns ins) {
+    // code after a terminator is unreachable, but it still needs a block
+    if (lw->terminated) {
+        start_block(lw, new_block(lw));
+    }
+
+    block_push(&lw->fn->blocks[lw->cur], ins);
+    lw->terminated = ins.op == IR_JMP || ins.op == IR_BR || ins.op == IR_RET;
+}
+
+static VReg new_vreg(Lowering *lw) {
+    return lw->fn->n_vregs++;
+}
+
+static void push_jmp(Lowering *lw, BlockId to) {
+    // the jump at the end of a branch that returns would never run
+    if (!lw->terminated) {
+        push(lw, (IrIns){.op = IR_JMP, .br = {.then = to}});
+    }
+}
+
+static void push_br(Lowering *lw, VReg cond, BlockId then, BlockId else_) {
+    push(lw, (IrIns){.op = IR_BR, .a = cond, .br = {.then = then, .else_ = else_}});
+}
+
+static IrOp binary_op(NodeKind kind) {
+    switch (kind) {
+    case ND_ADD:
+        return IR_ADD;
+    case ND_SUB:
+        return IR_SUB;
+    case ND_MUL:
+        return IR_MUL;
+    case ND_DIV:
+        return IR_DIV;
+    case ND_EQ:
+        return IR_EQ;
+    case ND_NE:
+        return IR_NE;
+    case ND_LT:
+        return IR_LT;
+    case ND_LE:
+        return IR_LE;
+    case ND_GT:
+        return IR_GT;
+    case ND_GE:
+        return IR_GE;
+    default:
+        panic("Tried to lower a binary node, found non-operator (NodeKind: %d)", kind);
+    }
+}
+
+/// The operand `x` of `x * c` or `x / c` with `c` a number, which becomes `muli` or `divi`, or
+/// `NODE_NIL`. A number has no side effects to order, and division by zero traps with `div`
+static NodeId imm_operand(const Ast *ast, const AstNode *node) {
+    const AstNode *lhs = ast_get(ast, node->bin.lhs);
+    const AstNode *rhs = ast_get(ast, node->bin.rhs);
+
+    if (node->kind == ND_MUL && (rhs->kind == ND_NUM || lhs->kind == ND_NUM)) {
+        return rhs->kind != ND_NUM ? node->bin.rhs : node->bin.lhs;
+    }
+    if (node->kind == ND_DIV && rhs->kind == ND_NUM && rhs->val != 0) {
+        return node->bin.lhs;
+    }
+    return NODE_NIL;
+}
+
+/// Lowers an expression without recursion, since it may nest deeper than the C stack allows.
+/// Returns the register of its value
+static VReg lower_expr(Lowering *lw, NodeId id) {
+    AstStack *st = &lw->stack;
+    uint32_t base = st->len;
+    ast_stack_push(st, id);
+    // register of the last node done, which is an operand of the node on top
+    VReg last = 0;
+
+    while (st->len > base) {
+        AstFrame *top = ast_stack_top(st);
+        const AstNode *node = ast_get(lw->ast, top->id);
+
+        switch (node->kind) {
+        case ND_NUM:
+            last = new_vreg(lw);
+            push(lw, (IrIns){.op = IR_IMM, .dst = last, .imm = node->val});
+            break;
+
+        case ND_LVAR:
+            last = new_vreg(lw);
+            push(lw, (IrIns){.op = IR_LOAD, .dst = last, .offset = node->offset});
+            break;
+
+        case ND_CALL:
+            last = new_vreg(lw);
+            push(lw, (IrIns){.op = IR_CALL, .dst = last, .fname = node->fname});
+            break;
+
+        case ND_ASSIGN: {
+            const AstNode *lhs = ast_get(lw->ast, node->bin.lhs);
+            if (top->state == 0) {
+                if (lhs->kind != ND_LVAR) {
+                    diag_error(lw->diag, "left value expected");
+                }
+                top->state = 1;
+                ast_stack_push(st, node->bin.rhs);
+                continue;
+            }
+
+            // the value of the assignment is the one stored
+            push(lw, (IrIns){.op = IR_STORE, .a = last, .offset = lhs->offset});
+            break;
+        }
+
+        default: {
+            NodeId operand = imm_operand(lw->ast, node);
+            if (top->state == 0) {
+                top->state = 1;
+                ast_stack_push(st, operand != NODE_NIL ? operand : node->bin.lhs);
+                continue;
+            }
+
+            if (operand == NODE_NIL && top->state == 1) {
+                // the left operand is done: the right one is next
+                top->state = 2;
+                top->val = last;
+                ast_stack_push(st, node->bin.rhs);
+                continue;
+            }
+
+            VReg dst = new_vreg(lw);
+            if (operand != NODE_NIL) {
+                const AstNode *rhs = ast_get(lw->ast, node->bin.rhs);
+                IrOp op = node->kind == ND_MUL ? IR_MULI : IR_DIVI;
+                long imm = rhs->kind == ND_NUM ? rhs->val : ast_get(lw->ast, node->bin.lhs)->val;
+                push(lw, (IrIns){.op = op, .dst = dst, .a = last, .imm = imm});
+            } else {
+                push(lw, (IrIns){.op = binary_op(node->kind), .dst = dst, .a = (VReg)top->val,
+                                 .b = last});
+            }
+            last = dst;
+            break;
+        }
+        }
+
+        st->len--;
+    }
+
+    return last;
+}
+
+static void lower_stmt(Lowering *lw, NodeId id) {
+    AstNode *node = ast_get(lw->ast, id);
+
+    switch (node->kind) {
+    case ND_RETURN: {
+        VReg v = lower_expr(lw, node->bin.lhs);
+        push(lw, (IrIns){.op = IR_RET, .a = v});
+        return;
+    }
+
+    case ND_IF: {
+        BlockId then = new_block(lw);
+        BlockId end = new_block(lw);
+        BlockId else_ = node->branch.else_ != NODE_NIL ? new_block(lw) : end;
+
+        push_br(lw, lower_expr(lw, node->branch.cond), then, else_);
+
+        start_block(lw, then);
+        lower_stmt(lw, node->branch.then);
+        push_jmp(lw, end);
+
+        if (node->branch.else_ != NODE_NIL) {
+            start_block(lw, else_);
+            lower_stmt(lw, node->branch.else_);
+            push_jmp(lw, end);
+        }
+
+        start_block(lw, end);
+        return;
+    }
+
+    case ND_WHILE: {
+        // rotated: the condition is tested once before the loop, then at the end of each iteration
+        BlockId body = new_loop_body(lw);
+        BlockId end = new_block(lw);
+
+        push_br(lw, lower_expr(lw, node->branch.cond), body, end);
+
+        start_block(lw, body);
+        lower_stmt(lw, node->branch.then);
+        push_br(lw, lower_expr(lw, node->branch.cond), body, end);
+
+        start_block(lw, end);
+        return;
+    }
+
+    case ND_FOR: {
+        // rotated like `while`
+        BlockId body = new_loop_body(lw);
+        BlockId end = new_block(lw);
+
+        lower_expr(lw, node->loop.init);
+        push_br(lw, lower_expr(lw, node->loop.cond), body, end);
+
+        start_block(lw, body);
+        lower_stmt(lw, node->loop.then);
+        lower_expr(lw, node->loop.inc);
+        push_br(lw, lower_expr(lw, node->loop.cond), body, end);
+
+        start_block(lw, end);
+        return;
+    }
+
+    case ND_BLOCK:
+        for (NodeId n = node->body; n != NODE_NIL; n = ast_get(lw->ast, n)->next) {
+            lower_stmt(lw, n);
+        }
+        return;
+
+    default:
+        // expression statement; the value is discarded
+        lower_expr(lw, id);
+        return;
+    }
+}
+
+static void add_pred(IrBlock *block, BlockId pred) {
+    if (block->n_preds > 0 && block->preds[block->n_preds - 1] == pred) {
+        return;
+    }
+
+    // `n_preds` is the capacity, too: blocks rarely have more than two predecessors
+    block->preds = realloc(block->preds, (block->n_preds + 1) * sizeof(BlockId));
+    if (!block->preds) {
+        panic("Out of memory (IR block predecessors)");
+    }
+    block->preds[block->n_preds++] = pred;
+}
+
+/// Sorts the blocks in the order they were started and fills in the predecessors
+static void finish(Lowering *lw) {
+    IrFunc *fn = lw->fn;
+
+    IrBlock *blocks = malloc(fn->cap * sizeof(IrBlock));
+    if (!blocks) {
+        panic("Out of memory (%u IR blocks)", fn->cap);
+    }
+    for (BlockId b = 0; b < fn->n_blocks; b++) {
+        blocks[lw->start[b]] = fn->blocks[b];
+    }
+    free(fn->blocks);
+    fn->blocks = blocks;
+
+    for (BlockId b = 0; b < fn->n_blocks; b++) {
+        IrBlock *block = &fn->blocks[b];
+        IrIns *term = ir_terminator(block);
+        int n_succs = ir_n_succs(block);
+
+        if (n_succs >= 1) {
+            term->br.then = lw->start[term->br.then];
+            add_pred(&fn->blocks[term->br.then], b);
+        }
+        if (n_succs == 2) {
+            term->br.else_ = lw->start[term->br.else_];
+            add_pred(&fn->blocks[term->br.else_], b);
+        }
+    }
+}
+
+IrFunc ir_from_ast(const Ast *ast, Diag *diag) {
+    IrFunc fn = {.n_vregs = 1, .frame_size = ast->frame_size};
+    Lowering lw = {.ast = ast, .fn = &fn, .diag = diag};
+
+    start_block(&lw, new_block(&lw));
+    for (NodeId id = ast->head; id != NODE_NIL; id = ast_get(ast, id)->next) {
+        lower_stmt(&lw, id);
+    }
+
+    // falling off the end returns zero, like `main` in C
+    if (!lw.terminated) {
+        VReg zero = new_vreg(&lw);
+        push(&lw, (IrIns){.op = IR_IMM, .dst = zero, .imm = 0});
+        push(&lw, (IrIns){.op = IR_RET, .a = zero});
+    }
+
+    finish(&lw);
+    free(lw.start);
+    ast_stack_release(&lw.stack);
+    return fn;
+}
+
+// --------------------------------------------------------------------------------
+// Promotion of local variables
+
+/// Removes the `copy`s made by the promotion where the temporary can be replaced by the variable:
+/// - `%t = copy %var` followed by reads of `%t`, before `%var` is assigned again, in the same block
+/// - `%t = op ...` immediately followed by `%var = copy %t`, the only read of `%t`
+///
+/// Temporaries are assigned once and read within the statement that computes them, so the reads of
+/// `%t` are all in its block. Variables are numbered from `first_var`.
+static void fold_copies(IrFunc *fn, VReg first_var) {
+    uint32_t *n_uses = calloc(fn->n_vregs, sizeof(uint32_t));
+    // the variable copied to each temporary, and how many times it had been assigned then
+    VReg *copy_of = calloc(fn->n_vregs, sizeof(VReg));
+    uint32_t *copy_defs = calloc(fn->n_vregs, sizeof(uint32_t));
+    uint32_t *n_defs = calloc(fn->n_vregs, sizeof(uint32_t));
+    if (!n_uses || !copy_of || !copy_defs || !n_defs) {
+        panic("Out of memory (%u virtual registers)", fn->n_vregs);
+    }
+
+    for (BlockId b = 0; b < fn->n_blocks; b++) {
+        IrBlock *block = &fn->blocks[b];
+        for (uint32_t i = 0; i < block->len; i++) {
+            VReg uses[2];
+            int n = ir_uses(&block->ins[i], uses);
+            for (int j = 0; j < n; j++) {
+                n_uses[uses[j]]++;
+            }
+        }
+    }
+
+    for (BlockId b = 0; b < fn->n_blocks; b++) {
+        IrBlock *block = &fn->blocks[b];
+
+        // forward: read the variable instead of its copy, in one pass. A copy is valid as long as
+        // the variable isn't assigned again
+        for (uint32_t i = 0; i < block->len; i++) {
+            IrIns *ins = &block->ins[i];
+            VReg uses[2];
+            int n = ir_uses(ins, uses);
+            for (int j = 0; j < n; j++) {
+                VReg *use = j == 0 ? &ins->a : &ins->b;
+                VReg var = copy_of[*use];
+                if (var != VREG_NIL && copy_defs[*use] == n_defs[var]) {
+                    n_uses[*use]--;
+                    n_uses[var]++;
+                    *use = var;
+                }
+            }
+
+            if (ir_has_dst(ins->op)) {
+                n_defs[ins->dst]++;
+            }
+            // `%t = copy %var`. `%var = copy %var` is left, since `%var` is assigned again
+            if (ins->op == IR_COPY && ins->dst < first_var && ins->a >= first_var) {
+                copy_of[ins->dst] = ins->a;
+                copy_defs[ins->dst] = n_defs[ins->a];
+            }
+        }
+
+        // the copies whose temporary is no longer read go away. Temporaries don't outlive their
+        // block
+        for (uint32_t i = 0; i < block->len; i++) {
+            IrIns *copy = &block->ins[i];
+            if (copy->op != IR_COPY || copy_of[copy->dst] == VREG_NIL) {
+                continue;
+            }
+
+            copy_of[copy->dst] = VREG_NIL;
+            if (n_uses[copy->dst] == 0) {
+                n_uses[copy->a]--;
+                copy->op = IR_OP_END;
+            }
+        }
+
+        // backward: compute into the variable directly
+        for (uint32_t i = 0; i + 1 < block->len; i++) {
+            IrIns *def = &block->ins[i];
+            IrIns *copy = &block->ins[i + 1];
+            if (def->op == IR_OP_END || !ir_has_dst(def->op) || copy->op != IR_COPY ||
+                copy->a != def->dst || n_uses[def->dst] != 1) {
+                continue;
+            }
+
+            def->dst = copy->dst;
+            copy->op = IR_OP_END;
+            i++;
+        }
+
+        // drop the removed instructions
+        uint32_t len = 0;
+        for (uint32_t i = 0; i < block->len; i++) {
+            if (block->ins[i].op != IR_OP_END) {
+                block->ins[len++] = block->ins[i];
+            }
+        }
+        block->len = len;
+    }
+
+    free(n_defs);
+    free(copy_defs);
+    free(copy_of);
+    free(n_uses);
+}
+
+void ir_promote_locals(IrFunc *fn) {
+    // one virtual register per stack slot, created on the first access
+    uint32_t n_slots = fn->frame_size / 8;
+    VReg first_var = fn->n_vregs;
+    VReg *vregs = calloc(n_slots, sizeof(VReg));
+    if (!vregs) {
+        panic("Out of memory (%u local variables)", n_slots);
+    }
+
+    for (BlockId b = 0; b < fn->n_blocks; b++) {
+        IrBlock *block = &fn->blocks[b];
+        for (uint32_t i = 0; i < block->len; i++) {
+            IrIns *ins = &block->ins[i];
+            if (ins->op != IR_LOAD && ins->op != IR_STORE) {
+                continue;
+            }
+
+            VReg *var = &vregs[ins->offset / 8];
+            if (*var == VREG_NIL) {
+                *var = fn->n_vregs++;
+            }
+
+            if (ins->op == IR_LOAD) {
+                *ins = (IrIns){.op = IR_COPY, .dst = ins->dst, .a = *var};
+            } else {
+                *ins = (IrIns){.op = IR_COPY, .dst = *var, .a = ins->a};
+            }
+        }
+    }
+
+    free(vregs);
+
+    // no stack slot is used anymore
+    fn->frame_size = 8;
+
+    fold_copies(fn, first_var);
+}
+
+// --------------------------------------------------------------------------------
+// Liveness
+
+/// Lists of blocks in compressed rows: list `i` is `blocks[start[i]]` to `blocks[start[i + 1] - 1]`
+typedef struct {
+    uint32_t *start;
+    BlockId *blocks;
+} BlockLists;
+
+static void *alloc_array(size_t n, size_t size) {
+    void *p = calloc(n ? n : 1, size);
+    if (!p) {
+        panic("Out of memory (liveness of %zu entries)", n);
+    }
+    return p;
+}
+
+/// Counts `b` in list `i` while `lists->blocks` is NULL, and stores it at `next[i]` after that
+static void list_add(BlockLists *lists, uint32_t *next, uint32_t i, BlockId b) {
+    if (lists->blocks) {
+        lists->blocks[next[i]++] = b;
+    } else {
+        lists->start[i + 1]++;
+    }
+}
+
+/// Turns the counts into the starts of the lists and allocates them
+static void lists_alloc(BlockLists *lists, uint32_t n, uint32_t *next) {
+    for (uint32_t i = 0; i < n; i++) {
+        lists->start[i + 1] += lists->start[i];
+    }
+    lists->blocks = alloc_array(lists->start[n], sizeof(BlockId));
+    memcpy(next, lists->start, n * sizeof(uint32_t));
+}
+
+static void lists_release(BlockLists *lists) {
+    free(lists->start);
+    free(lists->blocks);
+}
+
+/// Lists, for each virtual register, the blocks reading it before writing it (`reads`) or the
+/// blocks writing it (`!reads`), each block once
+static BlockLists list_mentions(const IrFunc *fn, bool reads) {
+    BlockLists lists = {.start = alloc_array(fn->n_vregs + 1, sizeof(uint32_t)), .blocks = NULL};
+    uint32_t *next = alloc_array(fn->n_vregs, sizeof(uint32_t));
+    // block + 1 where each virtual register was last listed, and last written
+    uint32_t *listed = alloc_array(fn->n_vregs, sizeof(uint32_t));
+    uint32_t *written = alloc_array(fn->n_vregs, sizeof(uint32_t));
+
+    // the first pass counts and the second one fills
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            lists_alloc(&lists, fn->n_vregs, next);
+            memset(listed, 0, fn->n_vregs * sizeof(uint32_t));
+            memset(written, 0, fn->n_vregs * sizeof(uint32_t));
+        }
+
+        for (BlockId b = 0; b < fn->n_blocks; b++) {
+            const IrBlock *block = &fn->blocks[b];
+
+            for (uint32_t i = 0; i < block->len; i++) {
+                const IrIns *ins = &block->ins[i];
+
+                VReg vs[2];
+                int n_uses = reads ? ir_uses(ins, vs) : 0;
+                for (int j = 0; j < n_uses; j++) {
+                    if (written[vs[j]] != b + 1 && listed[vs[j]] != b + 1) {
+                        listed[vs[j]] = b + 1;
+                        list_add(&lists, next, vs[j], b);
+                    }
+                }
+
+                if (!ir_has_dst(ins->op)) {
+                    continue;
+                }
+                if (!reads && listed[ins->dst] != b + 1) {
+                    listed[ins->dst] = b + 1;
+                    list_add(&lists, next, ins->dst, b);
+                }
+                written[ins->dst] = b + 1;
+            }
+        }
+    }
+
+    free(next);
+    free(listed);
+    free(written);
+    return lists;
+}
+
+/// Lists the predecessors of each block, from the terminators
+static BlockLists list_preds(const IrFunc *fn) {
+    BlockLists lists = {.start = alloc_array(fn->n_blocks + 1, sizeof(uint32_t)), .blocks = NULL};
+    uint32_t *next = alloc_array(fn->n_blocks, sizeof(uint32_t));
+
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            lists_alloc(&lists, fn->n_blocks, next);
+        }
+
+        for (BlockId b = 0; b < fn->n_blocks; b++) {
+            const IrBlock *block = &fn->blocks[b];
+            const IrIns *term = ir_terminator(block);
+            int n_succs = ir_n_succs(block);
+
+            if (n_succs >= 1) {
+                list_add(&lists, next, term->br.then, b);
+            }
+            if (n_succs == 2 && term->br.else_ != term->br.then) {
+                list_add(&lists, next, term->br.else_, b);
+            }
+        }
+    }
+
+    free(next);
+    return lists;
+}
+
+IrLiveness ir_liveness(const IrFunc *fn) {
+    IrLiveness live = {
+        .first_in = alloc_array(fn->n_vregs, sizeof(BlockId)),
+        .last_out = alloc_array(fn->n_vregs, sizeof(BlockId)),
+    };
+    for (VReg v = 0; v < fn->n_vregs; v++) {
+        live.first_in[v] = BLOCK_NIL;
+        live.last_out[v] = BLOCK_NIL;
+    }
+
+    BlockLists reads = list_mentions(fn, true);
+    BlockLists writes = list_mentions(fn, false);
+    BlockLists preds = list_preds(fn);
+
+    // the virtual register being walked where it's written, and where it's live in
+    VReg *written_by = alloc_array(fn->n_blocks, sizeof(VReg));
+    VReg *live_in_of = alloc_array(fn->n_blocks, sizeof(VReg));
+    // blocks it's live into whose predecessors are yet to be visited
+    BlockId *work = alloc_array(fn->n_blocks, sizeof(BlockId));
+
+    for (VReg v = 1; v < fn->n_vregs; v++) {
+        for (uint32_t i = writes.start[v]; i < writes.start[v + 1]; i++) {
+            written_by[writes.blocks[i]] = v;
+        }
+
+        // live into each block reading it first, and back from there until a block writing it
+        uint32_t n_work = 0;
+        for (uint32_t i = reads.start[v]; i < reads.start[v + 1]; i++) {
+            live_in_of[reads.blocks[i]] = v;
+            work[n_work++] = reads.blocks[i];
+        }
+
+        while (n_work > 0) {
+            BlockId b = work[--n_work];
+            if (b < live.first_in[v]) {
+                live.first_in[v] = b;
+            }
+
+            for (uint32_t i = preds.start[b]; i < preds.start[b + 1]; i++) {
+                BlockId p = preds.blocks[i];
+                if (live.last_out[v] == BLOCK_NIL || p > live.last_out[v]) {
+                    live.last_out[v] = p;
+                }
+
+                if (written_by[p] != v && live_in_of[p] != v) {
+                    live_in_of[p] = v;
+                    work[n_work++] = p;
+                }
+            }
+        }
+    }
+
+    free(work);
+    free(live_in_of);
+    free(written_by);
+    lists_release(&preds);
+    lists_release(&writes);
+    lists_release(&reads);
+    return live;
+}
+
+void ir_liveness_release(IrLiveness *live) {
+    free(live->first_in);
+    free(live->last_out);
+    *live = (IrLiveness){0};
+}
+
+// --------------------------------------------------------------------------------
+// Dump
+
+static void dump_line(Emitter *out, const char *fmt, ...) {
+    char line[128];
+
+    va_list ap;
+    va_start(ap, fmt);
+    int len = vsnprintf(line, sizeof line, fmt, ap);
+    va_end(ap);
+
+    emit_bytes(out, line, len < (int)sizeof line ? (size_t)len : sizeof line - 1);
+}
+
+static void dump_ins(const IrIns *ins, Emitter *out) {
+    const char *name = IR_OP_NAMES[ins->op];
+
+    switch (ins->op) {
+    case IR_IMM:
+        dump_line(out, "    %%%u = imm %ld\n", ins->dst, ins->imm);
+        return;
+    case IR_LOAD:
+        dump_line(out, "    %%%u = load [rbp-%d]\n", ins->dst, ins->offset);
+        return;
+    case IR_STORE:
+        dump_line(out, "    store [rbp-%d], %%%u\n", ins->offset, ins->a);
+        return;
+    case IR_CALL:
+        dump_line(out, "    %%%u = call ", ins->dst);
+        emit_bytes(out, ins->fname.str, ins->fname.len);
+        EMIT_STR(out, "\n");
+        return;
+    case IR_COPY:
+        dump_line(out, "    %%%u = copy %%%u\n", ins->dst, ins->a);
+        return;
+    case IR_MULI:
+    case IR_DIVI:
+        dump_line(out, "    %%%u = %s %%%u, %ld\n", ins->dst, name, ins->a, ins->imm);
+        return;
+    case IR_JMP:
+        dump_line(out, "    jmp b%u\n", ins->br.then);
+        return;
+    case IR_BR:
+        dump_line(out, "    br %%%u, b%u, b%u\n", ins->a, ins->br.then, ins->br.else_);
+        return;
+    case IR_RET:
+        dump_line(out, "    ret %%%u\n", ins->a);
+        return;
+    default:
+        dump_line(out, "    %%%u = %s %%%u, %%%u\n", ins->dst, name, ins->a, ins->b);
+        return;
+    }
+}
+
+void ir_dump(const IrFunc *fn, Emitter *out) {
+    dump_line(out, "# %u blocks, %u vregs, frame size %d\n", fn->n_blocks, fn->n_vregs - 1,
+              fn->frame_size);
+
+    for (BlockId b = 0; b < fn->n_blocks; b++) {
+        const IrBlock *block = &fn->blocks[b];
+
+        dump_line(out, "b%u:", b);
+        if (block->n_preds > 0) {
+            EMIT_STR(out, "  # preds:");
+            for (uint32_t i = 0; i < block->n_preds; i++) {
+                dump_line(out, " b%u", block->preds[i]);
+            }
+        }
+        EMIT_STR(out, "\n");
+
+        for (uint32_t i = 0; i < block->len; i++) {
+            dump_ins(&block->ins[i], out);
+        }
+    }
+}
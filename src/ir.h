@@ -0,0 +1,187 @@
+//! Three-address code between the [`Ast`] and the x86-64 assembly
+//!
+//! A function is a control-flow graph of basic blocks. Each block is a list of instructions over
+//! virtual registers, ended by exactly one terminator (`jmp`, `br` or `ret`). Local variables are
+//! lowered to explicit `load`s and `store`s of their stack slots, and `ir_promote_locals` turns
+//! them into virtual registers.
+
+#ifndef CINC_IR_H
+#define CINC_IR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ast.h"
+#include "emit.h"
+#include "utils.h"
+
+/// Virtual register, numbered from 1. Temporaries are assigned once; promoted local variables are
+/// assigned by every `copy`
+typedef uint32_t VReg;
+
+/// No virtual register (e.g. the unused operand of a unary instruction)
+#define VREG_NIL ((VReg)0)
+
+/// Index of an [`IrBlock`] in `IrFunc.blocks`, which is also the layout order
+typedef uint32_t BlockId;
+
+typedef enum {
+    /// `dst = imm`
+    IR_IMM,
+    /// `dst = [rbp - offset]`
+    IR_LOAD,
+    /// `[rbp - offset] = a`
+    IR_STORE,
+    /// `dst = fname()`
+    IR_CALL,
+    /// `dst = a`
+    IR_COPY,
+
+    // `dst = a op b`
+    IR_ADD,
+    IR_SUB,
+    IR_MUL,
+    IR_DIV,
+    IR_EQ,
+    IR_NE,
+    IR_LT,
+    IR_LE,
+    IR_GT,
+    IR_GE,
+
+    // `dst = a op imm`, by a number that selects the instructions (see `isel.h`)
+    IR_MULI,
+    IR_DIVI,
+
+    // terminators
+    /// `jmp then`
+    IR_JMP,
+    /// `br a, then, else_`: goes to `then` if `a` is non-zero
+    IR_BR,
+    /// `ret a`
+    IR_RET,
+
+    /// Number of `IrOp`s
+    IR_OP_END,
+} IrOp;
+
+typedef struct {
+    /// `IrOp`
+    uint8_t op;
+    VReg dst;
+    VReg a;
+    VReg b;
+
+    union {
+        /// (`imm`, `muli`, `divi`)
+        long imm;
+        /// (`load`, `store`) Byte offset of the local variable from the stack base pointer
+        int offset;
+        /// (`call`)
+        Slice fname;
+        /// (`jmp`, `br`) Jump targets. `jmp` uses `then` only
+        struct {
+            BlockId then;
+            BlockId else_;
+        } br;
+    };
+} IrIns;
+
+typedef struct {
+    IrIns *ins;
+    uint32_t len;
+    uint32_t cap;
+
+    /// Blocks jumping to this block
+    BlockId *preds;
+    uint32_t n_preds;
+
+    /// First block of a loop body, which the end of the loop branches back to
+    bool loop_header;
+} IrBlock;
+
+/// A function in the IR. The first block is the entry
+typedef struct {
+    IrBlock *blocks;
+    uint32_t n_blocks;
+    uint32_t cap;
+    /// Number of virtual registers, plus one for `VREG_NIL`
+    uint32_t n_vregs;
+    /// `scope_size` of the function
+    int frame_size;
+} IrFunc;
+
+/// Lowers a flattened program into one function. Errors are reported to `diag` (or exit if NULL)
+IrFunc ir_from_ast(const Ast *ast, Diag *diag);
+void ir_release(IrFunc *fn);
+
+/// Replaces the `load`s and `store`s of each local variable with `copy`s from and to a virtual
+/// register of its own. Variables never have their address taken, so every one can be promoted
+void ir_promote_locals(IrFunc *fn);
+
+/// Writes the IR in a human-readable form, for `--dump-ir`
+void ir_dump(const IrFunc *fn, Emitter *out);
+
+/// No block
+#define BLOCK_NIL UINT32_MAX
+
+/// Blocks at whose boundaries each virtual register is live, reduced to the first and the last in
+/// layout order, which is all a single live interval needs. Each virtual register is walked
+/// backwards from its reads to its writes, so the cost is the size of the live ranges, not the
+/// number of blocks times the number of virtual registers
+typedef struct {
+    /// Indexed by `VReg`: the first block it's live into, or `BLOCK_NIL`
+    BlockId *first_in;
+    /// Indexed by `VReg`: the last block it's live out of, or `BLOCK_NIL`
+    BlockId *last_out;
+} IrLiveness;
+
+IrLiveness ir_liveness(const IrFunc *fn);
+void ir_liveness_release(IrLiveness *live);
+
+/// True if the instruction writes to `dst`
+static inline bool ir_has_dst(IrOp op) {
+    return op != IR_STORE && op != IR_JMP && op != IR_BR && op != IR_RET;
+}
+
+/// Writes the virtual registers read by the instruction to `uses` and returns the count
+static inline int ir_uses(const IrIns *ins, VReg uses[2]) {
+    switch (ins->op) {
+    case IR_IMM:
+    case IR_LOAD:
+    case IR_CALL:
+    case IR_JMP:
+        return 0;
+    case IR_STORE:
+    case IR_COPY:
+    case IR_MULI:
+    case IR_DIVI:
+    case IR_BR:
+    case IR_RET:
+        uses[0] = ins->a;
+        return 1;
+    default:
+        uses[0] = ins->a;
+        uses[1] = ins->b;
+        return 2;
+    }
+}
+
+/// Returns the last instruction of a finished block
+static inline IrIns *ir_terminator(const IrBlock *block) {
+    return &block->ins[block->len - 1];
+}
+
+/// Number of successors of a finished block, which are then `term->br.then` and `term->br.else_`
+static inline int ir_n_succs(const IrBlock *block) {
+    switch (ir_terminator(block)->op) {
+    case IR_JMP:
+        return 1;
+    case IR_BR:
+        return 2;
+    default:
+        return 0;
+    }
+}
+
+#endif
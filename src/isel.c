@@ -0,0 +1,138 @@
+#include <stdbool.h>
+
+#include "asm.h"
+#include "isel.h"
+
+static const Opnd RAX = {.kind = OPND_REG, .reg = REG_RAX};
+static const Opnd RDX = {.kind = OPND_REG, .reg = REG_RDX};
+
+static bool is_pow2(unsigned long x) {
+    return x != 0 && (x & (x - 1)) == 0;
+}
+
+/// Scale of `lea r, [r + r * scale]`, which multiplies by `m`, or 0 if `m` isn't 3, 5 or 9
+static int lea_scale(unsigned long m) {
+    return m == 3 || m == 5 || m == 9 ? (int)m - 1 : 0;
+}
+
+static void write_lea(AsmBuf *as, Reg acc, int scale) {
+    asm_ins2(as, AI_LEA, opnd_reg(acc), opnd_addr(acc, acc, scale));
+}
+
+static void write_shift(AsmBuf *as, AsmOp op, Opnd x, int k) {
+    if (k > 0) {
+        asm_ins2(as, op, x, opnd_imm(k));
+    }
+}
+
+void isel_mul_imm(AsmBuf *as, Reg acc, long c) {
+    Opnd r = opnd_reg(acc);
+
+    if (c == 0) {
+        asm_ins2(as, AI_MOV, r, opnd_imm(0));
+        return;
+    }
+
+    // negate in unsigned, so that `LONG_MIN` works
+    unsigned long u = c < 0 ? 0ul - (unsigned long)c : (unsigned long)c;
+    int k = __builtin_ctzl(u);
+    unsigned long m = u >> k;
+
+    if (m == 1) {
+        // 2^k or -2^k
+        write_shift(as, AI_SHL, r, k);
+        if (c < 0) {
+            asm_ins1(as, AI_NEG, r);
+        }
+        return;
+    }
+
+    if (c > 0 && lea_scale(m)) {
+        // (3, 5 or 9) * 2^k
+        write_lea(as, acc, lea_scale(m));
+        write_shift(as, AI_SHL, r, k);
+        return;
+    }
+
+    if (c > 0 && k == 0) {
+        // (3, 5 or 9) * (3, 5 or 9)
+        for (unsigned long f = 3; f <= 9; f = f * 2 - 1) {
+            if (m % f == 0 && lea_scale(m / f)) {
+                write_lea(as, acc, lea_scale(f));
+                write_lea(as, acc, lea_scale(m / f));
+                return;
+            }
+        }
+    }
+
+    asm_ins2(as, AI_IMUL, r, opnd_imm(c));
+}
+
+DivMagic isel_div_magic(long d) {
+    const unsigned long two63 = 1ul << 63;
+    unsigned long ad = d;
+
+    // |nc|, the largest dividend with `nc % d == d - 1`
+    unsigned long anc = two63 - 1 - two63 % ad;
+    int p = 63;
+    // 2^p / |nc| and 2^p / |d|, with their remainders
+    unsigned long q1 = two63 / anc, r1 = two63 - q1 * anc;
+    unsigned long q2 = two63 / ad, r2 = two63 - q2 * ad;
+    unsigned long delta;
+
+    // the smallest `p` whose multiplier is exact for every 64-bit dividend
+    do {
+        p++;
+        q1 *= 2;
+        r1 *= 2;
+        if (r1 >= anc) {
+            q1++;
+            r1 -= anc;
+        }
+        q2 *= 2;
+        r2 *= 2;
+        if (r2 >= ad) {
+            q2++;
+            r2 -= ad;
+        }
+        delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    // may wrap to negative, which `isel_div_imm` corrects by adding the dividend
+    return (DivMagic){.magic = (long)(q2 + 1), .shift = p - 64};
+}
+
+void isel_div_imm(AsmBuf *as, Opnd n, long d) {
+    // `d` is 32-bit, so `-d` can't overflow
+    unsigned long ad = d < 0 ? -d : d;
+
+    if (is_pow2(ad)) {
+        // n / 2^k = (n + (n < 0 ? 2^k - 1 : 0)) >> k, where `cqo` sets `rdx` to the sign of `n`
+        int k = __builtin_ctzl(ad);
+        asm_ins2(as, AI_MOV, RAX, n);
+        if (k > 0) {
+            asm_ins0(as, AI_CQO);
+            asm_ins2(as, AI_SHR, RDX, opnd_imm(64 - k));
+            asm_ins2(as, AI_ADD, RAX, RDX);
+            asm_ins2(as, AI_SAR, RAX, opnd_imm(k));
+        }
+    } else {
+        // the high half of `n * magic`, in `rdx`
+        DivMagic dm = isel_div_magic(ad);
+        asm_ins2(as, AI_MOV, RAX, opnd_imm(dm.magic));
+        asm_ins1(as, AI_IMUL, n);
+        if (dm.magic < 0) {
+            asm_ins2(as, AI_ADD, RDX, n);
+        }
+        write_shift(as, AI_SAR, RDX, dm.shift);
+
+        // rounds toward zero: + 1 if the quotient is negative
+        asm_ins2(as, AI_MOV, RAX, RDX);
+        asm_ins2(as, AI_SHR, RAX, opnd_imm(63));
+        asm_ins2(as, AI_ADD, RAX, RDX);
+    }
+
+    if (d < 0) {
+        asm_ins1(as, AI_NEG, RAX);
+    }
+}
@@ -0,0 +1,38 @@
+//! Instruction selection for multiplication and division by constants
+//!
+//! `imul` takes 3 cycles and `idiv` tens of cycles, while shifts and `lea` take one. Shared by both
+//! code generators, which call these when the right operand of `*` or `/` is a number.
+//!
+//! Multiplication by a power of two becomes `shl`, by 3, 5 or 9 a `lea` (`x + x * 2`), and by their
+//! products with each other or with a power of two two such instructions. Other constants use the
+//! immediate form of `imul`.
+//!
+//! Signed division by a power of two is a shift, after adding `d - 1` to negative dividends so that
+//! the quotient rounds toward zero. Any other divisor is a multiplication by a "magic number"
+//! approximating `2^(64 + s) / d`, keeping the high 64 bits of the product (Hacker's Delight, 10-4),
+//! with the same correction for negative quotients.
+
+#ifndef CINC_ISEL_H
+#define CINC_ISEL_H
+
+#include <stdbool.h>
+
+#include "asm.h"
+
+/// Multiplier and shift that divide by a constant: `n / d = (n * magic) >> (64 + shift)`, rounded
+/// toward zero
+typedef struct {
+    long magic;
+    int shift;
+} DivMagic;
+
+/// Magic number of a divisor `d` with `2 <= d < 2^63`, which is not a power of two
+DivMagic isel_div_magic(long d);
+
+/// `acc = acc * c` in a register
+void isel_mul_imm(AsmBuf *as, Reg acc, long c);
+/// `rax = n / d` with `d` a non-zero 32-bit constant, overwriting `rdx`. `n` must be in neither
+/// `rax` nor `rdx`
+void isel_div_imm(AsmBuf *as, Opnd n, long d);
+
+#endif